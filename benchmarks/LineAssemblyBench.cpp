@@ -0,0 +1,160 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      LineAssemblyBench.cpp
+///
+/// \brief     Line assembly benchmark: reads a synthetic model of huge polygons, on single lines
+///            and on long continuation chains, with the former fgets assembly and with
+///            ObjUtils::LineReader, then parses it.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "LineReader.h"
+#include "ObjFileParser.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+namespace
+{
+using Clock_t = std::chrono::steady_clock;
+using FilePtr_t = std::unique_ptr<std::FILE, decltype(&fclose)>;
+
+/// \brief  Return the seconds elapsed since a time point.
+double getElapsedSeconds(const Clock_t::time_point start)
+{
+    return std::chrono::duration<double>(Clock_t::now() - start).count();
+}
+
+/// \brief  Write the polygons, each one on a single line then continued after each vertex.
+void writeModel(const std::filesystem::path& objFilePath, const size_t polygonSize,
+                const size_t polygonsCount)
+{
+    const FilePtr_t smtObjFile(fopen(objFilePath.c_str(), "w"), &fclose);
+    for (size_t vtxIdx = 0; vtxIdx < polygonSize; ++vtxIdx)
+    {
+        fprintf(smtObjFile.get(), "v %zu.5 %zu.25 -1.0\n", vtxIdx, vtxIdx % 97);
+    }
+
+    for (size_t polygonIdx = 0; polygonIdx < polygonsCount; ++polygonIdx)
+    {
+        fputs("f", smtObjFile.get());
+        for (size_t vtxIdx = 1; vtxIdx <= polygonSize; ++vtxIdx)
+        {
+            fprintf(smtObjFile.get(), " %zu", vtxIdx);
+        }
+
+        fputs("\nf", smtObjFile.get());
+        for (size_t vtxIdx = 1; vtxIdx <= polygonSize; ++vtxIdx)
+        {
+            fprintf(smtObjFile.get(), " %zu \\\n", vtxIdx);
+        }
+        fputs("\n", smtObjFile.get());
+    }
+}
+
+/// \brief  Assemble the lines as the former parser did: 1024 bytes reads, rescanning the whole
+///         joined line for the continuation character after each read.
+size_t readFgets(const std::filesystem::path& objFilePath)
+{
+    const FilePtr_t smtObjFile(fopen(objFilePath.c_str(), "r"), &fclose);
+
+    const uint16_t lineBufferSize = 1024;
+    char lineBuffer[lineBufferSize];
+    std::string oneLine;
+
+    size_t linesCount = 0;
+    while (fgets(lineBuffer, lineBufferSize, smtObjFile.get()) != nullptr)
+    {
+        oneLine = lineBuffer;
+        for (size_t nextLinePos = oneLine.rfind('\\'); nextLinePos != std::string::npos;)
+        {
+            oneLine[nextLinePos] = ' ';
+            if (fgets(lineBuffer, lineBufferSize, smtObjFile.get()) != nullptr)
+            {
+                oneLine += lineBuffer;
+            }
+
+            nextLinePos = oneLine.rfind('\\');
+        }
+
+        ++linesCount;
+    }
+
+    return linesCount;
+}
+
+/// \brief  Assemble the lines with the block reader.
+size_t readLineReader(const std::filesystem::path& objFilePath)
+{
+    const FilePtr_t smtObjFile(fopen(objFilePath.c_str(), "r"), &fclose);
+    ObjFileStreamReader fileReader(smtObjFile.get());
+    ObjUtils::LineReader lineReader(fileReader);
+
+    size_t linesCount = 0;
+    while (lineReader.readLine().has_value() == true)
+    {
+        ++linesCount;
+    }
+
+    return linesCount;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    const size_t polygonSize = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 100'000;
+    const size_t polygonsCount = (argc > 2) ? std::strtoull(argv[2], nullptr, 10) : 10;
+
+    const std::filesystem::path objFilePath = std::filesystem::temp_directory_path() /
+                                              "line_assembly_bench.obj";
+    writeModel(objFilePath, polygonSize, polygonsCount);
+
+    printf("%zu polygons of %zu vertices, %.1f MB\n", polygonsCount * 2, polygonSize,
+           std::filesystem::file_size(objFilePath) / 1e6);
+
+    Clock_t::time_point start = Clock_t::now();
+    const size_t fgetsLinesCount = readFgets(objFilePath);
+    const double fgetsSeconds = getElapsedSeconds(start);
+    printf("fgets assembly        : %8.3f s, %8zu lines\n", fgetsSeconds, fgetsLinesCount);
+
+    start = Clock_t::now();
+    const size_t readerLinesCount = readLineReader(objFilePath);
+    const double readerSeconds = getElapsedSeconds(start);
+    printf("ObjUtils::LineReader  : %8.3f s, %8zu lines\n", readerSeconds, readerLinesCount);
+
+    printf("speedup               : %8.2fx\n", fgetsSeconds / readerSeconds);
+
+    start = Clock_t::now();
+    ObjFileParser fp(objFilePath.string());
+    const ObjDatabase objDB = fp.parseFile();
+    printf("full parsing          : %8.3f s, %8zu faces\n", getElapsedSeconds(start),
+           objDB.getFacesCount());
+
+    std::filesystem::remove(objFilePath);
+
+    return 0;
+}
@@ -0,0 +1,141 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      TextExportBench.cpp
+///
+/// \brief     Text export benchmark: formats the vertices of a synthetic model as Obj lines,
+///            with std::to_string and with ObjUtils::TextBuffer.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "TextBuffer.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+/// Size of the text flushed to the output file at once.
+constexpr size_t flushSize = 1024 * 1024;
+
+using Clock_t = std::chrono::steady_clock;
+
+/// \brief  Return the seconds elapsed since a time point.
+double getElapsedSeconds(const Clock_t::time_point start)
+{
+    return std::chrono::duration<double>(Clock_t::now() - start).count();
+}
+
+/// \brief  Export with std::to_string, as the former JavaScript exporter did.
+size_t exportToString(const std::vector<float>& coords, std::FILE* pFile)
+{
+    size_t writtenSize = 0;
+    std::string text;
+    text.reserve(flushSize + 256);
+
+    for (size_t coordIdx = 0; coordIdx < coords.size(); coordIdx += 3)
+    {
+        text += "v ";
+        text += std::to_string(coords[coordIdx]);
+        text += ' ';
+        text += std::to_string(coords[coordIdx + 1]);
+        text += ' ';
+        text += std::to_string(coords[coordIdx + 2]);
+        text += '\n';
+
+        if (text.size() >= flushSize)
+        {
+            writtenSize += std::fwrite(text.data(), 1, text.size(), pFile);
+            text.clear();
+        }
+    }
+
+    return writtenSize + std::fwrite(text.data(), 1, text.size(), pFile);
+}
+
+/// \brief  Export with the shared text writers' backend.
+size_t exportTextBuffer(const std::vector<float>& coords, std::FILE* pFile)
+{
+    size_t writtenSize = 0;
+    ObjUtils::TextBuffer text(flushSize + 256);
+
+    for (size_t coordIdx = 0; coordIdx < coords.size(); coordIdx += 3)
+    {
+        text.append("v ").append(coords[coordIdx]).append(' ').append(coords[coordIdx + 1]);
+        text.append(' ').append(coords[coordIdx + 2]).append('\n');
+
+        if (text.getSize() >= flushSize)
+        {
+            writtenSize += text.getSize();
+            text.flush(pFile);
+        }
+    }
+
+    writtenSize += text.getSize();
+    text.flush(pFile);
+
+    return writtenSize;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    const size_t verticesCount = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 10'000'000;
+    const char* pOutFilePath = (argc > 2) ? argv[2] : "/dev/null";
+
+    // Random coordinates, with the magnitudes of a typical scanned model.
+    std::vector<float> coords(verticesCount * 3);
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(-250.0f, 250.0f);
+    for (float& coord : coords)
+    {
+        coord = distribution(generator);
+    }
+
+    const std::unique_ptr<std::FILE, decltype(&fclose)> smtOutFile(fopen(pOutFilePath, "wb"),
+                                                                   &fclose);
+    if (smtOutFile == nullptr)
+    {
+        return 1;
+    }
+
+    printf("%zu vertices -> %s\n", verticesCount, pOutFilePath);
+
+    Clock_t::time_point start = Clock_t::now();
+    const size_t toStringSize = exportToString(coords, smtOutFile.get());
+    const double toStringSeconds = getElapsedSeconds(start);
+    printf("std::to_string        : %8.3f s, %8.1f MB\n", toStringSeconds, toStringSize / 1e6);
+
+    start = Clock_t::now();
+    const size_t textBufferSize = exportTextBuffer(coords, smtOutFile.get());
+    const double textBufferSeconds = getElapsedSeconds(start);
+    printf("ObjUtils::TextBuffer  : %8.3f s, %8.1f MB\n", textBufferSeconds, textBufferSize / 1e6);
+
+    printf("speedup               : %8.2fx\n", toStringSeconds / textBufferSeconds);
+
+    return 0;
+}
@@ -39,23 +39,20 @@ function init()
 
     // =============================================================================================
 
-    var material = new THREE.MeshStandardMaterial( { color : 0xc2c2c2 } );
-
     // Render the Wavefront Obj model.
-    var geometry = renderObjFile();
-
-    //the face normals and vertex normals can be calculated automatically if not supplied above
-    geometry.computeFaceNormals();
-    geometry.computeVertexNormals();
-
-    var triangleMesh = new THREE.Mesh( geometry, material );
-
-    var eGeometry = new THREE.EdgesGeometry( triangleMesh.geometry );
-    var eMaterial = new THREE.LineBasicMaterial( { color: 0x000000, linewidth: 1 } );
-    var edges = new THREE.LineSegments( eGeometry , eMaterial );
-
-    triangleMesh.add(edges);
-    group.add(triangleMesh);
+    loadObjModel('data/').then(function(model) {
+        var triangleMesh = new THREE.Mesh( model.geometry, model.materials );
+        triangleMesh.scale.setScalar( model.scale );
+
+        var eGeometry = new THREE.EdgesGeometry( triangleMesh.geometry );
+        var eMaterial = new THREE.LineBasicMaterial( { color: 0x000000, linewidth: 1 } );
+        var edges = new THREE.LineSegments( eGeometry , eMaterial );
+
+        triangleMesh.add(edges);
+        group.add(triangleMesh);
+    }).catch(function(error) {
+        console.error('Could not load the Obj model: ' + error);
+    });
 
     camera.position = group.position;
     camera.position.z += 150;
@@ -73,6 +70,82 @@ function init()
     var controls = new THREE.OrbitControls(camera, renderer.domElement, renderer, scene);
 }
 
+// Fetch a binary file as a typed array.
+function fetchTypedArray(url, TypedArray)
+{
+    return fetch(url).then(function(response) {
+        if (!response.ok)
+        {
+            throw new Error(url + ': ' + response.status);
+        }
+        return response.arrayBuffer();
+    }).then(function(buffer) {
+        return new TypedArray(buffer);
+    });
+}
+
+// Build a BufferGeometry from the typed arrays written by objparser, with the model's scale and
+// its materials.
+function loadObjModel(dataDir)
+{
+    return fetch(dataDir + 'model.json').then(function(response) {
+        if (!response.ok)
+        {
+            throw new Error(dataDir + 'model.json: ' + response.status);
+        }
+        return response.json();
+    }).then(function(manifest) {
+        return Promise.all([
+            manifest,
+            fetchTypedArray(dataDir + 'positions.bin', Float32Array),
+            fetchTypedArray(dataDir + 'indices.bin', Uint32Array),
+            manifest.hasNormals ? fetchTypedArray(dataDir + 'normals.bin', Float32Array) : null,
+            manifest.hasTexCoords ? fetchTypedArray(dataDir + 'uvs.bin', Float32Array) : null
+        ]);
+    }).then(function(buffers) {
+        var manifest = buffers[0];
+        var geometry = new THREE.BufferGeometry();
+
+        geometry.setIndex( new THREE.BufferAttribute( buffers[2], 1 ) );
+        geometry.addAttribute( 'position', new THREE.BufferAttribute( buffers[1], 3 ) );
+        if (buffers[4] !== null)
+        {
+            geometry.addAttribute( 'uv', new THREE.BufferAttribute( buffers[4], 2 ) );
+        }
+
+        // The vertex normals are calculated if not supplied.
+        if (buffers[3] !== null)
+        {
+            geometry.addAttribute( 'normal', new THREE.BufferAttribute( buffers[3], 3 ) );
+        }
+        else
+        {
+            geometry.computeVertexNormals();
+        }
+
+        // One draw group per draw command, already sorted by material.
+        manifest.groups.forEach(function(objGroup) {
+            geometry.addGroup( objGroup.start, objGroup.count, objGroup.material );
+        });
+
+        // Faces without material, or with an undefined one, are grey.
+        var materials = manifest.materials.map(function(objMaterial) {
+            var material = new THREE.MeshStandardMaterial( { color : 0xc2c2c2 } );
+            if (objMaterial.diffuse !== null)
+            {
+                material.color.fromArray( objMaterial.diffuse );
+            }
+            material.name = objMaterial.name;
+            return material;
+        });
+
+        geometry.name = manifest.source;
+        geometry.computeBoundingSphere();
+
+        return { geometry : geometry, scale : manifest.scale, materials : materials };
+    });
+}
+
 function animate()
 {
     camera.updateProjectionMatrix();
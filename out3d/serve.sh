@@ -0,0 +1,4 @@
+#!/bin/sh
+# Serve the viewer locally: the typed arrays are fetched, so file:// URLs can't be used.
+# Usage: out3d/serve.sh [port], then open http://localhost:<port>/
+cd "$(dirname "$0")" && exec python3 -m http.server "${1:-8000}"
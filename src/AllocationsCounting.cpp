@@ -0,0 +1,57 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      AllocationsCounting.cpp
+///
+/// \brief     Replacement of the global allocation functions counting the heap allocations in the
+///            ParseStats, for the programs built with OBJ_COUNT_ALLOCATIONS. Part of the
+///            objparser executable and of the tests, never of the library.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifdef OBJ_COUNT_ALLOCATIONS
+
+#include "ParseStats.h"
+
+#include <cstdlib>
+#include <new>
+
+// The other forms (nothrow, arrays, sized delete) forward to these ones by default.
+void* operator new(const size_t size)
+{
+    ParseStats::countAllocation(size);
+
+    if (void* const pMemory = std::malloc((size > 0) ? size : 1); pMemory != nullptr)
+    {
+        return pMemory;
+    }
+
+    throw std::bad_alloc();
+}
+
+// =================================================================================================
+
+void operator delete(void* const pMemory) noexcept
+{
+    std::free(pMemory);
+}
+
+#endif
@@ -0,0 +1,85 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      LineReader.h
+///
+/// \brief     Block-buffered reader of the logical lines of the Obj and Mtl texts.
+/// \details   The text is read by blocks and the lines are returned as views into the block, of any
+///            length. Physical lines ending with the continuation character (\) are joined in
+///            place, the joined line stays contiguous and no character is copied per line.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef LINEREADER_H_
+#define LINEREADER_H_
+
+#include "ObjStreamReader.h"
+
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace ObjUtils
+{
+/// \brief  Reader of the logical lines of a text.
+class LineReader final
+{
+public:
+    /// \brief  Constructor.
+    ///
+    /// \param  reader Source of the text, it must outlive the line reader.
+    /// \param  blockSize Size of the read blocks, the buffer grows beyond it for longer lines.
+    explicit LineReader(ObjStreamReader& reader, const size_t blockSize = 64 * 1024) :
+        m_reader(reader), m_buffer(blockSize)
+    {
+    }
+
+    /// \brief  Read the next logical line. Its continuation characters and end of lines are
+    ///         replaced with blanks.
+    ///
+    /// \return The line without its end of line, valid until the next read, or std::nullopt at
+    ///         the end of the file.
+    std::optional<std::string_view> readLine();
+
+    // Accessors ===================================================================================
+
+    uintmax_t getReadBytesCount() const { return m_readBytesCount; }
+
+private:
+    /// \brief  Move the current line to the front of the buffer, growing it if the line fills it,
+    ///         and read the next block after it.
+    ///
+    /// \return False at the end of the file.
+    bool readBlock();
+
+    // Members =====================================================================================
+
+    ObjStreamReader& m_reader;       ///< Source of the text.
+    std::vector<char> m_buffer;      ///< Read blocks, its size is the capacity.
+    size_t m_lineStart = 0;          ///< Position of the current line in the buffer.
+    size_t m_dataEnd = 0;            ///< End of the read characters in the buffer.
+    uintmax_t m_readBytesCount = 0;  ///< Count of bytes read from the file.
+    bool m_endOfFile = false;        ///< True once the whole file is read.
+};
+
+} /* namespace ObjUtils */
+
+#endif /* LINEREADER_H_ */
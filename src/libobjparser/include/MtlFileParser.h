@@ -31,39 +31,91 @@
 #define MTLFILEPARSER_H_
 
 #include "Types.h"
-#include "ObjDatabase.h"
+#include "ObjMaterial.h"
 
+#include <filesystem>
+#include <optional>
+
+/// \brief Parser for Wavefront Mtl files.
 class MtlFileParser
 {
 public:
+    /// \brief  Constructor.
+    ///
+    /// \param  mtlFilePath Mtl file path.
+    explicit MtlFileParser(std::filesystem::path mtlFilePath) :
+        m_mtlFilePath(std::move(mtlFilePath)), m_mtlLibrary(m_mtlFilePath)
+    {
+    }
+
+    /// \brief  Parse a Mtl file.
+    ///
+    /// \return  The Mtl file's material library, empty if the file could not be read.
+    ObjMaterialLibrary parseFile();
+
 private:
+    using MtlElemIDResult_t = std::pair<MtlElementType, std::string_view>;
+
+    /// \brief  Parse one line of the Mtl file.
+    ///
+    /// \param  oneLine Line to parse.
+    void parseElement(std::string_view oneLine);
+
+    /// \brief  Get the current Mtl element type.
+    ///
+    /// \param  oneLine Line to parse.
+    /// \return  pair of the element type and its arguments.
+    std::optional<MtlElemIDResult_t> getElementType(std::string_view oneLine) const;
+
+    /// \brief  Parse a texture map statement and set it to the current material.
+    ///
+    /// \param  mapType Type of the texture map.
+    /// \param  args Statement's arguments.
+    void setTextureMap(const ObjMaterial::TextureMapType mapType, std::string_view args);
+
+    /// \brief  Parse a color statement (Ka/Kd/Ks/Ke/Tf): "r [g b]".
+    ///
+    /// \param  args Statement's arguments.
+    /// \param  color Parsed color.
+    static void parseColor(std::string_view args, RGB& color);
+
+    /// \brief  Parse a texture map statement: "[-option args...] file".
+    ///
+    /// \param  args Statement's arguments.
+    /// \return Parsed texture map.
+    static ObjMaterial::TextureMap parseTextureMap(std::string_view args);
+
     // Members =====================================================================================
 
-    /// Map of all Obj file keywords.
-    const KeywordsMap_t elementsKeywords =
-        {{"Ka", ElementType::VERTEX},
-         {"Kd", ElementType::VERTEX_TEXTURE},
-         {"Ks", ElementType::VERTEX_NORMAL},
-         {"Tf", ElementType::VERTEX_PARAM_SPACE},
-         {"illum", ElementType::DEGREE},
-         {"d", ElementType::BASIC_MATRIX},
-         {"Ns", ElementType::STEP_SIZE},
-         {"sharpness", ElementType::PARAM_CURVE_SURFACE},
-         {"Ni", ElementType::POINT},
-         {"map_Ka", ElementType::LINE},
-         {"map_Kd", ElementType::FACE},
-         {"map_Ks", ElementType::FACE},  // As of version 2.11 f == fo (face outline).
-         {"map_Ns", ElementType::CURVE},
-         {"map_d", ElementType::CURVE2D},
-         {"disp", ElementType::SURFACE},
-         {"decal", ElementType::PARAM_VAL},
-         {"bump", ElementType::OUT_LOOP},
-         {"refl", ElementType::IN_LOOP}};
-
-    std::vector<size_t> m_currentGroups;  ///< The current active groups.
-
-    const std::filesystem::path m_mtlFilePath = "";  ///< Path to the Obj file.
-    ObjDatabase m_objDB;                             ///< Obj entities database.
+    /// Map of all Mtl file keywords.
+    const MtlKeywordsMap_t elementsKeywords = {{"newmtl", MtlElementType::NEW_MATERIAL},
+                                               {"Ka", MtlElementType::AMBIENT},
+                                               {"Kd", MtlElementType::DIFFUSE},
+                                               {"Ks", MtlElementType::SPECULAR},
+                                               {"Ke", MtlElementType::EMISSIVE},
+                                               {"Tf", MtlElementType::TRANSMISSION_FILTER},
+                                               {"illum", MtlElementType::ILLUMINATION},
+                                               {"d", MtlElementType::DISSOLVE},
+                                               {"Tr", MtlElementType::TRANSPARENCY},
+                                               {"Ns", MtlElementType::SPECULAR_EXPONENT},
+                                               {"sharpness", MtlElementType::SHARPNESS},
+                                               {"Ni", MtlElementType::OPTICAL_DENSITY},
+                                               {"map_Ka", MtlElementType::MAP_AMBIENT},
+                                               {"map_Kd", MtlElementType::MAP_DIFFUSE},
+                                               {"map_Ks", MtlElementType::MAP_SPECULAR},
+                                               {"map_Ke", MtlElementType::MAP_EMISSIVE},
+                                               {"map_Ns", MtlElementType::MAP_SPECULAR_EXP},
+                                               {"map_d", MtlElementType::MAP_DISSOLVE},
+                                               {"map_bump", MtlElementType::MAP_BUMP},
+                                               {"map_Bump", MtlElementType::MAP_BUMP},
+                                               {"bump", MtlElementType::MAP_BUMP},
+                                               {"disp", MtlElementType::MAP_DISPLACEMENT},
+                                               {"decal", MtlElementType::MAP_DECAL},
+                                               {"refl", MtlElementType::MAP_REFLECTION}};
+
+    const std::filesystem::path m_mtlFilePath;  ///< Path to the Mtl file.
+    ObjMaterialLibrary m_mtlLibrary;            ///< Parsed materials.
+    ObjMaterial* m_pCurrentMaterial = nullptr;  ///< Material of the last newmtl statement.
 };
 
 #endif /* MTLFILEPARSER_H_ */
@@ -0,0 +1,88 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      MtlLibraryCache.h
+///
+/// \brief     Process-wide cache of the parsed Mtl material libraries.
+/// \details   Libraries are keyed by canonical path and last write time. A library referenced by
+///            many Obj files is parsed once and shared, immutable, by all of their databases.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef MTLLIBRARYCACHE_H_
+#define MTLLIBRARYCACHE_H_
+
+#include "ObjMaterial.h"
+
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+/// \brief Thread-safe cache of the parsed material libraries.
+class MtlLibraryCache
+{
+public:
+    /// \brief  Return the process-wide cache.
+    static MtlLibraryCache& getInstance();
+
+    /// \brief  Deleted copy ctor, there is one cache per process.
+    MtlLibraryCache(const MtlLibraryCache&) = delete;
+
+    /// \brief  Deleted assignment operator, there is one cache per process.
+    MtlLibraryCache& operator=(const MtlLibraryCache&) = delete;
+
+    /// \brief  Return a parsed material library, parsing it on first use or when the file changed.
+    ///         Concurrent callers asking for the same library wait for the same parsing.
+    ///
+    /// \param  mtlFilePath Path to the Mtl file.
+    /// \return Shared library, nullptr if the file does not exist.
+    std::shared_ptr<const ObjMaterialLibrary> getLibrary(const std::filesystem::path& mtlFilePath);
+
+    /// \brief  Release the cached libraries. Libraries still used by databases stay alive.
+    void clear();
+
+    // Accessors ===================================================================================
+
+    size_t getLibrariesCount() const;
+
+private:
+    using SharedLibrary_t = std::shared_future<std::shared_ptr<const ObjMaterialLibrary>>;
+
+    /// \brief Cached library of one Mtl file.
+    struct CacheEntry
+    {
+        std::filesystem::file_time_type m_lastWriteTime;  ///< Mtl file's time when parsed.
+        SharedLibrary_t m_library;                        ///< Library, ready once parsed.
+    };
+
+    /// \brief  Default ctor, see getInstance().
+    MtlLibraryCache() = default;
+
+    // Members =====================================================================================
+
+    mutable std::mutex m_mutex;                              ///< Protects m_entries.
+    std::unordered_map<std::string, CacheEntry> m_entries;  ///< Libraries by canonical path.
+};
+
+#endif /* MTLLIBRARYCACHE_H_ */
@@ -0,0 +1,127 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ObjBatchLoader.h
+///
+/// \brief     Concurrent parsing of many Obj files.
+/// \details   The files are dealt, largest first, to the deques of a pool of workers. A worker
+///            parses the largest file of its own deque and steals the largest file of another
+///            worker's deque once its own is empty, so big files don't end the batch alone.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef OBJBATCHLOADER_H_
+#define OBJBATCHLOADER_H_
+
+#include "ObjDatabase.h"
+
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+/// \brief Work-stealing parser of batches of Obj files.
+class ObjBatchLoader
+{
+public:
+    /// Callback of a parsed file, invoked by the worker which parsed it.
+    using CompletionCallback_t = std::function<void(const size_t fileIdx, ObjDatabase&& objDB)>;
+
+    /// Callback of a file whose parsing threw, invoked by the worker which parsed it.
+    using FailureCallback_t = std::function<void(const size_t fileIdx, std::exception_ptr pError)>;
+
+    /// \brief Throughput of a batch.
+    struct BatchStats
+    {
+        size_t m_filesCount = 0;        ///< Count of parsed files.
+        size_t m_failedFilesCount = 0;  ///< Count of files whose parsing threw.
+        uintmax_t m_bytesCount = 0;     ///< Total size of the parsed files.
+        double m_elapsedSeconds = 0.0;  ///< Wall-clock time of the batch.
+
+        double getMegaBytesPerSecond() const
+        {
+            return (m_elapsedSeconds > 0.0) ? (m_bytesCount / 1.0e6) / m_elapsedSeconds : 0.0;
+        }
+        double getFilesPerSecond() const
+        {
+            return (m_elapsedSeconds > 0.0) ? m_filesCount / m_elapsedSeconds : 0.0;
+        }
+    };
+
+    /// \brief  Constructor.
+    ///
+    /// \param  workersCount Count of parsing threads, the hardware threads count if 0.
+    explicit ObjBatchLoader(const size_t workersCount = 0);
+
+    /// \brief  Destructor. Waits for the batch started by loadFilesAsync(), if any.
+    ~ObjBatchLoader();
+
+    /// \brief  Deleted copy ctor, an asynchronous batch uses the loader.
+    ObjBatchLoader(const ObjBatchLoader&) = delete;
+
+    /// \brief  Deleted assignment operator, an asynchronous batch uses the loader.
+    ObjBatchLoader& operator=(const ObjBatchLoader&) = delete;
+
+    /// \brief  Parse Obj files and wait for the end of the batch.
+    ///
+    /// \param  objFilesPaths Obj files to parse.
+    /// \param  onFileParsed Callback of each parsed file, called concurrently by the workers. If
+    ///         empty, the parsed databases are dropped.
+    /// \param  onFileFailed Callback of each file whose parsing, or whose onFileParsed call,
+    ///         threw, called concurrently by the workers. If empty, the failed files are only
+    ///         counted. Its own exceptions are dropped.
+    /// \return Throughput of the batch.
+    BatchStats loadFiles(const std::vector<std::filesystem::path>& objFilesPaths,
+                         const CompletionCallback_t& onFileParsed,
+                         const FailureCallback_t& onFileFailed = nullptr);
+
+    /// \brief  Parse Obj files in the background, after the end of the previous asynchronous
+    ///         batch.
+    ///
+    /// \param  objFilesPaths Obj files to parse.
+    /// \return One future per file, in the files' order. The future of a file whose parsing
+    ///         threw rethrows the exception.
+    std::vector<std::future<ObjDatabase>>
+    loadFilesAsync(const std::vector<std::filesystem::path>& objFilesPaths);
+
+    /// \brief  Expand files, directories (searched recursively for .obj, .obj.gz and .obj.zst
+    ///         files) and glob patterns into a list of Obj files. Without glob(), only the last
+    ///         component of a pattern may contain '*' or '?' wildcards.
+    ///
+    /// \param  patterns Files, directories or glob patterns.
+    /// \return Obj files.
+    static std::vector<std::filesystem::path> expandPaths(const std::vector<std::string>& patterns);
+
+    // Accessors ===================================================================================
+
+    size_t getWorkersCount() const { return m_workersCount; }
+
+private:
+    // Members =====================================================================================
+
+    const size_t m_workersCount;  ///< Count of parsing threads.
+    std::thread m_asyncBatch;     ///< Thread running the batch of loadFilesAsync().
+};
+
+#endif /* OBJBATCHLOADER_H_ */
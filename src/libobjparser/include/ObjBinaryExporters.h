@@ -0,0 +1,98 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ObjBinaryExporters.h
+///
+/// \brief     Binary exporters for the simulation tools: little-endian binary PLY and raw
+///            typed-array dumps (.f32/.u32).
+/// \details   The exporters stream their output through a bounded staging buffer. Contiguous
+///            float/index arrays, such as the buffers of an ObjRenderMesh, are written directly
+///            without intermediate copy.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef OBJBINARYEXPORTERS_H_
+#define OBJBINARYEXPORTERS_H_
+
+#include <filesystem>
+
+class ObjDatabase;
+class ObjRenderMesh;
+
+/// \brief Binary little-endian PLY exporter.
+/// \details From an Obj database: geometric vertices (x, y, z) and polygons with 0-based indices.
+///          Polygons of more than 255 corners are split in triangles. From a render mesh: the
+///          welded vertices with their normals (nx, ny, nz) and texture coordinates (s, t) when
+///          present, and the triangles.
+class ObjPlyExporter
+{
+public:
+    /// \brief  Constructor. The Obj database must outlive the exporter.
+    explicit ObjPlyExporter(const ObjDatabase& objDB) : m_pObjDB(&objDB) {}
+
+    /// \brief  Constructor. The render mesh must outlive the exporter.
+    explicit ObjPlyExporter(const ObjRenderMesh& renderMesh) : m_pRenderMesh(&renderMesh) {}
+
+    /// \brief  Write the PLY file.
+    ///
+    /// \param  plyFilePath Path to the PLY file to write.
+    /// \return true if the whole file was written, false on I/O error.
+    bool exportFile(const std::filesystem::path& plyFilePath) const;
+
+private:
+    // Members =====================================================================================
+
+    const ObjDatabase* m_pObjDB = nullptr;         ///< Source Obj database, if any.
+    const ObjRenderMesh* m_pRenderMesh = nullptr;  ///< Source render mesh, if any.
+};
+
+/// \brief Raw typed arrays exporter: one headerless little-endian file per buffer.
+/// \details Written files, named after a base path:
+///          - <base>.positions.f32: x, y, z per vertex.
+///          - <base>.indices.u32: 0-based vertices indices, 3 per triangle.
+///          - <base>.normals.f32 and <base>.texcoords.f32: render meshes only, when present.
+///          From an Obj database, the geometric vertices are written and the polygons are
+///          triangulated as fans.
+class ObjRawBuffersExporter
+{
+public:
+    /// \brief  Constructor. The Obj database must outlive the exporter.
+    explicit ObjRawBuffersExporter(const ObjDatabase& objDB) : m_pObjDB(&objDB) {}
+
+    /// \brief  Constructor. The render mesh must outlive the exporter.
+    explicit ObjRawBuffersExporter(const ObjRenderMesh& renderMesh) : m_pRenderMesh(&renderMesh)
+    {
+    }
+
+    /// \brief  Write the raw buffers files.
+    ///
+    /// \param  basePath Base path of the files, the buffers' suffixes are appended to it.
+    /// \return true if all the files were written, false on I/O error.
+    bool exportFiles(const std::filesystem::path& basePath) const;
+
+private:
+    // Members =====================================================================================
+
+    const ObjDatabase* m_pObjDB = nullptr;         ///< Source Obj database, if any.
+    const ObjRenderMesh* m_pRenderMesh = nullptr;  ///< Source render mesh, if any.
+};
+
+#endif /* OBJBINARYEXPORTERS_H_ */
@@ -0,0 +1,135 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ObjBufferAllocator.h
+///
+/// \brief     Allocator of the Obj database's buffers, allocating from a shared memory resource.
+/// \details   The allocator owns its memory resource, so that a buffer keeps it alive as long as
+///            it holds memory from it. It propagates with the buffers when they are moved or
+///            swapped. Without a memory resource, it allocates as std::allocator does.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef OBJBUFFERALLOCATOR_H_
+#define OBJBUFFERALLOCATOR_H_
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+
+/// \brief Allocator of the Obj database's buffers.
+template<typename T>
+class ObjBufferAllocator
+{
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    /// \brief  Default ctor, allocates as std::allocator does.
+    ObjBufferAllocator() noexcept = default;
+
+    /// \brief  Constructor.
+    ///
+    /// \param  spMemory Memory resource to allocate from, nullptr for std::allocator's memory.
+    explicit ObjBufferAllocator(std::shared_ptr<std::pmr::memory_resource> spMemory) noexcept
+        : m_spMemory(std::move(spMemory))
+    {
+    }
+
+    /// \brief  Converting ctor, shares the memory resource of an allocator of another type.
+    template<typename U>
+    ObjBufferAllocator(const ObjBufferAllocator<U>& other) noexcept
+        : m_spMemory(other.getMemoryResource())
+    {
+    }
+
+    /// \brief  Default copy ctor. Moves copy too, a moved allocator must still equal its copy.
+    ObjBufferAllocator(const ObjBufferAllocator&) noexcept = default;
+
+    /// \brief  Default assignment operator.
+    ObjBufferAllocator& operator=(const ObjBufferAllocator&) noexcept = default;
+
+    /// \brief  Allocate the memory of elements.
+    ///
+    /// \param  count Count of elements.
+    /// \return Uninitialized memory of the elements.
+    T* allocate(const size_t count)
+    {
+        if (m_spMemory == nullptr)
+        {
+            return std::allocator<T>().allocate(count);
+        }
+
+        if (count > (std::numeric_limits<size_t>::max() / sizeof(T)))
+        {
+            throw std::bad_array_new_length();
+        }
+
+        return static_cast<T*>(m_spMemory->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    /// \brief  Release memory returned by allocate.
+    ///
+    /// \param  p Memory of the elements.
+    /// \param  count Count of elements.
+    void deallocate(T* const p, const size_t count) noexcept
+    {
+        if (m_spMemory == nullptr)
+        {
+            std::allocator<T>().deallocate(p, count);
+        }
+        else
+        {
+            m_spMemory->deallocate(p, count * sizeof(T), alignof(T));
+        }
+    }
+
+    // Accessors ===================================================================================
+
+    const std::shared_ptr<std::pmr::memory_resource>& getMemoryResource() const noexcept
+    {
+        return m_spMemory;
+    }
+
+private:
+    // Members =====================================================================================
+
+    std::shared_ptr<std::pmr::memory_resource> m_spMemory;  ///< Memory resource, or nullptr.
+};
+
+template<typename T, typename U>
+bool operator==(const ObjBufferAllocator<T>& lhs, const ObjBufferAllocator<U>& rhs) noexcept
+{
+    return (lhs.getMemoryResource() == rhs.getMemoryResource());
+}
+
+template<typename T, typename U>
+bool operator!=(const ObjBufferAllocator<T>& lhs, const ObjBufferAllocator<U>& rhs) noexcept
+{
+    return (lhs.getMemoryResource() != rhs.getMemoryResource());
+}
+
+#endif /* OBJBUFFERALLOCATOR_H_ */
@@ -0,0 +1,150 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ObjCacheDaemon.h
+///
+/// \brief     Daemon caching parsed Obj files in shared memory for the local processes.
+/// \details   Requests are lines sent through a Unix domain socket:
+///            - "GET <path>": answered "OK <segment> <size>" with the shared-memory segment of
+///              the parsed file, to attach with ObjSharedDatabase::attach, or "ERR <reason>".
+///            - "STATS": answered "OK <files> <bytes> <hits> <misses>".
+///            Files are parsed once and their segments kept in a least recently used cache
+///            bounded by their total size. inotify drops the files as soon as they change, their
+///            modification time and size are checked on each request as well. Dropped segments
+///            live until the last process attached to them detaches.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef OBJCACHEDAEMON_H_
+#define OBJCACHEDAEMON_H_
+
+#include "ObjSharedDatabase.h"
+
+#include <array>
+#include <filesystem>
+#include <list>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+/// \brief Local cache daemon of parsed Obj files.
+class ObjCacheDaemon
+{
+public:
+    /// \brief  Constructor.
+    ///
+    /// \param  socketPath Path to the daemon's socket.
+    /// \param  memoryBudget Total size of the cached segments, the least recently used files are
+    ///         dropped beyond it.
+    explicit ObjCacheDaemon(std::filesystem::path socketPath,
+                            const size_t memoryBudget = 1024 * 1024 * 1024);
+
+    /// \brief  Destructor. Unpublishes the cached segments.
+    ~ObjCacheDaemon();
+
+    /// \brief  Deleted copy ctor, the daemon owns its socket and segments.
+    ObjCacheDaemon(const ObjCacheDaemon&) = delete;
+
+    /// \brief  Deleted assignment operator, the daemon owns its socket and segments.
+    ObjCacheDaemon& operator=(const ObjCacheDaemon&) = delete;
+
+    /// \brief  Serve the requests until requestStop() is called. Serving is serialized: files are
+    ///         parsed by the serving thread, one request at a time, so the other clients wait for
+    ///         a file being parsed. Files which fail to parse are answered "ERR".
+    ///
+    /// \return false if the socket could not be set up.
+    bool run();
+
+    /// \brief  Make run() return. Async-signal-safe, may be called from any thread.
+    void requestStop();
+
+    /// \brief  Get the shared-memory database of a file from a daemon.
+    ///
+    /// \param  socketPath Path to the daemon's socket.
+    /// \param  objFilePath Obj file, relative to the current directory of the caller.
+    /// \return The attached database, or std::nullopt.
+    static std::optional<ObjSharedDatabase> fetch(const std::filesystem::path& socketPath,
+                                                  const std::filesystem::path& objFilePath);
+
+    /// \brief  Send a request to a daemon.
+    ///
+    /// \param  socketPath Path to the daemon's socket.
+    /// \param  request Request, without its line feed.
+    /// \return The answer without its line feed, or std::nullopt if the daemon is unreachable.
+    static std::optional<std::string> sendRequest(const std::filesystem::path& socketPath,
+                                                  const std::string& request);
+
+private:
+    /// \brief Cached file.
+    struct CachedFile
+    {
+        std::string m_segmentName;                   ///< Segment of the parsed file.
+        size_t m_segmentSize = 0;                    ///< Size of the segment.
+        std::filesystem::file_time_type m_fileTime;  ///< Modification time when parsed.
+        uintmax_t m_fileSize = 0;                    ///< Size when parsed.
+        int m_watch = -1;                            ///< inotify watch, or -1.
+        std::list<std::string>::iterator m_lruItr;   ///< Place in the LRU list.
+    };
+
+    /// \brief  Answer a request.
+    ///
+    /// \param  request Request, without its line feed.
+    /// \return Answer, without its line feed.
+    std::string answerRequest(std::string_view request);
+
+    /// \brief  Return the cached file, parsing and publishing it if needed.
+    ///
+    /// \param  objFilePath Canonical path to the Obj file.
+    /// \return The cached file, or std::nullopt if it could not be parsed or published. Parsing
+    ///         exceptions are caught.
+    std::optional<std::reference_wrapper<const CachedFile>>
+    getCachedFile(const std::string& objFilePath);
+
+    /// \brief  Drop the least recently used files until the cache fits in the memory budget,
+    ///         keeping at least the most recently used one.
+    void enforceMemoryBudget();
+
+    /// \brief  Drop a cached file and unpublish its segment.
+    ///
+    /// \param  objFilePath Canonical path to the Obj file.
+    void dropFile(const std::string& objFilePath);
+
+    /// \brief  Drop the files changed since the last call.
+    void readFilesChanges();
+
+    // Members =====================================================================================
+
+    const std::filesystem::path m_socketPath;  ///< Path to the daemon's socket.
+    const size_t m_memoryBudget;               ///< Maximum total size of the cached segments.
+
+    std::unordered_map<std::string, CachedFile> m_cachedFiles;  ///< Cached files by path.
+    std::list<std::string> m_lruFiles;  ///< Cached files' paths, most recently used first.
+    std::unordered_map<int, std::string> m_watchedFiles;  ///< Cached files' paths by watch.
+
+    size_t m_cachedBytes = 0;      ///< Total size of the cached segments.
+    size_t m_hitsCount = 0;        ///< Requests answered from the cache.
+    size_t m_missesCount = 0;      ///< Requests which parsed their file.
+    size_t m_segmentsCount = 0;    ///< Count of published segments, names them.
+    int m_inotifyFd = -1;          ///< inotify instance, or -1.
+    std::array<int, 2> m_wakeFds;  ///< Pipe waking up run(), written by requestStop().
+};
+
+#endif /* OBJCACHEDAEMON_H_ */
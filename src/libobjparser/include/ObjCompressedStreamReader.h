@@ -0,0 +1,119 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ObjCompressedStreamReader.h
+///
+/// \brief     Reader of the gzip and zstd compressed Obj files, decompressed on a thread of their
+///            own while the text is parsed.
+/// \details   The decompression thread fills a bounded ring of blocks that the parser empties.
+///            It waits when all the blocks are full, the parser waits when they are all empty.
+///            The codecs are the ones found at configure time: zlib for gzip, zstd for zstd.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef OBJCOMPRESSEDSTREAMREADER_H_
+#define OBJCOMPRESSEDSTREAMREADER_H_
+
+#include "ObjStreamReader.h"
+
+#include <condition_variable>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// \brief Reader of a compressed Obj file, decompressed in the background.
+class ObjCompressedStreamReader final : public ObjStreamReader
+{
+public:
+    /// \brief Compression of a file, identified by its first bytes.
+    enum class Compression : uint8_t
+    {
+        NONE = 0,
+        GZIP,
+        ZSTD
+    };
+
+    /// \brief  Constructor. Starts the decompression.
+    ///
+    /// \param  filePath Path to the file, read as is if it is not compressed.
+    /// \param  blockSize Size of the decompressed blocks.
+    /// \param  blocksCount Count of blocks of the ring, at least 2.
+    explicit ObjCompressedStreamReader(const std::filesystem::path& filePath,
+                                       const size_t blockSize = 256 * 1024,
+                                       const size_t blocksCount = 4);
+
+    /// \brief  Destructor. Stops the decompression, even if the text is not read to its end.
+    ~ObjCompressedStreamReader() override;
+
+    /// \brief  Deleted copy ctor, the decompression thread uses the reader.
+    ObjCompressedStreamReader(const ObjCompressedStreamReader&) = delete;
+
+    /// \brief  Deleted assignment operator, the decompression thread uses the reader.
+    ObjCompressedStreamReader& operator=(const ObjCompressedStreamReader&) = delete;
+
+    size_t read(char* pBuffer, const size_t size) override;
+
+    /// \brief  Return the compression of a file.
+    ///
+    /// \param  filePath Path to the file.
+    /// \return Compression identified by the file's magic number, NONE if unreadable.
+    static Compression detectCompression(const std::filesystem::path& filePath);
+
+    /// \brief  Return true if the library is built with the codec of a compression.
+    static bool isCompressionAvailable(const Compression compression);
+
+    // Accessors ===================================================================================
+
+    /// \brief  Return true if the file could not be opened or decompressed to its end. The text
+    ///         read so far is valid.
+    bool hasFailed() const override
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        return m_hasFailed;
+    }
+
+private:
+    /// \brief  Decompression thread: fills the blocks until the end of the file or the reader's
+    ///         destruction.
+    ///
+    /// \param  filePath Path to the file.
+    void runDecompressor(const std::filesystem::path filePath);
+
+    // Members =====================================================================================
+
+    std::vector<std::vector<char>> m_blocks;  ///< Ring of decompressed blocks.
+    std::vector<size_t> m_blocksSizes;        ///< Count of decompressed bytes of each block.
+    size_t m_readBlockIdx = 0;                ///< Block read by the parser.
+    size_t m_readPos = 0;                     ///< Position of the parser in its block.
+
+    mutable std::mutex m_mutex;             ///< Protects the members below.
+    std::condition_variable m_blockFilled;  ///< Signals a filled block or the end of the file.
+    std::condition_variable m_blockFreed;   ///< Signals a read block or the reader's stop.
+    size_t m_filledBlocksCount = 0;         ///< Count of blocks filled and not read yet.
+    bool m_isEndOfFile = false;             ///< Is the whole file decompressed?
+    bool m_hasFailed = false;               ///< Did the decompression fail?
+    bool m_isStopping = false;              ///< Is the reader being destroyed?
+
+    std::thread m_decompressor;  ///< Decompression thread.
+};
+
+#endif /* OBJCOMPRESSEDSTREAMREADER_H_ */
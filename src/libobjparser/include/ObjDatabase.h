@@ -33,17 +33,86 @@
 #include "ObjEntityVertex.h"
 #include "ObjEntityFace.h"
 #include "ObjEntityGroup.h"
+#include "ObjGroupViews.h"
+#include "ObjMaterial.h"
+#include "ObjQuantizedVertices.h"
 
+#include <algorithm>
+#include <array>
 #include <vector>
 #include <queue>
+#include <deque>
+#include <memory>
+#include <optional>
 
 /// \brief Obj entities database.
 class ObjDatabase
 {
 public:
+    /// \brief Consecutive sorted faces sharing the same material (and group).
+    struct FacesBatch
+    {
+        MaterialID_t m_materialID = NO_MATERIAL_ID;  ///< Material of the faces.
+        std::string_view m_groupName;                ///< Group of the faces, if sorted by group.
+        size_t m_firstFace = 0;                      ///< First face in the sorted faces.
+        size_t m_facesCount = 0;                     ///< Count of faces.
+    };
+
+    /// \brief Faces sorted by material, and the batches of the sorted faces.
+    struct FacesBatches
+    {
+        std::vector<uint32_t> m_sortedFaces;  ///< Indices in the face buffer, sorted.
+        std::vector<FacesBatch> m_batches;    ///< Batches, in the sorted faces' order.
+    };
+
+    /// \brief Counts of the database's entities at some point of a parsing, to roll it back to.
+    struct Checkpoint
+    {
+        size_t m_indicesCount = 0;                    ///< Count of vertices indices.
+        std::array<size_t, 4> m_verticesCounts = {};  ///< Count of vertices of each type.
+        size_t m_facesCount = 0;                      ///< Count of faces.
+        size_t m_groupsCount = 0;                     ///< Count of groups.
+        size_t m_entitiesCount = 0;                   ///< Count of entities.
+        size_t m_materialsCount = 0;                  ///< Count of usemtl names.
+        size_t m_materialLibrariesCount = 0;          ///< Count of mtllib files.
+    };
+
+    /// \brief Entities removed from a database after a checkpoint, as they were in it, to splice
+    ///        them back after other entities.
+    struct DetachedEntities
+    {
+        /// \brief  Return a detached group by ID.
+        ///
+        /// \param  id The group's ID in the database it was detached from.
+        /// \return Reference to the group, nullopt if it was not detached.
+        std::optional<std::reference_wrapper<const ObjEntityGroup>>
+        getGroup(const size_t id) const;
+
+        Checkpoint m_checkpoint;                           ///< Database counts when detached.
+        IndexBuffer_t m_IdxBuffer;                         ///< Detached vertices indices.
+        VertexBuffer_t m_vertexBuffer;                     ///< Detached vertices.
+        FaceBuffer_t m_faceBuffer;                         ///< Detached faces.
+        GroupBuffer_t m_groupBuffer;                       ///< Detached groups.
+        EntitiesTable_t m_allEntitiesTable;                ///< Locations of the detached entities.
+        std::vector<std::string> m_materialsNames;         ///< Detached usemtl names.
+        std::vector<std::string> m_materialLibrariesRefs;  ///< Detached mtllib files.
+
+        /// Detached material libraries, parallel to m_materialLibrariesRefs.
+        std::vector<std::shared_ptr<const ObjMaterialLibrary>> m_materialLibraries;
+
+        /// Ends of the ranges of the kept groups which included detached entities, by group ID.
+        std::unordered_map<size_t, size_t> m_keptGroupsEnds;
+    };
+
     /// \brief  Default ctor.
     ObjDatabase() = default;
 
+    /// \brief  Constructor of a database whose buffers and entities table are allocated from a
+    ///         memory resource, e.g. an ObjMappedMemoryResource to hold them out of core.
+    ///
+    /// \param  spBuffersMemory Memory resource of the buffers, shared by them.
+    explicit ObjDatabase(const std::shared_ptr<std::pmr::memory_resource>& spBuffersMemory);
+
     /// \brief  Deleted copy ctor, we only need one Obj Database instance.
     ObjDatabase(const ObjDatabase&) = delete;
 
@@ -70,7 +139,12 @@ public:
         static_assert(std::is_base_of_v<ObjEntity, std::remove_reference_t<EntT>> == true,
                       "Only ObjEntities are allowed");
 
-        std::vector<std::remove_reference_t<EntT>>* pBuffer = nullptr;
+        using Buffer_t = std::conditional_t<
+            isGroup,
+            GroupBuffer_t,
+            std::conditional_t<isVertex, VertexBuffer_t::value_type, FaceBuffer_t>>;
+
+        Buffer_t* pBuffer = nullptr;
 
         size_t entityID = 0;
 
@@ -114,10 +188,11 @@ public:
                 entityID = m_allEntitiesTable.size() + 1;
             }
             obj.setID(entityID);
+            const ElementType entityType = obj.getType();
             pBuffer->push_back(std::forward<EntT>(obj));
 
-            // Hold a reference to the newly created entity.
-            m_allEntitiesTable.push_back(pBuffer->back());
+            // Hold the location of the newly created entity.
+            m_allEntitiesTable.emplace_back(entityType, pBuffer->size() - 1);
         }
 
         return entityID;
@@ -127,6 +202,7 @@ public:
     ///
     /// \param  elemWithVertices Reference to an Obj entity.
     /// \return  Const reference to a vector of pointers to vertices.
+    /// \throw  std::logic_error if the database is quantized, its vertices are only decoded.
     VerticesRefList_t getVerticesList(const VertexBasedEntity& elemWithVertices) const;
 
     /// \brief  Return a pair of iterators to the first and the last vertices indices.
@@ -136,11 +212,30 @@ public:
     IndexBufferRangeIterators_t
     getVerticesIterators(const VertexBasedEntity& elemWithVertices) const;
 
-    /// \brief  Return a list entities included in an Obj Group.
+    /// \brief  Return a lazy view over the entities included in an Obj Group.
     ///
     /// \param  group Concerned group.
-    /// \return range of entites.
-    EntitiesRefList_t getEntitiesInGroup(const ObjEntityGroup& group) const;
+    /// \return View over the group's entities, valid as long as the group and the database are.
+    ObjGroupEntitiesView getEntitiesInGroup(const ObjEntityGroup& group) const
+    {
+        return ObjGroupEntitiesView(*this, group.getEntitiesIndicesRange(), getEntitiesCount());
+    }
+
+    /// \brief  Return a lazy view over the faces included in an Obj Group.
+    ///
+    /// \param  group Concerned group.
+    /// \return View over the group's faces, valid as long as the group and the database are.
+    ObjGroupFacesView getFacesInGroup(const ObjEntityGroup& group) const
+    {
+        return ObjGroupFacesView(m_faceBuffer, group.getEntitiesIndicesRange());
+    }
+
+    /// \brief  Return an entity based on its index in the entities table.
+    ///
+    /// \param  entityTableIdx Index of the entity in the entities table.
+    /// \return Reference to the entity.
+    /// \throw  std::logic_error for the quantized vertices, decoded by getVertex() instead.
+    const ObjEntity& getEntity(const size_t entityTableIdx) const;
 
     /// \brief  Find a group by ID and return it.
     ///
@@ -181,38 +276,174 @@ public:
     /// \param  idx the vertex's index to insert.
     void insertIndex(const size_t idx) { m_IdxBuffer.push_back(idx); }
 
-    /// \brief  Return a vertex based on its type and index in the index buffer.
+    /// \brief  Return a copy of a vertex, decoded if the database is quantized.
     ///
-    /// \param  obj Obj entity to be inserted.
-    std::optional<std::reference_wrapper<const ObjEntityVertex>> getVertex(const ElementType type,
-                                                                           const size_t idx) const
+    /// \param  type Type of the vertex.
+    /// \param  idx 0-based index of the vertex among the vertices of its type.
+    /// \return The vertex or std::nullopt if there is no such vertex.
+    std::optional<ObjEntityVertex> getVertex(const ElementType type, const size_t idx) const;
+
+    /// \brief  Call a function on each vertex of a type, in order. The vertices of a quantized
+    ///         database are decoded by blocks.
+    ///
+    /// \param  type Type of the vertices.
+    /// \param  func Function called with a const ObjEntityVertex&, only valid during the call.
+    template<typename FuncT>
+    void forEachVertex(const ElementType type, FuncT&& func) const
     {
-        switch (type)
+        const uint8_t bufferIdx = getVertexBufferIdx(type);
+        if ((m_pQuantizedVertices == nullptr) || (bufferIdx == 3))
         {
-        case ElementType::VERTEX:
-            if (idx < m_vertexBuffer[0].size())
-            {
-                return m_vertexBuffer[0][idx];
-            }
+            const auto& vBuffer = m_vertexBuffer[bufferIdx];
+            std::for_each(vBuffer.cbegin(), vBuffer.cend(), std::forward<FuncT>(func));
+            return;
+        }
 
-        case ElementType::VERTEX_TEXTURE:
-            if (idx < m_vertexBuffer[1].size())
-            {
-                return m_vertexBuffer[1][idx];
-            }
+        constexpr size_t blockSize = 256;
+        std::array<float, blockSize * 3> values;
+        ObjEntityVertex vtx(type);
 
-        case ElementType::VERTEX_NORMAL:
-            if (idx < m_vertexBuffer[2].size())
+        const size_t verticesCount = getVerticesCount(type);
+        for (size_t first = 0; first < verticesCount; first += blockSize)
+        {
+            const size_t count = std::min(blockSize, verticesCount - first);
+            const size_t componentsCount =
+                decodeQuantizedVertices(type, first, count, values.data());
+            for (size_t vtxIdx = 0; vtxIdx < count; ++vtxIdx)
             {
-                return m_vertexBuffer[2][idx];
+                const float* pValues = values.data() + vtxIdx * componentsCount;
+                vtx.m_x = pValues[0];
+                vtx.m_y = pValues[1];
+                vtx.m_z = (componentsCount == 3) ? pValues[2] : 0.0f;
+                func(static_cast<const ObjEntityVertex&>(vtx));
             }
+        }
+    }
 
-        default: break;
+    /// \brief  Insert a material library referenced by a mtllib statement.
+    ///
+    /// \param  reference Library file as written in the Obj file.
+    /// \param  pLibrary Parsed library, nullptr if the file could not be read.
+    void insertMaterialLibrary(std::string_view reference,
+                               std::shared_ptr<const ObjMaterialLibrary> pLibrary)
+    {
+        m_materialLibrariesRefs.emplace_back(reference);
+        m_materialLibraries.push_back(std::move(pLibrary));
+    }
+
+    /// \brief  Insert a material name referenced by a usemtl statement, or return the ID of the
+    ///         existing one.
+    ///
+    /// \param  name Name of the material.
+    /// \return ID of the material or std::nullopt if the materials table is full.
+    std::optional<MaterialID_t> insertMaterialName(std::string_view name);
+
+    /// \brief  Bind the materials names to the materials of the libraries. The first library
+    ///         defining a name wins, names not found in any library have no material.
+    void resolveMaterials();
+
+    /// \brief  Return the name of a material.
+    ///
+    /// \param  materialID ID of the material.
+    /// \return Name of the material, empty for NO_MATERIAL_ID.
+    std::string_view getMaterialName(const MaterialID_t materialID) const
+    {
+        if (materialID < m_materialsNames.size())
+        {
+            return m_materialsNames[materialID];
+        }
+
+        return {};
+    }
+
+    /// \brief  Return a material.
+    ///
+    /// \param  materialID ID of the material.
+    /// \return Reference to the material or std::nullopt if it is not defined by any library.
+    std::optional<std::reference_wrapper<const ObjMaterial>>
+    getMaterial(const MaterialID_t materialID) const
+    {
+        if ((materialID < m_materials.size()) && (m_materials[materialID] != nullptr))
+        {
+            return *m_materials[materialID];
         }
 
         return std::nullopt;
     }
 
+    /// \brief  Return the material of a face.
+    ///
+    /// \param  face Concerned face.
+    /// \return Reference to the material or std::nullopt.
+    std::optional<std::reference_wrapper<const ObjMaterial>>
+    getFaceMaterial(const ObjEntityFace& face) const
+    {
+        return getMaterial(face.getMaterialID());
+    }
+
+    /// \brief  Sort the faces by material, faces without material last. Each material's faces
+    ///         form one contiguous range, in the Obj file's order.
+    ///
+    /// \param  byGroup Also sort each material's faces by group (g), in the groups' order of
+    ///         appearance. Faces are in the first group including them, groups sharing a name
+    ///         are merged.
+    /// \return Sorted faces and their batches: one per material, or per (material, group).
+    FacesBatches getFacesBatches(const bool byGroup = false) const;
+
+    /// \brief  Return the current counts of the entities, to roll the database back to.
+    ///
+    /// \return Checkpoint of the database.
+    Checkpoint getCheckpoint() const;
+
+    /// \brief  Remove the entities inserted since a checkpoint. The ranges of the groups kept are
+    ///         left as they are, the parser reopens the ones that were active.
+    ///
+    /// \param  checkpoint Checkpoint returned by getCheckpoint().
+    void rollback(const Checkpoint& checkpoint);
+
+    /// \brief  Remove the entities inserted since a checkpoint and return them, with their IDs,
+    ///         vertices indices and groups ranges unchanged.
+    ///
+    /// \param  checkpoint Checkpoint returned by getCheckpoint().
+    /// \return The removed entities.
+    DetachedEntities detach(const Checkpoint& checkpoint);
+
+    /// \brief  Append detached entities, from a checkpoint taken before they were detached, as
+    ///         if they were parsed after the database's entities. Their IDs, locations, faces
+    ///         indices ranges and groups ranges are moved by the differences of the counts. The
+    ///         vertices indices stay absolute, the relative ones are moved by the differences of
+    ///         the vertices counts. The usemtl names before the checkpoint must be the database's.
+    ///
+    /// \param  detached Entities returned by detach(), the appended ones are moved from.
+    /// \param  from Checkpoint of the first appended entity, in the database detached from.
+    /// \param  continuedGroups Groups including entities before and after the checkpoint, each
+    ///         one's ID paired with the ID of the database's group whose range ends with it.
+    /// \param  relativeFaces Ranges [first, last[ of the appended faces, in the face buffer
+    ///         detached from, whose vertices indices were negative in the Obj text.
+    void splice(DetachedEntities& detached,
+                const Checkpoint& from,
+                const std::vector<std::pair<size_t, size_t>>& continuedGroups,
+                const std::vector<std::pair<size_t, size_t>>& relativeFaces);
+
+    /// \brief  Reserve the buffers and the entities table for the counts of a checkpoint, e.g.
+    ///         estimated before a parsing so that they are allocated once.
+    ///
+    /// \param  counts Counts of the entities to reserve.
+    void reserve(const Checkpoint& counts);
+
+    /// \brief  Store the geometric vertices, texture vertices and normals quantized, and release
+    ///         their float buffers. The vertices counts are kept, getVertex() and forEachVertex()
+    ///         decode the vertices on demand and the vertices iterators become empty. Quantize the
+    ///         database once parsed.
+    /// \note   Lossy: the weights (w) and the third texture coordinate are not quantized, they are
+    ///         decoded as 1 and 0. Parameter space vertices (vp) stay floats.
+    void quantizeVertices();
+
+    /// \brief  Return the quantized vertices.
+    ///
+    /// \return Quantized vertices, nullptr if the vertices are stored as floats.
+    const ObjQuantizedVertices* getQuantizedVertices() const { return m_pQuantizedVertices.get(); }
+
     /// \brief  Pre-allocate memory for the next wave of vertices indices.
     void reserveIndexBufferMemory()
     {
@@ -227,6 +458,7 @@ public:
 
     // Iterators functions
     // =========================================================================
+    // The vertices iterators of a quantized database are empty, see forEachVertex().
 
     template<const ElementType type>
     constexpr auto begin() noexcept
@@ -264,12 +496,74 @@ public:
 
     size_t getGroupsCount() const { return m_groupBuffer.size(); }
     size_t getIndexBufferCount() const { return m_IdxBuffer.size(); }
-    size_t getVerticesCount() const { return m_vertexBuffer[0].size(); }
+    const IndexBuffer_t& getIndexBuffer() const { return m_IdxBuffer; }
+    size_t getVerticesCount() const { return getVerticesCount(ElementType::VERTEX); }
+    size_t getVerticesCount(const ElementType type) const
+    {
+        if ((m_pQuantizedVertices != nullptr) && (type != ElementType::VERTEX_PARAM_SPACE))
+        {
+            switch (type)
+            {
+            case ElementType::VERTEX_TEXTURE: return m_pQuantizedVertices->getTexCoordsCount();
+            case ElementType::VERTEX_NORMAL: return m_pQuantizedVertices->getNormalsCount();
+
+            default: return m_pQuantizedVertices->getPositionsCount();
+            }
+        }
+
+        switch (type)
+        {
+        case ElementType::VERTEX_TEXTURE: return m_vertexBuffer[1].size();
+        case ElementType::VERTEX_NORMAL: return m_vertexBuffer[2].size();
+        case ElementType::VERTEX_PARAM_SPACE: return m_vertexBuffer[3].size();
+
+        default: return m_vertexBuffer[0].size();
+        }
+    }
     size_t getFacesCount() const { return m_faceBuffer.size(); }
     size_t getEntitiesCount() const { return m_allEntitiesTable.size(); }
+    const EntitiesTable_t& getEntitiesTable() const { return m_allEntitiesTable; }
+    bool hasBuffersMemory() const
+    {
+        return (m_IdxBuffer.get_allocator().getMemoryResource() != nullptr);
+    }
+    size_t getMaterialsCount() const { return m_materialsNames.size(); }
+    const std::vector<std::string>& getMaterialLibrariesRefs() const
+    {
+        return m_materialLibrariesRefs;
+    }
+    const std::vector<std::shared_ptr<const ObjMaterialLibrary>>& getMaterialLibraries() const
+    {
+        return m_materialLibraries;
+    }
     bool isEmpty() const { return m_allEntitiesTable.empty(); }
 
 private:
+    /// \brief  Return the index in m_vertexBuffer of the vertices of a type.
+    static constexpr uint8_t getVertexBufferIdx(const ElementType type)
+    {
+        switch (type)
+        {
+        case ElementType::VERTEX_TEXTURE: return 1;
+        case ElementType::VERTEX_NORMAL: return 2;
+        case ElementType::VERTEX_PARAM_SPACE: return 3;
+
+        default: return 0;
+        }
+    }
+
+    /// \brief  Decode a range of quantized vertices.
+    ///
+    /// \param  type Type of the vertices, not VERTEX_PARAM_SPACE.
+    /// \param  first Index of the first vertex to decode.
+    /// \param  count Count of vertices to decode.
+    /// \param  pValues Output buffer of count * 3 floats.
+    /// \return Count of components decoded per vertex: 2 for texture vertices, 3 otherwise.
+    size_t decodeQuantizedVertices(const ElementType type,
+                                   const size_t first,
+                                   const size_t count,
+                                   float* pValues) const;
+
     /// \brief  Get the approriate buffer for the provided element's type.
     ///
     /// \return  Entity buffer.
@@ -296,6 +590,14 @@ private:
         {
             return m_faceBuffer;
         }
+        else if constexpr ((type == ElementType::GROUP_NAME) ||
+                           (type == ElementType::SMOOTHING_GROUP) ||
+                           (type == ElementType::MERGING_GROUP) ||
+                           (type == ElementType::OBJECT_NAME))
+        {
+            // All groups types share the same buffer.
+            return m_groupBuffer;
+        }
         else
         {
             return m_allEntitiesTable;
@@ -328,6 +630,14 @@ private:
         {
             return m_faceBuffer;
         }
+        else if constexpr ((type == ElementType::GROUP_NAME) ||
+                           (type == ElementType::SMOOTHING_GROUP) ||
+                           (type == ElementType::MERGING_GROUP) ||
+                           (type == ElementType::OBJECT_NAME))
+        {
+            // All groups types share the same buffer.
+            return m_groupBuffer;
+        }
         else
         {
             return m_allEntitiesTable;
@@ -341,7 +651,23 @@ private:
     VertexBuffer_t m_vertexBuffer;         ///< Vertex buffer.
     FaceBuffer_t m_faceBuffer;             ///< Map of Faces.
     GroupBuffer_t m_groupBuffer;           ///< Map of Groups.
-    EntitiesRefList_t m_allEntitiesTable;  ///< Vector of references to all Obj entities.
+    EntitiesTable_t m_allEntitiesTable;    ///< Vector of the locations of all Obj entities.
+
+    std::vector<std::string> m_materialLibrariesRefs;  ///< mtllib files, in the Obj file's order.
+
+    /// Parsed material libraries, parallel to m_materialLibrariesRefs.
+    std::vector<std::shared_ptr<const ObjMaterialLibrary>> m_materialLibraries;
+
+    std::deque<std::string> m_materialsNames;  ///< Interned usemtl names, indexed by material ID.
+
+    /// Materials IDs by name.
+    std::unordered_map<std::string_view, MaterialID_t> m_materialsIDs;
+
+    /// Resolved materials, indexed by material ID. nullptr for names without definition.
+    std::vector<const ObjMaterial*> m_materials;
+
+    /// Quantized vertices replacing the float ones, nullptr until quantizeVertices().
+    std::unique_ptr<ObjQuantizedVertices> m_pQuantizedVertices;
 };
 
 // Iterators free functions
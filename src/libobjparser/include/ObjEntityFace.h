@@ -42,9 +42,11 @@ public:
     /// \param  firstIdx First vertex index.
     /// \param  lastIdx Last vertex index.
     /// \param  eParamsOrganization Vertices indices layout.
+    /// \param  materialID Material of the face (usemtl), NO_MATERIAL_ID if none.
     ObjEntityFace(const size_t firstIdx,
                   const size_t lastIdx,
-                  const VerticesIdxOrganization eVtxIdxOrganization);
+                  const VerticesIdxOrganization eVtxIdxOrganization,
+                  const MaterialID_t materialID = NO_MATERIAL_ID);
 
     /// \brief Default copy constructor.
     ObjEntityFace(const ObjEntityFace&) = default;
@@ -57,17 +59,19 @@ public:
     bool isTriangle() const { return m_isTriangle; }
     bool hasTextureVertex() const { return m_hasTextureVertex; }
     bool hasNormal() const { return m_hasVertexNormal; }
+    MaterialID_t getMaterialID() const { return m_materialID; }
 
 private:
     // Members =====================================================================================
 
-    bool m_isTriangle;        ///< Is this face a triangle?
-    bool m_hasTextureVertex;  ///< Does the face has a texture vertex?
-    bool m_hasVertexNormal;   ///< Does the face has a vertex normal?
+    bool m_isTriangle;          ///< Is this face a triangle?
+    bool m_hasTextureVertex;    ///< Does the face has a texture vertex?
+    bool m_hasVertexNormal;     ///< Does the face has a vertex normal?
+    MaterialID_t m_materialID;  ///< Index in the Obj database's materials table.
 };
 
 // Typedefs ========================================================================================
-using FaceBuffer_t = std::vector<ObjEntityFace>;
+using FaceBuffer_t = std::vector<ObjEntityFace, ObjBufferAllocator<ObjEntityFace>>;
 using FacesRefRange_t = std::pair<FaceBuffer_t::const_iterator, FaceBuffer_t::const_iterator>;
 
 #endif /* OBJENTITYFACE_H_ */
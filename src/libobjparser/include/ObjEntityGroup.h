@@ -34,6 +34,7 @@
 
 #include <variant>
 #include <functional>
+#include <optional>
 
 /// \brief Group of Obj elements.
 class ObjEntityGroup : public ObjEntity
@@ -86,6 +87,26 @@ public:
         idxRange.second = idx;
     }
 
+    void reopenIncludedEntityRange()
+    {
+        EntitiesIndexRange_t& idxRange = m_includedEntities.back();
+        idxRange.second = 0;
+    }
+
+    /// \brief  Move the group and its included entities by an offset in the entities table, the
+    ///         ranges not ended yet stay open.
+    ///
+    /// \param  offset Offset added to the entities indices, modulo 2^64 to move them backward.
+    void offsetIncludedEntities(const size_t offset)
+    {
+        m_entityTableIdx += offset;
+        for (auto& [start, end] : m_includedEntities)
+        {
+            start += offset;
+            end = (end != 0) ? end + offset : 0;
+        }
+    }
+
     // Operators
     // ===================================================================================
 
@@ -97,7 +118,7 @@ public:
     /// \brief  Return the group's name if type is (g/o).
     ///
     /// \return group's name or std::nullopt.
-    auto getGroupName() const;
+    std::optional<std::reference_wrapper<const std::string>> getGroupName() const;
 
     /// \brief  Return the group's number if type is (s/mg).
     ///
@@ -185,6 +206,6 @@ private:
 
 // Typedefs
 // ========================================================================================
-using GroupBuffer_t = std::vector<ObjEntityGroup>;
+using GroupBuffer_t = std::vector<ObjEntityGroup, ObjBufferAllocator<ObjEntityGroup>>;
 
 #endif /* OBJENTITYGROUP_H_ */
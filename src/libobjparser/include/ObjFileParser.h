@@ -30,15 +30,30 @@
 
 #include "Types.h"
 #include "ObjDatabase.h"
+#include "ObjStreamReader.h"
+#include "ParseStats.h"
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <filesystem>
+#include <functional>
 #include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 /// \brief Parser for Wavefront Obj files.
 class ObjFileParser
 {
+    friend class ObjLazyParser;  ///< Parses the text by batches with the parser's elements parsing.
+
 public:
+    /// \brief  Constructor of a parser of in-memory texts and streams only. Their material
+    ///         libraries are relative to the current directory.
+    ObjFileParser() = default;
+
     /// \brief  Constructor.
     ///
     /// \param  pObjFilePath Obj file path.
@@ -49,17 +64,222 @@ public:
     /// \param  pObjFilePath Obj file path.
     ObjFileParser(std::filesystem::path& objFilePath) : m_objFilePath(std::move(objFilePath)) {}
 
+    /// \brief  Constructor of a parser whose database's vertex, index and face buffers are
+    ///         allocated from a memory resource, e.g. an ObjMappedMemoryResource.
+    ///
+    /// \param  objFilePath Obj file path.
+    /// \param  spBuffersMemory Memory resource of the buffers.
+    ObjFileParser(const std::string& objFilePath,
+                  const std::shared_ptr<std::pmr::memory_resource>& spBuffersMemory)
+        : m_objFilePath(objFilePath), m_objDB(spBuffersMemory)
+    {
+    }
+
+    /// \brief  Constructor of a parser of in-memory texts and streams only, whose database's
+    ///         buffers are allocated from a memory resource.
+    ///
+    /// \param  spBuffersMemory Memory resource of the buffers.
+    explicit ObjFileParser(const std::shared_ptr<std::pmr::memory_resource>& spBuffersMemory)
+        : m_objDB(spBuffersMemory)
+    {
+    }
+
     /// \brief  Parse an Obj file.
     ///
     /// \return  An Obj Database instance.
+    /// \throw   std::runtime_error if the file cannot be read or decompressed whole.
+    /// \throw   std::invalid_argument if an element has malformed numbers.
     ObjDatabase parseFile();
 
+    /// \brief  Parse an Obj file and collect the parsing's timings and counters.
+    ///
+    /// \param  stats Stats to which the parsing's ones are added.
+    /// \return  An Obj Database instance.
+    ObjDatabase parseFile(ParseStats& stats);
+
+    /// \brief  Parse an Obj text held in memory. The Obj file path, if any, only locates the
+    ///         material libraries.
+    ///
+    /// \param  objText Obj text.
+    /// \return  An Obj Database instance.
+    ObjDatabase parseBuffer(std::string_view objText);
+
+    /// \brief  Parse an Obj text held in memory as raw bytes.
+    ///
+    /// \param  pData First byte of the text.
+    /// \param  size Size of the text in bytes.
+    /// \return  An Obj Database instance.
+    ObjDatabase parseBuffer(const std::byte* pData, const size_t size);
+
+    /// \brief  Parse an Obj text pulled from a reader up to its end, a stream of unknown length.
+    ///
+    /// \param  reader Source of the text.
+    /// \return  An Obj Database instance.
+    /// \throw   std::runtime_error if the reader failed before the end of the text.
+    ObjDatabase parseStream(ObjStreamReader& reader);
+
+    /// \brief  Parse an Obj text pulled from a reader and collect the parsing's timings and
+    ///         counters.
+    ///
+    /// \param  reader Source of the text.
+    /// \param  stats Stats to which the parsing's ones are added.
+    /// \return  An Obj Database instance.
+    ObjDatabase parseStream(ObjStreamReader& reader, ParseStats& stats);
+
+    /// \brief  Parse an Obj file and keep its database, with the fingerprints of the file's
+    ///         chunks so that reparseChanges() only reparses the file's changed chunks.
+    ///
+    /// \param  chunkSize Average size of the chunks. Each one ends at the end of a line chosen from
+    ///         the text around it, the text following an edit is split at the same lines.
+    /// \return  The kept Obj Database instance, updated by reparseChanges().
+    const ObjDatabase& parseFileIncrementally(const size_t chunkSize = 1024 * 1024);
+
+    /// \brief  Reparse an Obj file parsed by parseFileIncrementally() that changed since. The
+    ///         entities of the chunks before the first changed one are kept, the following
+    ///         chunks are reparsed until the parsing is back in the state an unchanged chunk was
+    ///         parsed in. The entities of the unchanged chunks are then moved after the reparsed
+    ///         ones instead of being reparsed, unless the vertices counts changed before chunks
+    ///         mixing negative and positive indices.
+    ///
+    /// \return  Count of reparsed bytes, 0 if the file did not change or was removed.
+    uint64_t reparseChanges();
+
+    /// \brief  Parse the lines appended since the last call to an Obj file still being written, the
+    ///         first call parses the file from its start. The last line is parsed once complete.
+    ///         The entities are appended to the kept database and the active groups go on. A
+    ///         file now shorter than the parsed text was rewritten, it is parsed again.
+    ///
+    /// \return  Count of parsed bytes, 0 if the file did not grow.
+    uint64_t followFile();
+
+    /// \brief  Return the database kept by parseFileIncrementally() or followFile().
+    ///
+    /// \return  The kept Obj Database instance.
+    const ObjDatabase& getDatabase() const { return m_objDB; }
+
 private:
+    /// \brief State of a parsing at some point of the text, to roll the parsing back to.
+    struct ParsingCheckpoint
+    {
+        ObjDatabase::Checkpoint m_dbCheckpoint;                ///< Counts of the database.
+        std::vector<size_t> m_currentGroups;                   ///< Active groups.
+        MaterialID_t m_currentMaterialID = NO_MATERIAL_ID;     ///< Material of the next faces.
+        ElementType m_lastElementType = ElementType::VERTEX;  ///< Last parsed element's type.
+    };
+
+    /// \brief Chunk of an Obj file parsed incrementally.
+    struct ParsedChunk
+    {
+        uint64_t m_hash = 0;                ///< Fingerprint of the chunk's text.
+        size_t m_size = 0;                  ///< Size of the chunk in bytes.
+        ParsingCheckpoint m_checkpoint;     ///< State of the parsing before the chunk.
+        bool m_hasRelativeIndices = false;  ///< Whether the chunk has negative vertices indices.
+        bool m_hasAbsoluteIndices = false;  ///< Whether the chunk has positive vertices indices.
+    };
+
+    /// \brief Chunks following a changed one, detached from the database until their text is
+    ///        found again after the reparsed chunks.
+    struct DetachedChunks
+    {
+        ObjDatabase::DetachedEntities m_entities;  ///< Entities parsed from the chunks.
+        std::vector<ParsedChunk> m_chunks;         ///< The chunks, as they were parsed.
+        ParsingCheckpoint m_textEndCheckpoint;     ///< State of the parsing after the chunks.
+
+        /// Indices of the chunks by fingerprint, the first one of the chunks sharing a text.
+        std::unordered_map<uint64_t, size_t> m_chunksIdxs;
+    };
+
+    /// \brief  Start a parsing kept by the parser over from an empty database.
+    void resetParsing();
+
+    /// \brief  Drop the entities and the state of an interrupted parsing.
+    void discardParsing();
+
+    /// \brief  Open the Obj file with the reader suiting it and read it.
+    ///
+    /// \param  readText Reading of the file's text.
+    void readFile(const std::function<void(ObjStreamReader&)>& readText);
+
+    /// \brief  Parse the lines of an Obj text into the database.
+    ///
+    /// \param  reader Source of the text.
+    void parseLines(ObjStreamReader& reader);
+
+    /// \brief  Create the default group, before parsing the first entity.
+    void startParsing();
+
+    /// \brief  Parse the lines of a part of an Obj text into the database.
+    ///
+    /// \param  reader Source of the text's part.
+    void readLines(ObjStreamReader& reader);
+
+    /// \brief  End the active groups and bind the materials, after parsing the last entity.
+    void endParsing();
+
+    /// \brief  Reparse the chunks of the Obj file differing from the parsed ones. The entities of
+    ///         the unchanged chunks following a changed one are detached and spliced back once
+    ///         the reparsed chunks end in the same state.
+    ///
+    /// \return  Count of reparsed bytes.
+    uint64_t parseChangedChunks();
+
+    /// \brief  Detach from the database the entities of parsed chunks and roll the parsing back
+    ///         to the first one.
+    ///
+    /// \param  chunks Parsed chunks, the detached ones are moved from.
+    /// \param  firstChunkIdx Index of the first detached chunk.
+    /// \param  textEndCheckpoint State of the parsing after the last chunk.
+    /// \return  The detached chunks.
+    DetachedChunks detachChunks(std::vector<ParsedChunk>& chunks,
+                                const size_t firstChunkIdx,
+                                const ParsingCheckpoint& textEndCheckpoint);
+
+    /// \brief  Splice back the entities of a detached chunk and of the chunks following it, if
+    ///         the chunk's text is found again and the parsing is in the state it was parsed in,
+    ///         but for the counts of the entities.
+    ///
+    /// \param  detached Detached chunks.
+    /// \param  chunkHash Fingerprint of the text following the parsed chunks.
+    /// \param  chunkSize Size of the text following the parsed chunks.
+    /// \return  The spliced chunks and the state of the parsing after them, moved as the
+    ///          entities, nullopt if the chunk was not spliced.
+    std::optional<std::pair<std::vector<ParsedChunk>, ParsingCheckpoint>> spliceDetachedChunks(
+        DetachedChunks& detached, const uint64_t chunkHash, const size_t chunkSize);
+
+    /// \brief  Return the state of the parsing.
+    ///
+    /// \return  Checkpoint of the parsing.
+    ParsingCheckpoint getParsingCheckpoint() const;
+
+    /// \brief  Roll the parsing back to a checkpoint, reopening the groups active then.
+    ///
+    /// \param  checkpoint Checkpoint returned by getParsingCheckpoint().
+    void rollback(const ParsingCheckpoint& checkpoint);
+
+    /// \brief  Run a parsing and add its timings and counters to the stats. If the parsing
+    ///         throws, it is discarded and the stats are detached before the exception goes on.
+    ///
+    /// \param  stats Stats to which the parsing's ones are added.
+    /// \param  parse Parsing to run.
+    /// \return  The parsed Obj Database instance.
+    ObjDatabase parseWithStats(ParseStats& stats, const std::function<ObjDatabase()>& parse);
+
     /// \brief  Parse one line of the Obj file.
     ///
     /// \param  oneLine Line to parse.
     void parseElement(std::string_view oneLine);
 
+    /// \brief  Charge the time elapsed since the last phase, if the stats are collected.
+    ///
+    /// \param  phase Phase to charge.
+    void lapPhase(const ParsePhase phase)
+    {
+        if (m_pPhaseClock != nullptr)
+        {
+            m_pPhaseClock->lap(phase);
+        }
+    }
+
     /// \brief  Parse Obj element's parameters.
     ///
     /// \param  elementIDRes pair of the element type and the index to its first parameter.
@@ -92,8 +312,20 @@ private:
     /// \param  elementIDRes pair of the element type and the index to its first parameter.
     void parseGroup(const ElemIDResult_t& elementIDRes);
 
-    /// \brief  Set the last included entity index for all the current groups.
-    void endCurrentGroupsEntitiesRanges();
+    /// \brief  Parse a mtllib statement and the material libraries it references.
+    ///
+    /// \param  elementIDRes pair of the element type and the index to its first parameter.
+    void parseMaterialLibrary(const ElemIDResult_t& elementIDRes);
+
+    /// \brief  Parse a usemtl statement, the material applies to the next faces.
+    ///
+    /// \param  elementIDRes pair of the element type and the index to its first parameter.
+    void parseMaterialName(const ElemIDResult_t& elementIDRes);
+
+    /// \brief  Set the last included entity index for the current groups and deactivate them.
+    ///
+    /// \param  grpType Type of the groups to end (g/s/mg), all the current groups if not set.
+    void endCurrentGroupsEntitiesRanges(const std::optional<ElementType> grpType = std::nullopt);
 
     // Members =====================================================================================
 
@@ -138,6 +370,25 @@ private:
 
     std::vector<size_t> m_currentGroups;  ///< The current active groups.
 
+    MaterialID_t m_currentMaterialID = NO_MATERIAL_ID;  ///< Material of the next faces.
+
+    size_t m_chunkSize = 0;                   ///< Size of the incrementally parsed chunks.
+    std::vector<ParsedChunk> m_parsedChunks;  ///< Chunks of the incrementally parsed file.
+    bool m_hasParsedRelativeIndices = false;  ///< Whether negative indices were parsed.
+    bool m_hasParsedAbsoluteIndices = false;  ///< Whether positive indices were parsed.
+    bool m_isFollowing = false;               ///< Whether followFile() parsed the file.
+    uint64_t m_followedBytesCount = 0;        ///< Size of the followed file's parsed lines.
+
+    /// State of the parsing at the end of the kept text, before its groups were ended.
+    ParsingCheckpoint m_textEndCheckpoint;
+
+    /// Vertices of each type parsed before the database's first ones, removed with the batches
+    /// pulled by an ObjLazyParser.
+    std::array<size_t, 4> m_pulledVerticesCounts = {};
+
+    ParseStats* m_pStats = nullptr;            ///< Collected stats, nullptr if not collected.
+    ParsePhaseClock* m_pPhaseClock = nullptr;  ///< Phases' stopwatch of the collected stats.
+
     const std::filesystem::path m_objFilePath;  ///< Path to the Obj file.
     ObjDatabase m_objDB;                        ///< Obj entities database.
 
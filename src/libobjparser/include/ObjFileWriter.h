@@ -0,0 +1,102 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ObjFileWriter.h
+///
+/// \brief     Wavefront Obj file writer.
+/// \details   Entities are written in the order of the entities table, so a file written from a
+///            parsed database parses back to the same database. The entities are formatted in
+///            parallel chunks, one text buffer per worker, then written with one writev call
+///            where available.
+///            The mtllib statements are written first.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef OBJFILEWRITER_H_
+#define OBJFILEWRITER_H_
+
+#include "Types.h"
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+class ObjDatabase;
+
+namespace ObjUtils
+{
+class TextBuffer;
+}
+
+/// \brief Wavefront Obj file writer.
+class ObjFileWriter
+{
+public:
+    /// \brief  Constructor.
+    ///
+    /// \param  objDB Obj database to write. Must outlive the writer.
+    /// \param  workersCount Maximum count of formatting threads, the hardware threads count if 0.
+    explicit ObjFileWriter(const ObjDatabase& objDB, const size_t workersCount = 0) :
+        m_objDB(objDB), m_workersCount(workersCount)
+    {
+    }
+
+    /// \brief  Write the Obj database to a file.
+    ///
+    /// \param  objFilePath Path to the Obj file to write.
+    /// \return true if the whole file was written, false on I/O error.
+    bool writeFile(const std::filesystem::path& objFilePath) const;
+
+private:
+    /// \brief Group statement (g/s/mg/o) or end of groups statement (g/s off/mg off) to write
+    ///        before an entity.
+    struct GroupStatement
+    {
+        size_t m_entityTableIdx = 0;  ///< Index of the entity written after the statement.
+        size_t m_order = 0;           ///< Order among the statements of the same entity.
+        std::string m_line;           ///< Statement's line.
+    };
+
+    /// \brief  Return the groups statements sorted by entity index, including the statements
+    ///         ending the groups before entities included in no group of the same type.
+    ///
+    /// \return Sorted groups statements.
+    std::vector<GroupStatement> getGroupsStatements() const;
+
+    /// \brief  Format a range of the entities table, with their groups statements and the usemtl
+    ///         statements of the faces whose material differs from the previous face's one.
+    ///
+    /// \param  first Index of the first entity to format.
+    /// \param  last Index past the last entity to format.
+    /// \param  statements Sorted groups statements.
+    /// \param  text Destination text buffer.
+    void formatEntities(const size_t first,
+                        const size_t last,
+                        const std::vector<GroupStatement>& statements,
+                        ObjUtils::TextBuffer& text) const;
+
+    // Members =====================================================================================
+
+    const ObjDatabase& m_objDB;   ///< Obj database to write.
+    const size_t m_workersCount;  ///< Maximum count of formatting threads, 0 for the hardware's.
+};
+
+#endif /* OBJFILEWRITER_H_ */
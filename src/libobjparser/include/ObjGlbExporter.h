@@ -0,0 +1,79 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ObjGlbExporter.h
+///
+/// \brief     Binary glTF 2.0 (GLB) exporter of the triangulated and welded buffers of an Obj
+///            database.
+/// \details   The vertices attributes and the indices are written as typed arrays in the binary
+///            chunk, one glTF mesh per sub-mesh (group). The JSON chunk is streamed to the file.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef OBJGLBEXPORTER_H_
+#define OBJGLBEXPORTER_H_
+
+#include <cstdio>
+#include <filesystem>
+#include <functional>
+#include <string_view>
+
+class ObjRenderMesh;
+
+/// \brief Binary glTF 2.0 (GLB) exporter.
+class ObjGlbExporter
+{
+public:
+    /// \brief  Constructor.
+    ///
+    /// \param  renderMesh Triangulated and welded buffers to export. Must outlive the exporter.
+    explicit ObjGlbExporter(const ObjRenderMesh& renderMesh) : m_renderMesh(renderMesh) {}
+
+    /// \brief  Write the render mesh to a GLB file.
+    ///
+    /// \param  glbFilePath Path to the GLB file to write.
+    /// \return true if the file was written, false if the mesh has no triangles or on I/O error.
+    bool exportFile(const std::filesystem::path& glbFilePath) const;
+
+private:
+    using JsonSink_t = std::function<void(std::string_view)>;
+
+    /// \brief  Write the JSON chunk's content, piece by piece, to a sink.
+    ///
+    /// \param  sink Receives the consecutive pieces of the JSON document.
+    void writeJson(const JsonSink_t& sink) const;
+
+    /// \brief  Write the binary chunk's content: positions, normals, texture coordinates and
+    ///         indices, in this order.
+    ///
+    /// \param  pFile Destination file.
+    /// \return true on success, false on I/O error.
+    bool writeBinary(std::FILE* pFile) const;
+
+    /// \brief  Return the size in bytes of the binary chunk's content.
+    size_t getBinarySize() const;
+
+    // Members =====================================================================================
+
+    const ObjRenderMesh& m_renderMesh;  ///< Triangulated and welded buffers to export.
+};
+
+#endif /* OBJGLBEXPORTER_H_ */
@@ -0,0 +1,341 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ObjGroupViews.h
+///
+/// \brief     Lazy views over the entities included in an Obj group. The views walk the group's
+///            entities ranges directly over the database's storage without any allocation.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef OBJGROUPVIEWS_H_
+#define OBJGROUPVIEWS_H_
+
+#include "Types.h"
+
+#include "ObjEntityFace.h"
+
+#include <algorithm>
+#include <iterator>
+#include <tuple>
+
+// Forward declaration of the database resolving the entities' locations.
+class ObjDatabase;
+
+/// \brief View over all the entities included in an Obj group.
+class ObjGroupEntitiesView
+{
+public:
+    /// \brief Forward iterator over the entities of the viewed group.
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = ObjEntity;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const ObjEntity*;
+        using reference = const ObjEntity&;
+
+        /// \brief  Constructor.
+        ///
+        /// \param  pObjDB Database holding the entities.
+        /// \param  pRange First entities range to walk.
+        /// \param  pRangesEnd Past-the-end entities range.
+        /// \param  entitiesCount Count of entities in the database.
+        const_iterator(const ObjDatabase* pObjDB,
+                       const EntitiesIndexRange_t* pRange,
+                       const EntitiesIndexRange_t* pRangesEnd,
+                       const size_t entitiesCount) :
+            m_pObjDB(pObjDB),
+            m_pRange(pRange), m_pRangesEnd(pRangesEnd), m_entitiesCount(entitiesCount)
+        {
+            skipEmptyRanges();
+        }
+
+        // Operators ===============================================================================
+
+        reference operator*() const;
+        pointer operator->() const { return &**this; }
+
+        const_iterator& operator++()
+        {
+            if (++m_entityIdx > getRangeLastIndex())
+            {
+                ++m_pRange;
+                skipEmptyRanges();
+            }
+
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            const_iterator itr = *this;
+            ++(*this);
+            return itr;
+        }
+
+        bool operator==(const const_iterator& other) const
+        {
+            return (m_pRange == other.m_pRange) && (m_entityIdx == other.m_entityIdx);
+        }
+
+        bool operator!=(const const_iterator& other) const { return !(*this == other); }
+
+        // Accessors ===============================================================================
+
+        /// \brief  Return the index of the current entity in the entities table.
+        size_t getEntityTableIndex() const { return m_entityIdx; }
+
+    private:
+        /// \brief  Return the last entity index of the current range, clamped to the table's size.
+        size_t getRangeLastIndex() const { return std::min(m_pRange->second, m_entitiesCount - 1); }
+
+        /// \brief  Move to the first non-empty range starting from the current one.
+        void skipEmptyRanges()
+        {
+            for (; m_pRange != m_pRangesEnd; ++m_pRange)
+            {
+                if ((m_pRange->first < m_entitiesCount) && (m_pRange->first <= m_pRange->second))
+                {
+                    m_entityIdx = m_pRange->first;
+                    return;
+                }
+            }
+
+            // Past-the-end state.
+            m_entityIdx = 0;
+        }
+
+        // Members =================================================================================
+
+        const ObjDatabase* m_pObjDB;               ///< Database holding the entities.
+        const EntitiesIndexRange_t* m_pRange;      ///< Current entities range.
+        const EntitiesIndexRange_t* m_pRangesEnd;  ///< Past-the-end entities range.
+        size_t m_entitiesCount;                    ///< Count of entities in the database.
+        size_t m_entityIdx = 0;                    ///< Current entity index in the entities table.
+    };
+
+    /// \brief  Constructor.
+    ///
+    /// \param  objDB Database holding the entities.
+    /// \param  ranges Ranges of the entities included in the group.
+    /// \param  entitiesCount Count of entities in the database.
+    ObjGroupEntitiesView(const ObjDatabase& objDB,
+                         const std::vector<EntitiesIndexRange_t>& ranges,
+                         const size_t entitiesCount) :
+        m_pObjDB(&objDB),
+        m_pRanges(&ranges), m_entitiesCount(entitiesCount)
+    {
+    }
+
+    // Iterators functions =========================================================================
+
+    const_iterator begin() const
+    {
+        return const_iterator(m_pObjDB, rangesBegin(), rangesEnd(), m_entitiesCount);
+    }
+    const_iterator end() const
+    {
+        return const_iterator(m_pObjDB, rangesEnd(), rangesEnd(), m_entitiesCount);
+    }
+
+    // Accessors ===================================================================================
+
+    bool empty() const { return (begin() == end()); }
+
+private:
+    const EntitiesIndexRange_t* rangesBegin() const { return m_pRanges->data(); }
+    const EntitiesIndexRange_t* rangesEnd() const { return m_pRanges->data() + m_pRanges->size(); }
+
+    // Members =====================================================================================
+
+    const ObjDatabase* m_pObjDB;                       ///< Database holding the entities.
+    const std::vector<EntitiesIndexRange_t>* m_pRanges;  ///< Group's entities ranges.
+    size_t m_entitiesCount;                            ///< Count of entities in the database.
+};
+
+/* ============================================================================================== */
+
+/// \brief View over the faces included in an Obj group.
+/// \details Faces are stored in the order of their insertion in the entities table, so the faces
+///          of one entities range are a contiguous slice of the faces buffer found by a binary
+///          search. Iterating the view never touches the non-face entities of the group.
+class ObjGroupFacesView
+{
+public:
+    /// \brief Forward iterator over the faces of the viewed group.
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = ObjEntityFace;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const ObjEntityFace*;
+        using reference = const ObjEntityFace&;
+
+        /// \brief  Constructor.
+        ///
+        /// \param  pFaces Faces buffer.
+        /// \param  pRange First entities range to walk.
+        /// \param  pRangesEnd Past-the-end entities range.
+        const_iterator(const FaceBuffer_t* pFaces,
+                       const EntitiesIndexRange_t* pRange,
+                       const EntitiesIndexRange_t* pRangesEnd) :
+            m_pFaces(pFaces),
+            m_pRange(pRange), m_pRangesEnd(pRangesEnd), m_faceItr(pFaces->cend()),
+            m_faceRangeEnd(pFaces->cend())
+        {
+            skipEmptyRanges();
+        }
+
+        // Operators ===============================================================================
+
+        reference operator*() const { return *m_faceItr; }
+        pointer operator->() const { return &*m_faceItr; }
+
+        const_iterator& operator++()
+        {
+            if (++m_faceItr == m_faceRangeEnd)
+            {
+                ++m_pRange;
+                skipEmptyRanges();
+            }
+
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            const_iterator itr = *this;
+            ++(*this);
+            return itr;
+        }
+
+        bool operator==(const const_iterator& other) const
+        {
+            return (m_pRange == other.m_pRange) && (m_faceItr == other.m_faceItr);
+        }
+
+        bool operator!=(const const_iterator& other) const { return !(*this == other); }
+
+    private:
+        /// \brief  Move to the first range including faces starting from the current one.
+        void skipEmptyRanges()
+        {
+            for (; m_pRange != m_pRangesEnd; ++m_pRange)
+            {
+                std::tie(m_faceItr, m_faceRangeEnd) = ObjGroupFacesView::getFacesRange(*m_pFaces,
+                                                                                       *m_pRange);
+                if (m_faceItr != m_faceRangeEnd)
+                {
+                    return;
+                }
+            }
+
+            // Past-the-end state.
+            m_faceItr = m_faceRangeEnd = m_pFaces->cend();
+        }
+
+        // Members =================================================================================
+
+        const FaceBuffer_t* m_pFaces;                ///< Faces buffer.
+        const EntitiesIndexRange_t* m_pRange;        ///< Current entities range.
+        const EntitiesIndexRange_t* m_pRangesEnd;    ///< Past-the-end entities range.
+        FaceBuffer_t::const_iterator m_faceItr;      ///< Current face.
+        FaceBuffer_t::const_iterator m_faceRangeEnd; ///< End of the current range's faces.
+    };
+
+    /// \brief  Constructor.
+    ///
+    /// \param  faces Faces buffer.
+    /// \param  ranges Ranges of the entities included in the group.
+    ObjGroupFacesView(const FaceBuffer_t& faces, const std::vector<EntitiesIndexRange_t>& ranges) :
+        m_pFaces(&faces), m_pRanges(&ranges)
+    {
+    }
+
+    /// \brief  Return the faces included in one range of entities.
+    ///
+    /// \param  faces Faces buffer.
+    /// \param  range Range of entities [start, end].
+    /// \return Pair of iterators to the first and past-the-last faces of the range.
+    static FacesRefRange_t getFacesRange(const FaceBuffer_t& faces,
+                                         const EntitiesIndexRange_t& range)
+    {
+        const auto [start, end] = range;
+        if (end < start)
+        {
+            return std::make_pair(faces.cend(), faces.cend());
+        }
+
+        // A face's ID is its index in the entities table + 1.
+        const auto firstItr = std::partition_point(faces.cbegin(),
+                                                   faces.cend(),
+                                                   [start = start](const ObjEntityFace& face) {
+                                                       return (face.getID() - 1) < start;
+                                                   });
+
+        const auto lastItr = std::partition_point(firstItr,
+                                                  faces.cend(),
+                                                  [end = end](const ObjEntityFace& face) {
+                                                      return (face.getID() - 1) <= end;
+                                                  });
+
+        return std::make_pair(firstItr, lastItr);
+    }
+
+    // Iterators functions =========================================================================
+
+    const_iterator begin() const { return const_iterator(m_pFaces, rangesBegin(), rangesEnd()); }
+    const_iterator end() const { return const_iterator(m_pFaces, rangesEnd(), rangesEnd()); }
+
+    // Accessors ===================================================================================
+
+    bool empty() const { return (begin() == end()); }
+
+    /// \brief  Return the count of faces included in the group.
+    ///
+    /// \return Count of faces.
+    size_t size() const
+    {
+        size_t count = 0;
+
+        for (const EntitiesIndexRange_t& range : *m_pRanges)
+        {
+            const auto [firstItr, lastItr] = getFacesRange(*m_pFaces, range);
+            count += std::distance(firstItr, lastItr);
+        }
+
+        return count;
+    }
+
+private:
+    const EntitiesIndexRange_t* rangesBegin() const { return m_pRanges->data(); }
+    const EntitiesIndexRange_t* rangesEnd() const { return m_pRanges->data() + m_pRanges->size(); }
+
+    // Members =====================================================================================
+
+    const FaceBuffer_t* m_pFaces;                        ///< Faces buffer.
+    const std::vector<EntitiesIndexRange_t>* m_pRanges;  ///< Group's entities ranges.
+};
+
+#endif /* OBJGROUPVIEWS_H_ */
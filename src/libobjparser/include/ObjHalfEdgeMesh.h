@@ -0,0 +1,161 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ObjHalfEdgeMesh.h
+///
+/// \brief     Half-edge adjacency structure built from the faces of an Obj database.
+/// \details   All the connectivity is stored in flat index arrays (no pointers), so the structure
+///            can be written to disk or memory mapped as is.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef OBJHALFEDGEMESH_H_
+#define OBJHALFEDGEMESH_H_
+
+#include "Types.h"
+
+#include <limits>
+#include <vector>
+
+class ObjDatabase;
+
+/// \brief Half-edge adjacency structure of an Obj database's faces.
+/// \details The half-edges of a face are stored contiguously in the face's corners order: the
+///          half-edge h goes from the corner h to the next corner of the same face. Faces and
+///          vertices are designated by their indices in the database's faces and geometric
+///          vertices buffers.
+class ObjHalfEdgeMesh
+{
+public:
+    /// Index designating a missing half-edge, face or vertex.
+    static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+    /// \brief  Edge classification flags.
+    enum EdgeFlags : uint8_t
+    {
+        EDGE_MANIFOLD = 0,           ///< Edge shared by two opposite half-edges or boundary edge.
+        EDGE_NON_MANIFOLD = 1 << 0,  ///< Edge shared by more than two faces.
+        EDGE_INCONSISTENT = 1 << 1,  ///< Edge shared by two faces with the same orientation.
+    };
+
+    /// \brief  Constructor. Builds the adjacency of all the faces of an Obj database.
+    ///
+    /// \param  objDB Obj database.
+    explicit ObjHalfEdgeMesh(const ObjDatabase& objDB);
+
+    // Half-edges navigation =======================================================================
+
+    uint32_t getOrigin(const uint32_t heIdx) const { return m_heOrigin[heIdx]; }
+    uint32_t getTarget(const uint32_t heIdx) const { return m_heOrigin[getNext(heIdx)]; }
+    uint32_t getTwin(const uint32_t heIdx) const { return m_heTwin[heIdx]; }
+    uint32_t getFace(const uint32_t heIdx) const { return m_heFace[heIdx]; }
+
+    uint32_t getNext(const uint32_t heIdx) const
+    {
+        const uint32_t faceIdx = m_heFace[heIdx];
+        return ((heIdx + 1) == m_faceFirstHalfEdge[faceIdx + 1]) ? m_faceFirstHalfEdge[faceIdx] :
+                                                                   (heIdx + 1);
+    }
+
+    uint32_t getPrev(const uint32_t heIdx) const
+    {
+        const uint32_t faceIdx = m_heFace[heIdx];
+        return (heIdx == m_faceFirstHalfEdge[faceIdx]) ? (m_faceFirstHalfEdge[faceIdx + 1] - 1) :
+                                                         (heIdx - 1);
+    }
+
+    /// \brief  Return the first half-edge of a face, INVALID_INDEX for skipped faces.
+    uint32_t getFaceHalfEdge(const uint32_t faceIdx) const
+    {
+        return (getFaceHalfEdgesCount(faceIdx) > 0) ? m_faceFirstHalfEdge[faceIdx] : INVALID_INDEX;
+    }
+
+    /// \brief  Return the count of half-edges (and corners) of a face.
+    uint32_t getFaceHalfEdgesCount(const uint32_t faceIdx) const
+    {
+        return m_faceFirstHalfEdge[faceIdx + 1] - m_faceFirstHalfEdge[faceIdx];
+    }
+
+    /// \brief  Return one half-edge leaving a vertex, INVALID_INDEX for isolated vertices.
+    uint32_t getVertexHalfEdge(const uint32_t vtxIdx) const { return m_vertexHalfEdge[vtxIdx]; }
+
+    // Queries =====================================================================================
+
+    /// \brief  Check if the edge of a half-edge belongs to only one face.
+    bool isBoundaryEdge(const uint32_t heIdx) const
+    {
+        return (m_heTwin[heIdx] == INVALID_INDEX) && (m_heEdgeFlags[heIdx] == EDGE_MANIFOLD);
+    }
+
+    /// \brief  Return the faces sharing an edge with a face.
+    ///
+    /// \param  faceIdx Index of the face.
+    /// \return Indices of the neighbor faces, one per shared manifold edge.
+    std::vector<uint32_t> getNeighborFaces(const uint32_t faceIdx) const;
+
+    /// \brief  Check that every edge is shared by at most two consistently oriented faces.
+    bool isManifold() const { return (m_nonManifoldEdgesCount == 0); }
+
+    /// \brief  Check that the mesh is manifold and has no boundary.
+    bool isClosed() const { return isManifold() && (m_boundaryEdgesCount == 0); }
+
+    // Accessors ===================================================================================
+
+    size_t getHalfEdgesCount() const { return m_heOrigin.size(); }
+    size_t getFacesCount() const { return m_faceFirstHalfEdge.size() - 1; }
+    size_t getVerticesCount() const { return m_vertexHalfEdge.size(); }
+    size_t getBoundaryEdgesCount() const { return m_boundaryEdgesCount; }
+    size_t getNonManifoldEdgesCount() const { return m_nonManifoldEdgesCount; }
+    size_t getSkippedFacesCount() const { return m_skippedFacesCount; }
+    uint8_t getEdgeFlags(const uint32_t heIdx) const { return m_heEdgeFlags[heIdx]; }
+
+    // Raw arrays, for serialization.
+    const std::vector<uint32_t>& getHalfEdgesOrigins() const { return m_heOrigin; }
+    const std::vector<uint32_t>& getHalfEdgesTwins() const { return m_heTwin; }
+    const std::vector<uint32_t>& getHalfEdgesFaces() const { return m_heFace; }
+    const std::vector<uint8_t>& getHalfEdgesFlags() const { return m_heEdgeFlags; }
+    const std::vector<uint32_t>& getFacesFirstHalfEdges() const { return m_faceFirstHalfEdge; }
+    const std::vector<uint32_t>& getVerticesHalfEdges() const { return m_vertexHalfEdge; }
+
+private:
+    /// \brief  Create the half-edges of all the faces.
+    ///
+    /// \param  objDB Obj database.
+    void buildHalfEdges(const ObjDatabase& objDB);
+
+    /// \brief  Pair the opposite half-edges by sorting the half-edges by their undirected edge.
+    void matchTwins();
+
+    // Members =====================================================================================
+
+    std::vector<uint32_t> m_heOrigin;           ///< Origin vertex of each half-edge.
+    std::vector<uint32_t> m_heTwin;             ///< Opposite half-edge of each half-edge.
+    std::vector<uint32_t> m_heFace;             ///< Face of each half-edge.
+    std::vector<uint8_t> m_heEdgeFlags;         ///< EdgeFlags of each half-edge's edge.
+    std::vector<uint32_t> m_faceFirstHalfEdge;  ///< First half-edge of each face (+ end marker).
+    std::vector<uint32_t> m_vertexHalfEdge;     ///< One outgoing half-edge of each vertex.
+
+    size_t m_boundaryEdgesCount = 0;     ///< Count of edges with only one face.
+    size_t m_nonManifoldEdgesCount = 0;  ///< Count of non-manifold or inconsistent edges.
+    size_t m_skippedFacesCount = 0;      ///< Faces with less than 3 valid corners.
+};
+
+#endif /* OBJHALFEDGEMESH_H_ */
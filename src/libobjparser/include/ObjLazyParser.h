@@ -0,0 +1,151 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ObjLazyParser.h
+///
+/// \brief     Pull parser of Obj texts, by batches of elements.
+///
+/// \details   Each batch is a small database holding the vertices and faces parsed since the
+///            previous one, and the groups including them. The elements of a batch are removed
+///            when the next one is parsed, so the text's whole database is never built. The
+///            faces' indices are those of the whole text.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef OBJLAZYPARSER_H_
+#define OBJLAZYPARSER_H_
+
+#include "LineReader.h"
+#include "ObjFileParser.h"
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+/// \brief Pull parser of an Obj text, by batches of elements.
+class ObjLazyParser
+{
+public:
+    /// \brief Input iterator over the batches, each increment parses the next batch.
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = ObjDatabase;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const ObjDatabase*;
+        using reference = const ObjDatabase&;
+
+        /// \brief  Constructor.
+        ///
+        /// \param  pParser Parser of the batches, nullptr for the past-the-end iterator.
+        explicit const_iterator(ObjLazyParser* pParser) : m_pParser(pParser) {}
+
+        // Operators ===============================================================================
+
+        reference operator*() const { return m_pParser->getBatch(); }
+        pointer operator->() const { return &m_pParser->getBatch(); }
+
+        const_iterator& operator++()
+        {
+            if (m_pParser->parseNextBatch() == false)
+            {
+                m_pParser = nullptr;
+            }
+
+            return *this;
+        }
+
+        bool operator==(const const_iterator& other) const { return m_pParser == other.m_pParser; }
+        bool operator!=(const const_iterator& other) const { return !(*this == other); }
+
+    private:
+        // Members =================================================================================
+
+        ObjLazyParser* m_pParser;  ///< Parser of the batches, nullptr past the last one.
+    };
+
+    /// \brief  Constructor of a parser of an Obj file.
+    ///
+    /// \param  objFilePath Obj file path.
+    /// \param  batchSize Count of parsed entities from which a batch ends, the groups going on
+    ///         from the previous batch excluded.
+    explicit ObjLazyParser(const std::string& objFilePath, const size_t batchSize = 4096);
+
+    /// \brief  Constructor of a parser of an Obj text pulled from a reader.
+    ///
+    /// \param  reader Source of the text, read as the batches are parsed.
+    /// \param  batchSize Count of parsed entities from which a batch ends, the groups going on
+    ///         from the previous batch excluded.
+    explicit ObjLazyParser(ObjStreamReader& reader, const size_t batchSize = 4096);
+
+    /// \brief  Deleted copy ctor, the iterators point to the parser.
+    ObjLazyParser(const ObjLazyParser&) = delete;
+
+    /// \brief  Deleted assignment operator, the iterators point to the parser.
+    ObjLazyParser& operator=(const ObjLazyParser&) = delete;
+
+    /// \brief  Parse the next batch, replacing the current one. The groups active at the end of
+    ///         the current batch go on in the next one.
+    ///
+    /// \return  False at the end of the text, there is no batch left.
+    bool parseNextBatch();
+
+    /// \brief  Return an iterator to the next batch, parsing it. Iterating again after a pause
+    ///         resumes the parsing.
+    ///
+    /// \return  Iterator to the next batch, end() at the end of the text.
+    const_iterator begin() { return const_iterator((parseNextBatch() == true) ? this : nullptr); }
+
+    /// \brief  Return the past-the-end iterator.
+    const_iterator end() { return const_iterator(nullptr); }
+
+    // Accessors ===================================================================================
+
+    /// \brief  Return the current batch: the vertices, faces and groups parsed by the last
+    ///         parseNextBatch(), and the materials of the text parsed so far.
+    const ObjDatabase& getBatch() const { return m_parser.m_objDB; }
+
+    /// \brief  Return the index in the text of the current batch's first vertex of a type.
+    size_t getFirstVertexIndex(const ElementType vtxType = ElementType::VERTEX) const
+    {
+        return m_parser.m_pulledVerticesCounts[static_cast<size_t>(vtxType)];
+    }
+
+    /// \brief  Return the index in the text of the current batch's first face.
+    size_t getFirstFaceIndex() const { return m_pulledFacesCount; }
+
+private:
+    // Members =====================================================================================
+
+    ObjFileParser m_parser;                          ///< Parser of the elements, holding the batch.
+    std::unique_ptr<ObjStreamReader> m_pFileReader;  ///< Reader of the Obj file, or nullptr.
+    ObjUtils::LineReader m_lineReader;               ///< Reader of the text's lines.
+    const size_t m_batchSize;                        ///< Count of entities ending a batch.
+
+    std::vector<ObjEntityGroup> m_activeGroups;  ///< Groups active at the end of the batch.
+    size_t m_pulledFacesCount = 0;               ///< Count of faces of the previous batches.
+    bool m_isTextEnd = false;                    ///< Whether the text was read to its end.
+};
+
+#endif /* OBJLAZYPARSER_H_ */
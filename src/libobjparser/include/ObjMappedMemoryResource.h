@@ -0,0 +1,106 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ObjMappedMemoryResource.h
+///
+/// \brief     Memory resource holding the large buffers in memory-mapped temporary files, to parse
+///            Obj files larger than the memory.
+/// \details   Allocations are served from the heap up to the resident-memory budget. Beyond it,
+///            each allocation is a shared mapping of its own temporary file, deleted as soon as
+///            created: the kernel writes its pages back to the file and evicts them instead of
+///            swapping. When the mapped memory exceeds the budget, a new mapping releases the
+///            resident pages of the others. Where mmap is missing, all of the allocations are
+///            served from the heap.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef OBJMAPPEDMEMORYRESOURCE_H_
+#define OBJMAPPEDMEMORYRESOURCE_H_
+
+#include <filesystem>
+#include <memory_resource>
+#include <mutex>
+#include <unordered_map>
+
+/// \brief Memory resource of memory-mapped temporary files.
+class ObjMappedMemoryResource final : public std::pmr::memory_resource
+{
+public:
+    /// \brief  Constructor.
+    ///
+    /// \param  residentBudget Bytes served from the heap before mapping files.
+    /// \param  tempDirectory Directory of the temporary files.
+    explicit ObjMappedMemoryResource(
+        const size_t residentBudget,
+        std::filesystem::path tempDirectory = std::filesystem::temp_directory_path());
+
+    /// \brief  Destructor. All of the allocations must have been released.
+    ~ObjMappedMemoryResource() override;
+
+    /// \brief  Deleted copy ctor, the allocations belong to one resource.
+    ObjMappedMemoryResource(const ObjMappedMemoryResource&) = delete;
+
+    /// \brief  Deleted assignment operator, the allocations belong to one resource.
+    ObjMappedMemoryResource& operator=(const ObjMappedMemoryResource&) = delete;
+
+    /// \brief  Release the resident pages of the mapped allocations. Their content stays in the
+    ///         files and is read back on access.
+    void releaseResidentPages();
+
+    // Accessors ===================================================================================
+
+    size_t getResidentBudget() const { return m_residentBudget; }
+    size_t getHeapBytesCount() const;
+    size_t getMappedBytesCount() const;
+    size_t getPeakMappedBytesCount() const;
+    size_t getMappingsCount() const;
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return (this == &other);
+    }
+
+    /// \brief  Map a new temporary file.
+    ///
+    /// \param  bytes Size of the allocation.
+    /// \return Address of the mapping.
+    void* mapFile(const size_t bytes);
+
+    /// \brief  Release the resident pages of the mapped allocations, the lock being held.
+    void releaseResidentPagesLocked();
+
+    // Members =====================================================================================
+
+    const size_t m_residentBudget;                ///< Bytes served from the heap before mapping.
+    const std::filesystem::path m_tempDirectory;  ///< Directory of the temporary files.
+
+    mutable std::mutex m_mutex;    ///< Guards the counters and the mappings.
+    size_t m_heapBytes = 0;        ///< Bytes served from the heap.
+    size_t m_mappedBytes = 0;      ///< Bytes of the mappings, rounded to pages.
+    size_t m_peakMappedBytes = 0;  ///< Highest count of bytes mapped at once.
+
+    std::unordered_map<void*, size_t> m_mappings;  ///< Sizes of the mappings by address.
+};
+
+#endif /* OBJMAPPEDMEMORYRESOURCE_H_ */
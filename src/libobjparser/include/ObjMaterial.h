@@ -22,7 +22,9 @@
 
 /// \file      ObjMaterial.h
 ///
-/// \brief     <brief description>
+/// \brief     Wavefront Mtl material and material library.
+/// \details   A material library is the compact table of the materials of one Mtl file. Materials
+///            names are interned in the library, so they are stored once and never reallocated.
 ///
 /// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
 /// \date      22-05-2019
@@ -32,23 +34,204 @@
 
 #include "Types.h"
 
+#include <array>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <optional>
+
+/// \brief Material of a Wavefront Mtl file.
 class ObjMaterial
 {
 public:
-private:
+    /// \brief Texture maps types.
+    enum class TextureMapType : uint8_t
+    {
+        AMBIENT = 0,        ///< map_Ka
+        DIFFUSE,            ///< map_Kd
+        SPECULAR,           ///< map_Ks
+        EMISSIVE,           ///< map_Ke
+        SPECULAR_EXPONENT,  ///< map_Ns
+        DISSOLVE,           ///< map_d
+        BUMP,               ///< map_bump, bump
+        DISPLACEMENT,       ///< disp
+        DECAL,              ///< decal
+        REFLECTION,         ///< refl
+        COUNT
+    };
+
+    /// \brief Color and illumination statements. Defaults are the Mtl specification's ones.
     struct ColorAndIllumination
     {
+        RGB m_ambient = {0.2f, 0.2f, 0.2f};             ///< Ka
+        RGB m_diffuse = {0.8f, 0.8f, 0.8f};             ///< Kd
+        RGB m_specular = {1.0f, 1.0f, 1.0f};            ///< Ks
+        RGB m_emissive = {0.0f, 0.0f, 0.0f};            ///< Ke
+        RGB m_transmissionFilter = {1.0f, 1.0f, 1.0f};  ///< Tf
+        float m_specularExponent = 0.0f;                ///< Ns
+        float m_dissolve = 1.0f;                        ///< d, 1 is fully opaque.
+        float m_sharpness = 60.0f;                      ///< sharpness
+        float m_opticalDensity = 1.0f;                  ///< Ni
+        uint8_t m_illuminationModel = 0;                ///< illum
     };
 
+    /// \brief Texture map statement.
     struct TextureMap
     {
+        std::string m_filePath;   ///< Texture file, as written in the Mtl file.
+        std::string m_options;    ///< Options (-o, -s, -bm...), as written in the Mtl file.
+        size_t m_textureIdx = 0;  ///< Index in the material library's textures table.
     };
 
-    struct ReflectionMap
+    /// \brief  Constructor.
+    ///
+    /// \param  name Interned name of the material, owned by its material library.
+    explicit ObjMaterial(std::string_view name) : m_name(name) {}
+
+    /// \brief  Set a texture map.
+    ///
+    /// \param  mapType Type of the texture map.
+    /// \param  textureMap Texture map.
+    void setTextureMap(const TextureMapType mapType, TextureMap textureMap)
+    {
+        m_textureMaps[static_cast<size_t>(mapType)] = std::move(textureMap);
+    }
+
+    // Accessors ===================================================================================
+
+    std::string_view getName() const { return m_name; }
+    const ColorAndIllumination& getColors() const { return m_colors; }
+    ColorAndIllumination& getColors() { return m_colors; }
+
+    /// \brief  Return a texture map.
+    ///
+    /// \param  mapType Type of the texture map.
+    /// \return Texture map or std::nullopt if the material has none of this type.
+    std::optional<std::reference_wrapper<const TextureMap>>
+    getTextureMap(const TextureMapType mapType) const
+    {
+        const TextureMap& textureMap = m_textureMaps[static_cast<size_t>(mapType)];
+        if (textureMap.m_filePath.empty() == true)
+        {
+            return std::nullopt;
+        }
+
+        return textureMap;
+    }
+
+private:
+    // Members =====================================================================================
+
+    std::string_view m_name;        ///< Interned name.
+    ColorAndIllumination m_colors;  ///< Color and illumination statements.
+
+    /// Texture maps, indexed by type.
+    std::array<TextureMap, static_cast<size_t>(TextureMapType::COUNT)> m_textureMaps;
+};
+
+/* ============================================================================================== */
+
+/// \brief Materials of one Mtl file.
+class ObjMaterialLibrary
+{
+public:
+    /// \brief Texture file referenced by the materials, resolved on disk.
+    struct TextureReference
     {
+        std::filesystem::path m_canonicalPath;  ///< Resolved path.
+        bool m_exists = false;                  ///< Is the texture a regular file?
+        uintmax_t m_fileSize = 0;               ///< Size of the texture file in bytes.
     };
 
-    std::string m_name;
+    /// \brief  Constructor.
+    ///
+    /// \param  mtlFilePath Path to the Mtl file.
+    explicit ObjMaterialLibrary(std::filesystem::path mtlFilePath = {}) :
+        m_mtlFilePath(std::move(mtlFilePath))
+    {
+    }
+
+    /// \brief  Deleted copy ctor, the materials view the interned names of their library.
+    ObjMaterialLibrary(const ObjMaterialLibrary&) = delete;
+
+    /// \brief  Default move ctor. The interned names are not moved in memory.
+    ObjMaterialLibrary(ObjMaterialLibrary&&) = default;
+
+    /// \brief  Deleted assignment operator.
+    ObjMaterialLibrary& operator=(const ObjMaterialLibrary&) = delete;
+
+    /// \brief  Default move assignment operator.
+    ObjMaterialLibrary& operator=(ObjMaterialLibrary&&) = default;
+
+    /// \brief  Insert a new material, or return the existing one with the same name.
+    ///
+    /// \param  name Name of the material.
+    /// \return Reference to the material, valid until the next insertion.
+    ObjMaterial& insertMaterial(std::string_view name);
+
+    /// \brief  Insert a texture file referenced by a texture map, or return the index of the
+    ///         existing one.
+    ///
+    /// \param  filePath Texture file, as written in the Mtl file.
+    /// \return Index of the texture in the textures table.
+    size_t insertTexture(std::string_view filePath);
+
+    /// \brief  Start resolving the textures on a background thread. Relative files are searched
+    ///         from the Mtl file's directory, then absolute paths of other machines by file name.
+    void resolveTextures();
+
+    /// \brief  Return a resolved texture, waiting for the resolution if it is still running.
+    ///
+    /// \param  textureIdx Index of the texture in the textures table.
+    /// \return Resolved texture.
+    const TextureReference& getTextureReference(const size_t textureIdx) const
+    {
+        return m_texturesReferences.get()[textureIdx];
+    }
+
+    /// \brief  Find a material by name.
+    ///
+    /// \param  name Name of the material.
+    /// \return Reference to the material or std::nullopt.
+    std::optional<std::reference_wrapper<const ObjMaterial>>
+    findMaterial(std::string_view name) const;
+
+    // Accessors ===================================================================================
+
+    const ObjMaterial& getMaterial(const size_t materialIdx) const
+    {
+        return m_materials[materialIdx];
+    }
+    size_t getMaterialsCount() const { return m_materials.size(); }
+    bool isEmpty() const { return m_materials.empty(); }
+    const std::filesystem::path& getFilePath() const { return m_mtlFilePath; }
+    size_t getTexturesCount() const { return m_texturesFiles.size(); }
+    const std::string& getTextureFile(const size_t textureIdx) const
+    {
+        return m_texturesFiles[textureIdx];
+    }
+
+    auto cbegin() const noexcept { return m_materials.cbegin(); }
+    auto cend() const noexcept { return m_materials.cend(); }
+
+private:
+    // Members =====================================================================================
+
+    std::filesystem::path m_mtlFilePath;   ///< Path to the Mtl file.
+    std::deque<std::string> m_namesPool;   ///< Interned names, never moved when the pool grows.
+    std::vector<ObjMaterial> m_materials;  ///< Materials, in the Mtl file's order.
+
+    /// Materials' indices by name.
+    std::unordered_map<std::string_view, size_t> m_materialsIndices;
+
+    std::vector<std::string> m_texturesFiles;  ///< Textures files, as written in the Mtl file.
+
+    /// Textures' indices by file.
+    std::unordered_map<std::string, size_t> m_texturesIndices;
+
+    /// Resolved textures, parallel to m_texturesFiles. Ready once the resolution ended.
+    std::shared_future<std::vector<TextureReference>> m_texturesReferences;
 };
 
 #endif /* OBJMATERIAL_H_ */
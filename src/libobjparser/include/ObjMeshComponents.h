@@ -0,0 +1,91 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ObjMeshComponents.h
+///
+/// \brief     Connected components (islands) of an Obj database's faces.
+/// \details   Faces sharing a geometric vertex belong to the same component. Components are
+///            labeled with a parallel union-find and can be turned into synthetic groups or
+///            extracted as independent Obj databases.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef OBJMESHCOMPONENTS_H_
+#define OBJMESHCOMPONENTS_H_
+
+#include "Types.h"
+
+#include <limits>
+#include <string_view>
+#include <vector>
+
+class ObjDatabase;
+
+/// \brief Connected components of an Obj database's faces.
+class ObjMeshComponents
+{
+public:
+    /// Label of the faces belonging to no component (faces with invalid vertices indices).
+    static constexpr uint32_t INVALID_COMPONENT = std::numeric_limits<uint32_t>::max();
+
+    /// \brief  Constructor. Labels the connected components of all the faces of an Obj database.
+    ///
+    /// \param  objDB Obj database.
+    explicit ObjMeshComponents(const ObjDatabase& objDB);
+
+    /// \brief  Insert one group (g) per component in the Obj database the components were
+    ///         labeled from. Each group includes the faces of its component.
+    ///
+    /// \param  objDB Obj database the components were labeled from.
+    /// \param  namePrefix Prefix of the groups' names, followed by the component's index.
+    /// \return IDs of the inserted groups, indexed by component.
+    std::vector<size_t> createComponentsGroups(ObjDatabase& objDB,
+                                               std::string_view namePrefix = "component_") const;
+
+    /// \brief  Split the Obj database in one independent Obj database per component.
+    ///
+    /// \param  objDB Obj database the components were labeled from.
+    /// \return Obj databases, indexed by component.
+    std::vector<ObjDatabase> splitComponents(const ObjDatabase& objDB) const;
+
+    // Accessors ===================================================================================
+
+    size_t getComponentsCount() const { return m_componentFacesCount.size(); }
+    uint32_t getFaceComponent(const size_t faceIdx) const { return m_faceComponent[faceIdx]; }
+    size_t getComponentFacesCount(const size_t compIdx) const
+    {
+        return m_componentFacesCount[compIdx];
+    }
+    const std::vector<uint32_t>& getFacesComponents() const { return m_faceComponent; }
+
+private:
+    /// \brief  Return the faces indices sorted by component, and the first face of each component.
+    ///
+    /// \return Pair of the sorted faces indices and the components' offsets in it (+ end marker).
+    std::pair<std::vector<uint32_t>, std::vector<size_t>> getFacesByComponent() const;
+
+    // Members =====================================================================================
+
+    std::vector<uint32_t> m_faceComponent;      ///< Component of each face.
+    std::vector<size_t> m_componentFacesCount;  ///< Count of faces of each component.
+};
+
+#endif /* OBJMESHCOMPONENTS_H_ */
@@ -0,0 +1,112 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ObjQuantizedVertices.h
+///
+/// \brief     Compressed storage of an Obj database's vertices attributes.
+/// \details   Geometric vertices are stored as 16-bit unsigned values relative to their bounding
+///            box, texture vertices as 16-bit unsigned values relative to their bounds and
+///            normals as octahedral-encoded pairs of 16-bit signed values. The encoded arrays are
+///            laid out like GPU vertex formats (RGB16_UNORM, RG16_UNORM and RG16_SNORM) and are
+///            decoded on demand. ObjDatabase::quantizeVertices() replaces the database's float
+///            vertices with them. The weights (w) and the third texture coordinate are dropped.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef OBJQUANTIZEDVERTICES_H_
+#define OBJQUANTIZEDVERTICES_H_
+
+#include "Types.h"
+
+#include <array>
+#include <vector>
+
+class ObjDatabase;
+
+/// \brief Quantized vertices attributes of an Obj database.
+class ObjQuantizedVertices
+{
+public:
+    /// \brief  Constructor. Quantizes the geometric vertices, texture vertices and normals.
+    ///
+    /// \param  objDB Obj database whose vertices are stored as floats.
+    explicit ObjQuantizedVertices(const ObjDatabase& objDB);
+
+    /// \brief  Decode a range of geometric vertices.
+    ///
+    /// \param  first Index of the first vertex to decode.
+    /// \param  count Count of vertices to decode.
+    /// \param  pXYZ Output buffer of count * 3 floats.
+    void decodePositions(const size_t first, const size_t count, float* pXYZ) const;
+
+    /// \brief  Decode a range of texture vertices.
+    ///
+    /// \param  first Index of the first texture vertex to decode.
+    /// \param  count Count of texture vertices to decode.
+    /// \param  pUV Output buffer of count * 2 floats.
+    void decodeTexCoords(const size_t first, const size_t count, float* pUV) const;
+
+    /// \brief  Decode a range of normals.
+    ///
+    /// \param  first Index of the first normal to decode.
+    /// \param  count Count of normals to decode.
+    /// \param  pXYZ Output buffer of count * 3 floats, unit length vectors.
+    void decodeNormals(const size_t first, const size_t count, float* pXYZ) const;
+
+    // Accessors ===================================================================================
+
+    size_t getPositionsCount() const { return m_positions.size() / 3; }
+    size_t getTexCoordsCount() const { return m_texCoords.size() / 2; }
+    size_t getNormalsCount() const { return m_normals.size() / 2; }
+
+    /// \brief  Return the encoded geometric vertices: 3 values per vertex.
+    const std::vector<uint16_t>& getEncodedPositions() const { return m_positions; }
+    /// \brief  Return the encoded texture vertices: 2 values per texture vertex.
+    const std::vector<uint16_t>& getEncodedTexCoords() const { return m_texCoords; }
+    /// \brief  Return the encoded normals: 2 values per normal.
+    const std::vector<int16_t>& getEncodedNormals() const { return m_normals; }
+
+    /// \brief  Decoding parameters: value = encoded * scale + offset.
+    const std::array<float, 3>& getPositionsScale() const { return m_positionsScale; }
+    const std::array<float, 3>& getPositionsOffset() const { return m_positionsOffset; }
+    const std::array<float, 2>& getTexCoordsScale() const { return m_texCoordsScale; }
+    const std::array<float, 2>& getTexCoordsOffset() const { return m_texCoordsOffset; }
+
+    /// \brief  Return the size in bytes of the encoded arrays.
+    size_t getMemorySize() const
+    {
+        return (m_positions.size() + m_texCoords.size() + m_normals.size()) * sizeof(uint16_t);
+    }
+
+private:
+    // Members =====================================================================================
+
+    std::vector<uint16_t> m_positions;  ///< Geometric vertices, 3 x unorm16 each.
+    std::vector<uint16_t> m_texCoords;  ///< Texture vertices, 2 x unorm16 each.
+    std::vector<int16_t> m_normals;     ///< Octahedral normals, 2 x snorm16 each.
+
+    std::array<float, 3> m_positionsScale = {0.0f, 0.0f, 0.0f};   ///< Bounding box extent / 65535.
+    std::array<float, 3> m_positionsOffset = {0.0f, 0.0f, 0.0f};  ///< Bounding box minimum.
+    std::array<float, 2> m_texCoordsScale = {0.0f, 0.0f};         ///< Bounds extent / 65535.
+    std::array<float, 2> m_texCoordsOffset = {0.0f, 0.0f};        ///< Bounds minimum.
+};
+
+#endif /* OBJQUANTIZEDVERTICES_H_ */
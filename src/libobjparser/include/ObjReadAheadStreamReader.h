@@ -0,0 +1,96 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ObjReadAheadStreamReader.h
+///
+/// \brief     Reader keeping several large blocks of an Obj file in flight while the parser reads
+///            the previous ones.
+/// \details   On Linux the blocks are read asynchronously with io_uring, set up with the raw
+///            system calls. Where io_uring is missing or forbidden, a thread reads the blocks
+///            ahead into a bounded ring, as the compressed files are decompressed.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef OBJREADAHEADSTREAMREADER_H_
+#define OBJREADAHEADSTREAMREADER_H_
+
+#include "ObjCompressedStreamReader.h"
+
+#include <filesystem>
+#include <memory>
+
+/// \brief Read-ahead reader of an Obj file.
+class ObjReadAheadStreamReader final : public ObjStreamReader
+{
+public:
+    /// \brief Way the blocks are read ahead.
+    enum class Backend : uint8_t
+    {
+        IO_URING = 0,  ///< Asynchronous reads submitted to the kernel.
+        READ_THREAD    ///< Reads of a thread of the reader.
+    };
+
+    /// \brief  Constructor. Submits the reads of the first blocks.
+    ///
+    /// \param  filePath Path to the file.
+    /// \param  blockSize Size of the blocks.
+    /// \param  blocksCount Count of blocks in flight, at least 2.
+    /// \param  backend Preferred backend, io_uring falls back to the read thread if unavailable.
+    explicit ObjReadAheadStreamReader(const std::filesystem::path& filePath,
+                                      const size_t blockSize = 1024 * 1024,
+                                      const size_t blocksCount = 4,
+                                      const Backend backend = Backend::IO_URING);
+
+    /// \brief  Destructor. Waits for the reads in flight.
+    ~ObjReadAheadStreamReader() override;
+
+    /// \brief  Deleted copy ctor, the kernel writes into the reader's blocks.
+    ObjReadAheadStreamReader(const ObjReadAheadStreamReader&) = delete;
+
+    /// \brief  Deleted assignment operator, the kernel writes into the reader's blocks.
+    ObjReadAheadStreamReader& operator=(const ObjReadAheadStreamReader&) = delete;
+
+    size_t read(char* pBuffer, const size_t size) override;
+
+    // Accessors ===================================================================================
+
+    Backend getBackend() const
+    {
+        return (m_pIoUring != nullptr) ? Backend::IO_URING : Backend::READ_THREAD;
+    }
+
+    /// \brief  Return true if the file could not be opened or read to its end. The text read so
+    ///         far is valid.
+    bool hasFailed() const override;
+
+private:
+    /// io_uring instance and its blocks, defined where io_uring is available.
+    struct IoUring;
+
+    // Members =====================================================================================
+
+    std::unique_ptr<IoUring> m_pIoUring;  ///< io_uring backend, or nullptr.
+
+    /// Read thread backend, or nullptr.
+    std::unique_ptr<ObjCompressedStreamReader> m_pReadThread;
+};
+
+#endif /* OBJREADAHEADSTREAMREADER_H_ */
@@ -0,0 +1,136 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ObjRenderMesh.h
+///
+/// \brief     Triangulated and welded vertex/index buffers of an Obj database, ready for GPUs and
+///            for the binary exporters.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef OBJRENDERMESH_H_
+#define OBJRENDERMESH_H_
+
+#include "Types.h"
+
+#include <array>
+#include <optional>
+#include <string>
+#include <vector>
+
+class ObjDatabase;
+
+/// \brief Triangulated and welded buffers of an Obj database.
+/// \details Each distinct (v, vt, vn) triplet referenced by the faces becomes one render vertex.
+///          Polygons are triangulated as fans. Triangles are sorted by material then by group
+///          (g): each material is one contiguous range of the index buffer, split in one sub-mesh
+///          (draw command) per group.
+class ObjRenderMesh
+{
+public:
+    /// \brief Contiguous range of triangles sharing the same material and group.
+    struct SubMesh
+    {
+        std::string m_name;                          ///< Name of the group.
+        MaterialID_t m_materialID = NO_MATERIAL_ID;  ///< Material of the Obj database.
+        size_t m_firstIndex = 0;                     ///< First index in the index buffer.
+        size_t m_indicesCount = 0;                   ///< Count of indices (3 per triangle).
+    };
+
+    /// \brief Contiguous range of triangles sharing the same material.
+    struct MaterialRange
+    {
+        MaterialID_t m_materialID = NO_MATERIAL_ID;  ///< Material of the Obj database.
+        std::string m_materialName;                  ///< Name of the material, empty if none.
+        size_t m_firstIndex = 0;                     ///< First index in the index buffer.
+        size_t m_indicesCount = 0;                   ///< Count of indices (3 per triangle).
+        size_t m_firstSubMesh = 0;                   ///< First sub-mesh of the material.
+        size_t m_subMeshesCount = 0;                 ///< Count of sub-meshes of the material.
+    };
+
+    /// \brief Render vertices' attributes of a quantized Obj database, in the formats of
+    ///        ObjQuantizedVertices: RGB16_UNORM positions, RG16_UNORM texture coordinates and
+    ///        octahedral RG16_SNORM normals. value = encoded * scale + offset.
+    struct QuantizedAttributes
+    {
+        std::vector<uint16_t> m_positions;  ///< 3 values per render vertex.
+        std::vector<uint16_t> m_texCoords;  ///< 2 values per render vertex, or empty.
+        std::vector<int16_t> m_normals;     ///< 2 values per render vertex, or empty.
+
+        std::array<float, 3> m_positionsScale = {0.0f, 0.0f, 0.0f};   ///< Positions' scale.
+        std::array<float, 3> m_positionsOffset = {0.0f, 0.0f, 0.0f};  ///< Positions' offset.
+        std::array<float, 2> m_texCoordsScale = {0.0f, 0.0f};         ///< Coordinates' scale.
+        std::array<float, 2> m_texCoordsOffset = {0.0f, 0.0f};        ///< Coordinates' offset.
+    };
+
+    /// \brief  Constructor. Triangulates and welds all the faces of an Obj database. The vertices
+    ///         of a quantized database are decoded, their encoded attributes are kept as well.
+    ///
+    /// \param  objDB Obj database.
+    explicit ObjRenderMesh(const ObjDatabase& objDB);
+
+    // Accessors ===================================================================================
+
+    size_t getVerticesCount() const { return m_positions.size() / 3; }
+    size_t getTrianglesCount() const { return m_indices.size() / 3; }
+    bool hasNormals() const { return (m_normals.empty() == false); }
+    bool hasTexCoords() const { return (m_texCoords.empty() == false); }
+
+    /// \brief  Return the positions: 3 floats per render vertex.
+    const std::vector<float>& getPositions() const { return m_positions; }
+    /// \brief  Return the normals: 3 floats per render vertex, empty if no face has normals.
+    const std::vector<float>& getNormals() const { return m_normals; }
+    /// \brief  Return the texture coordinates: 2 floats per render vertex, empty if no face has
+    ///         texture vertices.
+    const std::vector<float>& getTexCoords() const { return m_texCoords; }
+    /// \brief  Return the triangles' render vertices indices.
+    const std::vector<uint32_t>& getIndices() const { return m_indices; }
+    const std::vector<SubMesh>& getSubMeshes() const { return m_subMeshes; }
+    const std::vector<MaterialRange>& getMaterialsRanges() const { return m_materialsRanges; }
+
+    /// \brief  Return the encoded attributes, std::nullopt if the database is not quantized.
+    const std::optional<QuantizedAttributes>& getQuantizedAttributes() const
+    {
+        return m_quantizedAttributes;
+    }
+
+    const std::array<float, 3>& getBoundsMin() const { return m_boundsMin; }
+    const std::array<float, 3>& getBoundsMax() const { return m_boundsMax; }
+
+private:
+    // Members =====================================================================================
+
+    std::vector<float> m_positions;    ///< Render vertices' positions.
+    std::vector<float> m_normals;      ///< Render vertices' normals.
+    std::vector<float> m_texCoords;    ///< Render vertices' texture coordinates.
+    std::vector<uint32_t> m_indices;   ///< Triangles' indices.
+    std::vector<SubMesh> m_subMeshes;  ///< Index buffer ranges per material and group.
+
+    std::vector<MaterialRange> m_materialsRanges;  ///< Index buffer ranges per material.
+
+    /// Encoded attributes of the render vertices of a quantized database.
+    std::optional<QuantizedAttributes> m_quantizedAttributes;
+
+    std::array<float, 3> m_boundsMin = {0.0f, 0.0f, 0.0f};  ///< Positions' bounding box minimum.
+    std::array<float, 3> m_boundsMax = {0.0f, 0.0f, 0.0f};  ///< Positions' bounding box maximum.
+};
+
+#endif /* OBJRENDERMESH_H_ */
@@ -0,0 +1,280 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ObjSharedDatabase.h
+///
+/// \brief     Obj database published in a named POSIX shared-memory segment, and attached
+///            read-only by other processes without parsing nor copying.
+/// \details   The segment holds plain records addressed by offsets from its start, so that it is
+///            valid wherever each process maps it: the vertices, index buffer, faces, groups and
+///            their entities ranges, the entities table, and the materials names and libraries.
+///            The materials definitions are not published, their libraries are small enough to be
+///            parsed by each process.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef OBJSHAREDDATABASE_H_
+#define OBJSHAREDDATABASE_H_
+
+#include "Types.h"
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+class ObjDatabase;
+
+/// \brief Read-only view of an Obj database published in shared memory.
+class ObjSharedDatabase
+{
+public:
+    /// \brief Vertex, of any type.
+    struct Vertex
+    {
+        float m_x;  ///< x, u or ni.
+        float m_y;  ///< y, v or nj.
+        float m_z;  ///< z, w or nk.
+        float m_w;  ///< Weight for rational curves and surfaces.
+    };
+
+    /// \brief String of the segment: location in its characters.
+    struct String
+    {
+        uint64_t m_offset;  ///< Offset of the first character.
+        uint64_t m_size;    ///< Count of characters.
+    };
+
+    /// \brief Face.
+    struct Face
+    {
+        uint64_t m_firstIdx;                            ///< First index in the index buffer.
+        uint64_t m_lastIdx;                             ///< Last index in the index buffer.
+        MaterialID_t m_materialID;                      ///< Material, NO_MATERIAL_ID if none.
+        VerticesIdxOrganization m_eVtxIdxOrganization;  ///< Describes how indices are organized.
+        bool m_isTriangle;                              ///< Is this face a triangle?
+    };
+
+    /// \brief Group (g/o/s/mg).
+    struct Group
+    {
+        uint64_t m_ID;           ///< Entity ID.
+        uint64_t m_number;       ///< Number of the group (s/mg).
+        String m_name;           ///< Name of the group (g/o).
+        uint64_t m_firstRange;   ///< First range of included entities.
+        uint64_t m_rangesCount;  ///< Count of ranges of included entities.
+        uint32_t m_resolution;   ///< Merging resolution (mg).
+        ElementType m_type;      ///< Group type.
+    };
+
+    /// \brief Range of entities included in a group, [first, last] in the entities table.
+    struct EntitiesRange
+    {
+        uint64_t m_first;  ///< First entity.
+        uint64_t m_last;   ///< Last entity.
+    };
+
+    /// \brief Location of an entity: entity's type + index in the records of its type.
+    struct EntityLocation
+    {
+        uint64_t m_index;    ///< Index in the records of the type.
+        ElementType m_type;  ///< Type of the entity.
+    };
+
+    /// \brief  Publish an Obj database, replacing the segment of the same name. The processes
+    ///         attached to a replaced segment keep reading it until they detach.
+    ///
+    /// \param  objDB Database to publish.
+    /// \param  segmentName Name of the segment, a leading '/' is added if missing.
+    /// \return true if the database was published.
+    static bool publish(const ObjDatabase& objDB, const std::string& segmentName);
+
+    /// \brief  Attach a published Obj database.
+    ///
+    /// \param  segmentName Name of the segment.
+    /// \return The database, or std::nullopt if no complete database is published by that name.
+    static std::optional<ObjSharedDatabase> attach(const std::string& segmentName);
+
+    /// \brief  Remove the name of a segment. The segment lives until its last process detaches.
+    ///
+    /// \param  segmentName Name of the segment.
+    /// \return true if the segment existed.
+    static bool unpublish(const std::string& segmentName);
+
+    /// \brief  Return a vertex based on its type and index.
+    ///
+    /// \param  type Type of the vertex.
+    /// \param  idx Index of the vertex.
+    /// \return Reference to the vertex or std::nullopt.
+    std::optional<std::reference_wrapper<const Vertex>> getVertex(const ElementType type,
+                                                                  const size_t idx) const;
+
+    /// \brief  Return a pair of pointers to the first and past the last vertices indices.
+    ///
+    /// \param  face Concerned face.
+    /// \return Pair of pointers in the index buffer.
+    std::pair<const uint64_t*, const uint64_t*> getVerticesIterators(const Face& face) const
+    {
+        return std::make_pair(m_indices.m_pData + face.m_firstIdx,
+                              m_indices.m_pData + face.m_lastIdx + 1);
+    }
+
+    /// \brief  Return a pair of pointers to the first and past the last entities ranges of a
+    ///         group.
+    ///
+    /// \param  group Concerned group.
+    /// \return Pair of pointers to the ranges.
+    std::pair<const EntitiesRange*, const EntitiesRange*>
+    getEntitiesRanges(const Group& group) const
+    {
+        return std::make_pair(m_entitiesRanges.m_pData + group.m_firstRange,
+                              m_entitiesRanges.m_pData + group.m_firstRange + group.m_rangesCount);
+    }
+
+    /// \brief  Return a string of the segment.
+    ///
+    /// \param  str Location of the string.
+    /// \return The string, empty if out of the segment.
+    std::string_view getString(const String& str) const;
+
+    /// \brief  Return the name of a material.
+    ///
+    /// \param  materialID ID of the material.
+    /// \return Name of the material, empty for NO_MATERIAL_ID.
+    std::string_view getMaterialName(const MaterialID_t materialID) const
+    {
+        return (materialID < m_materialsNames.m_count) ? getString(m_materialsNames[materialID])
+                                                       : std::string_view();
+    }
+
+    /// \brief  Return a material library referenced by a mtllib statement.
+    ///
+    /// \param  idx Index of the library, in the Obj file's order.
+    /// \return Library file as written in the Obj file.
+    std::string_view getMaterialLibraryRef(const size_t idx) const
+    {
+        return (idx < m_materialLibrariesRefs.m_count) ? getString(m_materialLibrariesRefs[idx])
+                                                       : std::string_view();
+    }
+
+    // Iterators functions
+    // =========================================================================
+
+    template<const ElementType type>
+    constexpr auto begin() const noexcept
+    {
+        return getArrayForType<type>().m_pData;
+    }
+    template<const ElementType type>
+    constexpr auto end() const noexcept
+    {
+        const auto& records = getArrayForType<type>();
+        return records.m_pData + records.m_count;
+    }
+
+    // Accessors ===================================================================================
+
+    size_t getGroupsCount() const { return m_groups.m_count; }
+    size_t getIndexBufferCount() const { return m_indices.m_count; }
+    size_t getVerticesCount(const ElementType type = ElementType::VERTEX) const;
+    size_t getFacesCount() const { return m_faces.m_count; }
+    size_t getEntitiesCount() const { return m_entities.m_count; }
+    size_t getMaterialsCount() const { return m_materialsNames.m_count; }
+    size_t getMaterialLibrariesCount() const { return m_materialLibrariesRefs.m_count; }
+    size_t getSegmentSize() const { return m_segmentSize; }
+
+private:
+    /// \brief Records of one type in the segment.
+    template<typename T>
+    struct Array
+    {
+        const T& operator[](const size_t idx) const { return m_pData[idx]; }
+
+        const T* m_pData = nullptr;  ///< First record.
+        size_t m_count = 0;          ///< Count of records.
+    };
+
+    /// \brief  Constructor, from a validated segment.
+    ///
+    /// \param  spSegment Mapping of the segment, unmapped with its last view.
+    /// \param  segmentSize Size of the segment.
+    ObjSharedDatabase(std::shared_ptr<const std::byte> spSegment, const size_t segmentSize);
+
+    /// \brief  Get the records of the provided element's type.
+    ///
+    /// \return  Records.
+    template<const ElementType type>
+    constexpr const auto& getArrayForType() const
+    {
+        if constexpr (type == ElementType::VERTEX)
+        {
+            return m_vertices[0];
+        }
+        else if constexpr (type == ElementType::VERTEX_TEXTURE)
+        {
+            return m_vertices[1];
+        }
+        else if constexpr (type == ElementType::VERTEX_NORMAL)
+        {
+            return m_vertices[2];
+        }
+        else if constexpr (type == ElementType::VERTEX_PARAM_SPACE)
+        {
+            return m_vertices[3];
+        }
+        else if constexpr (type == ElementType::FACE)
+        {
+            return m_faces;
+        }
+        else if constexpr ((type == ElementType::GROUP_NAME) ||
+                           (type == ElementType::SMOOTHING_GROUP) ||
+                           (type == ElementType::MERGING_GROUP) ||
+                           (type == ElementType::OBJECT_NAME))
+        {
+            // All groups types share the same records.
+            return m_groups;
+        }
+        else
+        {
+            return m_entities;
+        }
+    }
+
+    // Members =====================================================================================
+
+    std::shared_ptr<const std::byte> m_spSegment;  ///< Mapping of the segment.
+    size_t m_segmentSize = 0;                      ///< Size of the segment.
+
+    std::array<Array<Vertex>, 4> m_vertices;  ///< v, vt, vn and vp.
+    Array<uint64_t> m_indices;                ///< Index buffer.
+    Array<Face> m_faces;                      ///< Faces.
+    Array<Group> m_groups;                    ///< Groups.
+    Array<EntitiesRange> m_entitiesRanges;    ///< Ranges of entities included in the groups.
+    Array<EntityLocation> m_entities;         ///< Locations of all of the entities.
+    Array<String> m_materialsNames;           ///< Materials names, indexed by material ID.
+    Array<String> m_materialLibrariesRefs;    ///< mtllib files, in the Obj file's order.
+    Array<char> m_chars;                      ///< Characters of the strings.
+};
+
+#endif /* OBJSHAREDDATABASE_H_ */
@@ -0,0 +1,107 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ObjStreamReader.h
+///
+/// \brief     Pull interface of the sources of the Obj and Mtl texts, and its file and memory
+///            implementations.
+/// \details   The parsers pull the text by blocks, a source of any length (network payload,
+///            decompression pipeline) can be parsed without being written to a file first.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef OBJSTREAMREADER_H_
+#define OBJSTREAMREADER_H_
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string_view>
+
+/// \brief Source of an Obj text, read by blocks.
+class ObjStreamReader
+{
+public:
+    virtual ~ObjStreamReader() = default;
+
+    /// \brief  Read the next block of the text.
+    ///
+    /// \param  pBuffer Destination of the read bytes.
+    /// \param  size Size of the destination.
+    /// \return Count of read bytes, 0 at the end of the text only.
+    virtual size_t read(char* pBuffer, const size_t size) = 0;
+
+    /// \brief  Return true if the text could not be read to its end. The text read so far is
+    ///         valid.
+    virtual bool hasFailed() const { return false; }
+};
+
+/* ============================================================================================== */
+
+/// \brief Reader of an opened file or pipe.
+class ObjFileStreamReader final : public ObjStreamReader
+{
+public:
+    /// \brief  Constructor.
+    ///
+    /// \param  pFile File to read, not owned.
+    explicit ObjFileStreamReader(std::FILE* pFile) : m_pFile(pFile) {}
+
+    size_t read(char* pBuffer, const size_t size) override
+    {
+        return std::fread(pBuffer, 1, size, m_pFile);
+    }
+
+    bool hasFailed() const override { return (std::ferror(m_pFile) != 0); }
+
+private:
+    // Members =====================================================================================
+
+    std::FILE* m_pFile;  ///< Read file.
+};
+
+/* ============================================================================================== */
+
+/// \brief Reader of a text held in memory.
+class ObjMemoryStreamReader final : public ObjStreamReader
+{
+public:
+    /// \brief  Constructor.
+    ///
+    /// \param  text Text to read, it must outlive the reader.
+    explicit ObjMemoryStreamReader(std::string_view text) : m_text(text) {}
+
+    size_t read(char* pBuffer, const size_t size) override
+    {
+        const size_t readSize = std::min(size, m_text.size());
+        std::memcpy(pBuffer, m_text.data(), readSize);
+        m_text.remove_prefix(readSize);
+
+        return readSize;
+    }
+
+private:
+    // Members =====================================================================================
+
+    std::string_view m_text;  ///< Text left to read.
+};
+
+#endif /* OBJSTREAMREADER_H_ */
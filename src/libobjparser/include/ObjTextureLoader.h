@@ -0,0 +1,110 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ObjTextureLoader.h
+///
+/// \brief     On demand background loading of the materials' textures.
+/// \details   The textures are read by a bounded pool of threads, started when the first texture
+///            is requested. The Obj parsing never waits for them. The files' bytes are returned
+///            as is: decoding the images is left to the renderer.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef OBJTEXTURELOADER_H_
+#define OBJTEXTURELOADER_H_
+
+#include "ObjMaterial.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/// \brief Bounded pool of threads loading textures.
+class ObjTextureLoader
+{
+public:
+    /// Bytes of a texture file, nullptr if it could not be read.
+    using TextureData_t = std::shared_ptr<const std::vector<uint8_t>>;
+
+    /// \brief  Constructor.
+    ///
+    /// \param  maxWorkersCount Maximum count of loading threads.
+    explicit ObjTextureLoader(const size_t maxWorkersCount = 2) :
+        m_maxWorkersCount(std::max<size_t>(maxWorkersCount, 1))
+    {
+    }
+
+    /// \brief  Destructor. Pending requests are dropped, their futures get nullptr.
+    ~ObjTextureLoader();
+
+    /// \brief  Deleted copy ctor, the workers use the loader.
+    ObjTextureLoader(const ObjTextureLoader&) = delete;
+
+    /// \brief  Deleted assignment operator, the workers use the loader.
+    ObjTextureLoader& operator=(const ObjTextureLoader&) = delete;
+
+    /// \brief  Request the loading of a texture. A texture is read once, later requests share it.
+    ///
+    /// \param  texture Resolved texture.
+    /// \return Future of the texture's bytes.
+    std::shared_future<TextureData_t>
+    requestTexture(const ObjMaterialLibrary::TextureReference& texture);
+
+private:
+    /// \brief Pending texture loading.
+    struct LoadRequest
+    {
+        std::string m_filePath;                 ///< Canonical path of the texture.
+        std::promise<TextureData_t> m_promise;  ///< Promise of the texture's bytes.
+    };
+
+    /// \brief  Loading thread: pops and reads the pending textures until the loader stops.
+    void runWorker();
+
+    /// \brief  Read a whole texture file.
+    ///
+    /// \param  filePath Path to the texture file.
+    /// \return Bytes of the file, nullptr if it could not be read.
+    static TextureData_t readTexture(const std::string& filePath);
+
+    // Members =====================================================================================
+
+    const size_t m_maxWorkersCount;  ///< Maximum count of loading threads.
+
+    std::mutex m_mutex;                  ///< Protects the members below.
+    std::condition_variable m_wakeUp;    ///< Signals new requests and the loader's stop.
+    std::deque<LoadRequest> m_requests;  ///< Pending requests, in the requests order.
+    std::vector<std::thread> m_workers;  ///< Loading threads.
+    size_t m_busyWorkersCount = 0;       ///< Count of threads reading a texture.
+    bool m_isStopping = false;           ///< Is the loader being destroyed?
+
+    /// Requested textures by canonical path.
+    std::unordered_map<std::string, std::shared_future<TextureData_t>> m_textures;
+};
+
+#endif /* OBJTEXTURELOADER_H_ */
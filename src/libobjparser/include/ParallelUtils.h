@@ -0,0 +1,231 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ParallelUtils.h
+///
+/// \brief     Parallel helpers. Splits work over the hardware threads for the database's
+///            post-processing operations.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef PARALLELUTILS_H_
+#define PARALLELUTILS_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace ObjUtils
+{
+/// \brief  Parallel helper functions.
+class ParallelUtils final
+{
+public:
+    /// \brief  This class is not to be instanciated.
+    ParallelUtils() = delete;
+
+    /// \brief  Return the count of workers to use for an amount of work.
+    ///
+    /// \param  workCount Amount of work items.
+    /// \param  minChunkSize Minimum amount of work items given to one worker.
+    /// \param  maxWorkersCount Maximum count of workers, the hardware threads count if 0.
+    /// \return Count of workers, at least 1.
+    static size_t getWorkersCount(const size_t workCount,
+                                  const size_t minChunkSize,
+                                  const size_t maxWorkersCount = 0)
+    {
+        const size_t hwThreadsCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        const size_t chunkSize = std::max<size_t>(minChunkSize, 1);
+        const size_t chunksCount = (workCount + chunkSize - 1) / chunkSize;
+
+        return std::clamp<size_t>(chunksCount,
+                                  1,
+                                  (maxWorkersCount == 0) ? hwThreadsCount : maxWorkersCount);
+    }
+
+    /// \brief  Split [0, count) in contiguous chunks and process them in parallel.
+    ///
+    /// \param  count Amount of work items.
+    /// \param  minChunkSize Minimum amount of work items given to one worker.
+    /// \param  func Callable invoked as func(chunkBegin, chunkEnd, workerIdx).
+    /// \param  maxWorkersCount Maximum count of workers, the hardware threads count if 0.
+    /// \return Count of workers used.
+    template<typename FuncT>
+    static size_t parallelFor(const size_t count,
+                              const size_t minChunkSize,
+                              FuncT&& func,
+                              const size_t maxWorkersCount = 0)
+    {
+        const size_t workersCount = getWorkersCount(count, minChunkSize, maxWorkersCount);
+        if (workersCount == 1)
+        {
+            func(size_t{0}, count, size_t{0});
+            return workersCount;
+        }
+
+        const size_t chunkSize = (count + workersCount - 1) / workersCount;
+
+        std::vector<std::future<void>> workers;
+        workers.reserve(workersCount - 1);
+
+        for (size_t workerIdx = 1; workerIdx < workersCount; ++workerIdx)
+        {
+            const size_t chunkBegin = std::min(workerIdx * chunkSize, count);
+            const size_t chunkEnd = std::min(chunkBegin + chunkSize, count);
+
+            workers.push_back(
+                std::async(std::launch::async, [&func, chunkBegin, chunkEnd, workerIdx]() {
+                    func(chunkBegin, chunkEnd, workerIdx);
+                }));
+        }
+
+        // The calling thread takes the first chunk.
+        func(size_t{0}, std::min(chunkSize, count), size_t{0});
+
+        for (std::future<void>& worker : workers)
+        {
+            worker.get();
+        }
+
+        return workersCount;
+    }
+
+    /// \brief  Stable counting sort in parallel: each worker counts the keys of its chunk, then
+    ///         scatters its chunk to the slots reserved after the previous workers' ones.
+    ///
+    /// \param  items Items to sort.
+    /// \param  sortedItems Sorted items, resized to the items' count.
+    /// \param  bucketsCount Count of distinct keys.
+    /// \param  getKey Callable returning the key of an item, in [0, bucketsCount).
+    /// \return Offsets of the buckets in the sorted items, bucketsCount + 1 entries.
+    template<typename ItemT, typename KeyFuncT>
+    static std::vector<size_t> parallelCountingSort(const std::vector<ItemT>& items,
+                                                    std::vector<ItemT>& sortedItems,
+                                                    const size_t bucketsCount,
+                                                    KeyFuncT&& getKey)
+    {
+        constexpr size_t minChunkSize = 1 << 16;
+
+        const size_t count = items.size();
+        const size_t workersCount = getWorkersCount(count, minChunkSize);
+        const size_t chunkSize = (count + workersCount - 1) / workersCount;
+
+        // Per worker histograms, then the slots of each (bucket, worker) pair.
+        std::vector<size_t> slots(workersCount * bucketsCount, 0);
+        auto forEachChunk = [&](auto&& func) {
+            parallelFor(workersCount, 1, [&](size_t workerBegin, size_t workerEnd, size_t) {
+                for (size_t workerIdx = workerBegin; workerIdx < workerEnd; ++workerIdx)
+                {
+                    const size_t chunkBegin = std::min(workerIdx * chunkSize, count);
+                    const size_t chunkEnd = std::min(chunkBegin + chunkSize, count);
+                    func(chunkBegin, chunkEnd, &slots[workerIdx * bucketsCount]);
+                }
+            });
+        };
+
+        forEachChunk([&](const size_t chunkBegin, const size_t chunkEnd, size_t* pCounts) {
+            for (size_t itemIdx = chunkBegin; itemIdx < chunkEnd; ++itemIdx)
+            {
+                ++pCounts[getKey(items[itemIdx])];
+            }
+        });
+
+        std::vector<size_t> bucketsOffsets(bucketsCount + 1, 0);
+        size_t offset = 0;
+        for (size_t bucketIdx = 0; bucketIdx < bucketsCount; ++bucketIdx)
+        {
+            bucketsOffsets[bucketIdx] = offset;
+            for (size_t workerIdx = 0; workerIdx < workersCount; ++workerIdx)
+            {
+                const size_t bucketCount = slots[workerIdx * bucketsCount + bucketIdx];
+                slots[workerIdx * bucketsCount + bucketIdx] = offset;
+                offset += bucketCount;
+            }
+        }
+        bucketsOffsets[bucketsCount] = offset;
+
+        sortedItems.resize(count);
+        forEachChunk([&](const size_t chunkBegin, const size_t chunkEnd, size_t* pSlots) {
+            for (size_t itemIdx = chunkBegin; itemIdx < chunkEnd; ++itemIdx)
+            {
+                sortedItems[pSlots[getKey(items[itemIdx])]++] = items[itemIdx];
+            }
+        });
+
+        return bucketsOffsets;
+    }
+
+    /// \brief  Sort a range in parallel: chunks are sorted concurrently then merged pairwise.
+    ///
+    /// \param  first Beginning of the range.
+    /// \param  last End of the range.
+    /// \param  comp Comparison function object.
+    template<typename RandomItrT, typename CompareT>
+    static void parallelSort(RandomItrT first, RandomItrT last, CompareT comp)
+    {
+        constexpr size_t minChunkSize = 1 << 15;
+
+        const size_t count = std::distance(first, last);
+        const size_t workersCount = getWorkersCount(count, minChunkSize);
+        if (workersCount == 1)
+        {
+            std::sort(first, last, comp);
+            return;
+        }
+
+        const size_t chunkSize = (count + workersCount - 1) / workersCount;
+        auto chunkBound = [first, count, chunkSize](const size_t chunkIdx) {
+            return first + std::min(chunkIdx * chunkSize, count);
+        };
+
+        parallelFor(workersCount,
+                    1,
+                    [&chunkBound, &comp](const size_t chunkBegin, const size_t chunkEnd, size_t) {
+                        for (size_t chunkIdx = chunkBegin; chunkIdx < chunkEnd; ++chunkIdx)
+                        {
+                            std::sort(chunkBound(chunkIdx), chunkBound(chunkIdx + 1), comp);
+                        }
+                    });
+
+        // Merge neighbouring sorted runs, doubling the runs' width at each pass.
+        for (size_t width = 1; width < workersCount; width *= 2)
+        {
+            const size_t mergesCount = (workersCount + 2 * width - 1) / (2 * width);
+
+            parallelFor(mergesCount, 1, [&](size_t mergeBegin, size_t mergeEnd, size_t) {
+                for (size_t mergeIdx = mergeBegin; mergeIdx < mergeEnd; ++mergeIdx)
+                {
+                    const size_t runIdx = mergeIdx * 2 * width;
+                    std::inplace_merge(chunkBound(runIdx),
+                                       chunkBound(runIdx + width),
+                                       chunkBound(runIdx + 2 * width),
+                                       comp);
+                }
+            });
+        }
+    }
+};
+
+} /* namespace ObjUtils */
+
+#endif /* PARALLELUTILS_H_ */
@@ -0,0 +1,171 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ParseStats.h
+///
+/// \brief     Opt-in instrumentation of the Obj parsing: per phase timings and counters.
+/// \details   Available in release builds. The heap allocations are only counted by the programs
+///            replacing the global operator new to call ParseStats::countAllocation(), like the
+///            objparser executable built with OBJ_COUNT_ALLOCATIONS.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef PARSESTATS_H_
+#define PARSESTATS_H_
+
+#include "Types.h"
+
+#include <array>
+#include <chrono>
+#include <optional>
+#include <utility>
+
+/// \brief Phases of the Obj parsing.
+enum class ParsePhase : uint8_t
+{
+    IO = 0,          ///< Reading the lines.
+    TOKENIZE,        ///< Identifying the elements and their arguments.
+    FLOAT_PARSE,     ///< Parsing the vertices (v/vt/vn/vp).
+    FACE_PARSE,      ///< Parsing the faces.
+    GROUP_HANDLING,  ///< Parsing the groups (g/s/mg/o).
+    MATERIALS,       ///< Parsing usemtl and the mtllib files.
+    FINALIZE,        ///< Ending the groups and binding the materials.
+    COUNT
+};
+
+/// \brief Timings and counters of one parsing, or the sum of several ones.
+struct ParseStats
+{
+    /// Count of the Obj elements' types.
+    static constexpr size_t elementTypesCount =
+        static_cast<size_t>(ElementType::SURFACE_APPROX_TECH) + 1;
+
+    /// Time spent in each phase.
+    std::array<std::chrono::nanoseconds, static_cast<size_t>(ParsePhase::COUNT)> m_phasesTimes{};
+
+    /// Count of parsed elements of each type.
+    std::array<size_t, elementTypesCount> m_elementsCounts{};
+
+    size_t m_linesCount = 0;        ///< Count of read lines, joined lines count as one.
+    uintmax_t m_bytesCount = 0;     ///< Count of read bytes.
+    size_t m_filesCount = 0;        ///< Count of parsed files.
+
+    /// Count of heap allocations, nullopt if the program doesn't count them.
+    std::optional<size_t> m_allocationsCount;
+
+    /// Bytes of the heap allocations, nullopt if the program doesn't count them.
+    std::optional<size_t> m_allocatedBytes;
+
+    /// \brief  Add the timings and counters of another parsing.
+    ParseStats& operator+=(const ParseStats& other)
+    {
+        for (size_t phaseIdx = 0; phaseIdx < m_phasesTimes.size(); ++phaseIdx)
+        {
+            m_phasesTimes[phaseIdx] += other.m_phasesTimes[phaseIdx];
+        }
+        for (size_t typeIdx = 0; typeIdx < m_elementsCounts.size(); ++typeIdx)
+        {
+            m_elementsCounts[typeIdx] += other.m_elementsCounts[typeIdx];
+        }
+
+        m_linesCount += other.m_linesCount;
+        m_bytesCount += other.m_bytesCount;
+        m_filesCount += other.m_filesCount;
+
+        if (other.m_allocationsCount.has_value() == true)
+        {
+            m_allocationsCount = m_allocationsCount.value_or(0) + *other.m_allocationsCount;
+            m_allocatedBytes = m_allocatedBytes.value_or(0) + other.m_allocatedBytes.value_or(0);
+        }
+
+        return *this;
+    }
+
+    // Accessors ===================================================================================
+
+    std::chrono::nanoseconds getPhaseTime(const ParsePhase phase) const
+    {
+        return m_phasesTimes[static_cast<size_t>(phase)];
+    }
+    size_t getElementsCount(const ElementType type) const
+    {
+        return m_elementsCounts[static_cast<size_t>(type)];
+    }
+    std::chrono::nanoseconds getTotalTime() const
+    {
+        std::chrono::nanoseconds totalTime{0};
+        for (const std::chrono::nanoseconds phaseTime : m_phasesTimes)
+        {
+            totalTime += phaseTime;
+        }
+
+        return totalTime;
+    }
+
+    /// \brief  Count a heap allocation of the calling thread. Called by the replacement of the
+    ///         global operator new, which only the programs counting the allocations define.
+    ///
+    /// \param  size Allocated bytes.
+    static void countAllocation(const size_t size) noexcept;
+
+    /// \brief  Return true if the program counts the heap allocations.
+    static bool isCountingAllocations();
+
+    /// \brief  Return the heap allocations counters of the calling thread, zeros unless the
+    ///         program counts the allocations.
+    ///
+    /// \return pair of the allocations count and the allocated bytes.
+    static std::pair<size_t, size_t> getThreadAllocations();
+};
+
+/* ============================================================================================== */
+
+/// \brief Stopwatch charging the time elapsed since its last lap to a parsing phase. One clock
+///        read per lap: consecutive phases share their boundary.
+class ParsePhaseClock
+{
+public:
+    /// \brief  Constructor. Starts the clock.
+    ///
+    /// \param  stats Stats to charge.
+    explicit ParsePhaseClock(ParseStats& stats) :
+        m_stats(stats), m_lastLapTime(std::chrono::steady_clock::now())
+    {
+    }
+
+    /// \brief  Charge the time elapsed since the last lap to a phase.
+    ///
+    /// \param  phase Phase to charge.
+    void lap(const ParsePhase phase)
+    {
+        const std::chrono::steady_clock::time_point lapTime = std::chrono::steady_clock::now();
+        m_stats.m_phasesTimes[static_cast<size_t>(phase)] += lapTime - m_lastLapTime;
+        m_lastLapTime = lapTime;
+    }
+
+private:
+    // Members =====================================================================================
+
+    ParseStats& m_stats;                                  ///< Stats to charge.
+    std::chrono::steady_clock::time_point m_lastLapTime;  ///< Time of the last lap.
+};
+
+#endif /* PARSESTATS_H_ */
@@ -0,0 +1,171 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      TextBuffer.h
+///
+/// \brief     Growable output buffer with locale-independent numbers formatting. Shared backend of
+///            the text writers.
+/// \details   Floats are formatted with the shortest representation that round-trips, integers
+///            without any intermediate string.
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#ifndef TEXTBUFFER_H_
+#define TEXTBUFFER_H_
+
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace ObjUtils
+{
+/// \brief  Growable text output buffer.
+class TextBuffer final
+{
+public:
+    /// Largest count of characters of a formatted float, double or 64 bits integer.
+    static constexpr size_t MAX_NUMBER_CHARS = 32;
+
+    /// \brief  Constructor.
+    ///
+    /// \param  initialCapacity Initial capacity in characters.
+    explicit TextBuffer(const size_t initialCapacity = 64 * 1024) : m_buffer(initialCapacity) {}
+
+    /// \brief  Append characters.
+    TextBuffer& append(std::string_view str)
+    {
+        std::memcpy(reserve(str.size()), str.data(), str.size());
+        m_size += str.size();
+
+        return *this;
+    }
+
+    /// \brief  Append one character.
+    TextBuffer& append(const char c)
+    {
+        *reserve(1) = c;
+        ++m_size;
+
+        return *this;
+    }
+
+    /// \brief  Append a floating-point number, with the shortest representation that reads back
+    ///         to the same value.
+    template<typename T, std::enable_if_t<std::is_floating_point_v<T>, int> = 0>
+    TextBuffer& append(const T value)
+    {
+        return appendNumber(value);
+    }
+
+    /// \brief  Append an integer.
+    template<typename T,
+             std::enable_if_t<std::is_integral_v<T> && (std::is_same_v<T, char> == false) &&
+                                  (std::is_same_v<T, bool> == false),
+                              int> = 0>
+    TextBuffer& append(const T value)
+    {
+        return appendNumber(value);
+    }
+
+    /// \brief  Append a JSON string literal: quoted, with the quotes, backslashes and control
+    ///         characters escaped.
+    TextBuffer& appendJsonString(std::string_view str)
+    {
+        constexpr std::string_view hexDigits = "0123456789abcdef";
+
+        append('"');
+        for (const char c : str)
+        {
+            if ((c == '"') || (c == '\\'))
+            {
+                append('\\').append(c);
+            }
+            else if (static_cast<unsigned char>(c) < 0x20)
+            {
+                append("\\u00").append(hexDigits[c >> 4]).append(hexDigits[c & 0xF]);
+            }
+            else
+            {
+                append(c);
+            }
+        }
+
+        return append('"');
+    }
+
+    /// \brief  Write the buffer's content to a file and empty the buffer.
+    ///
+    /// \param  pFile Destination file.
+    /// \return true if all the content was written.
+    bool flush(std::FILE* pFile)
+    {
+        const bool written = (std::fwrite(m_buffer.data(), 1, m_size, pFile) == m_size);
+        m_size = 0;
+
+        return written;
+    }
+
+    /// \brief  Empty the buffer, keeping its capacity.
+    void clear() { m_size = 0; }
+
+    // Accessors ===================================================================================
+
+    const char* getData() const { return m_buffer.data(); }
+    size_t getSize() const { return m_size; }
+    bool isEmpty() const { return (m_size == 0); }
+    std::string_view getView() const { return std::string_view(m_buffer.data(), m_size); }
+
+private:
+    /// \brief  Return a pointer to at least count free characters at the end of the buffer,
+    ///         growing it if needed.
+    char* reserve(const size_t count)
+    {
+        if (m_size + count > m_buffer.size())
+        {
+            m_buffer.resize(std::max(m_buffer.size() * 2, m_size + count));
+        }
+
+        return m_buffer.data() + m_size;
+    }
+
+    template<typename T>
+    TextBuffer& appendNumber(const T value)
+    {
+        char* pFirst = reserve(MAX_NUMBER_CHARS);
+        const std::to_chars_result result = std::to_chars(pFirst, pFirst + MAX_NUMBER_CHARS, value);
+        m_size += (result.ptr - pFirst);
+
+        return *this;
+    }
+
+    // Members =====================================================================================
+
+    std::vector<char> m_buffer;  ///< Characters storage, its size is the capacity.
+    size_t m_size = 0;           ///< Count of used characters.
+};
+
+} /* namespace ObjUtils */
+
+#endif /* TEXTBUFFER_H_ */
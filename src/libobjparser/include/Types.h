@@ -29,6 +29,8 @@
 #ifndef TYPEDEFS_H_
 #define TYPEDEFS_H_
 
+#include "ObjBufferAllocator.h"
+
 #include <cstddef>
 #include <cstdint>
 #include <vector>
@@ -44,11 +46,11 @@ struct ObjEntityVertex;
 using Vertex_t = ObjEntityVertex;
 
 // Vertices buffer type.
-using VertexBuffer_t = std::array<std::vector<Vertex_t>, 4>;
+using VertexBuffer_t = std::array<std::vector<Vertex_t, ObjBufferAllocator<Vertex_t>>, 4>;
 
 // List of vertices.
 using VerticesRefList_t = std::vector<std::reference_wrapper<const Vertex_t>>;
-using IndexBuffer_t = std::vector<size_t>;
+using IndexBuffer_t = std::vector<size_t, ObjBufferAllocator<size_t>>;
 using IndexBufferRange_t = std::pair<size_t, size_t>;
 using IndexBufferRangeIterators_t =
     std::pair<IndexBuffer_t::const_iterator, IndexBuffer_t::const_iterator>;
@@ -60,6 +62,14 @@ using EntitiesIndexRange_t = std::pair<size_t, size_t>;
 enum class ElementType : uint8_t;
 using KeywordsMap_t = std::unordered_map<std::string_view, ElementType>;
 
+// Wavefront Mtl keyword dictionary type.
+enum class MtlElementType : uint8_t;
+using MtlKeywordsMap_t = std::unordered_map<std::string_view, MtlElementType>;
+
+// Material ID of the faces: index in the Obj database's materials table.
+using MaterialID_t = uint16_t;
+constexpr MaterialID_t NO_MATERIAL_ID = 0xFFFF;  ///< Faces without material.
+
 // std::string iterators types.
 using CStringIterator_t = std::string::const_iterator;
 using RStringIterator_t = std::string::reverse_iterator;
@@ -68,8 +78,10 @@ using RStringIterator_t = std::string::reverse_iterator;
 // Since C++11 std::string is contiguous in memory, it's safe to create one from &*iterator.
 using ElemIDResult_t = std::pair<ElementType, std::string_view>;  // TODO: Change this type's name.
 
-class ObjEntity;
-using EntitiesRefList_t = std::vector<std::reference_wrapper<const ObjEntity>>;
+// Location of an Obj entity: entity's type + index in the buffer of its type.
+// Locations stay valid when the entities buffers grow, unlike references.
+using EntityLocation_t = std::pair<ElementType, size_t>;
+using EntitiesTable_t = std::vector<EntityLocation_t, ObjBufferAllocator<EntityLocation_t>>;
 
 /* ============================================================================================== */
 
@@ -139,6 +151,35 @@ enum class ElementType : uint8_t
 
 /* ============================================================================================== */
 
+///  \brief .mtl file's elements' types.
+enum class MtlElementType : uint8_t
+{
+    NEW_MATERIAL = 0,     ///< newmtl
+    AMBIENT,              ///< Ka
+    DIFFUSE,              ///< Kd
+    SPECULAR,             ///< Ks
+    EMISSIVE,             ///< Ke
+    TRANSMISSION_FILTER,  ///< Tf
+    ILLUMINATION,         ///< illum
+    DISSOLVE,             ///< d
+    TRANSPARENCY,         ///< Tr (1 - d)
+    SPECULAR_EXPONENT,    ///< Ns
+    SHARPNESS,            ///< sharpness
+    OPTICAL_DENSITY,      ///< Ni
+    MAP_AMBIENT,          ///< map_Ka
+    MAP_DIFFUSE,          ///< map_Kd
+    MAP_SPECULAR,         ///< map_Ks
+    MAP_EMISSIVE,         ///< map_Ke
+    MAP_SPECULAR_EXP,     ///< map_Ns
+    MAP_DISSOLVE,         ///< map_d
+    MAP_BUMP,             ///< map_bump, bump
+    MAP_DISPLACEMENT,     ///< disp
+    MAP_DECAL,            ///< decal
+    MAP_REFLECTION,       ///< refl
+};
+
+/* ============================================================================================== */
+
 /// \brief Some elements, such as faces and surfaces, may have a triplet of
 ///         numbers that reference vertex data.These numbers are the reference
 ///         numbers for a geometric vertex, a texture vertex, and a vertex normal.
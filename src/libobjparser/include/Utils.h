@@ -29,6 +29,7 @@
 #ifndef UTILS_H_
 #define UTILS_H_
 
+#include <optional>
 #include <vector>
 #include <string_view>
 
@@ -160,6 +161,15 @@ public:
     /// \return std::vector of substrings.
     static std::vector<std::string_view>
     splitString(std::string_view str, const std::initializer_list<const char> delimiters = {});
+
+    /// \brief  Parse the number starting a string, after its blanks, and remove it from the
+    ///         string. Only the string's characters are read, it needn't be null-terminated.
+    ///         Instantiated for float and int64_t.
+    ///
+    /// \param  str Source string, the number is removed from it.
+    /// \return The number, std::nullopt if the string doesn't start with one.
+    template<typename NumberT>
+    static std::optional<NumberT> parseNumber(std::string_view& str);
 };
 
 } /* namespace ObjUtils */
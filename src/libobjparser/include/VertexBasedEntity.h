@@ -64,8 +64,36 @@ public:
         return std::make_pair(m_firstIdx, m_lastIdx);
     }
 
+    /// \brief  Return the count of indices referencing one vertex (v, v/vt, v//vn or v/vt/vn).
+    ///
+    /// \param  eVtxIdxOrganization Vertices indices layout.
+    /// \return Count of indices per vertex.
+    static constexpr size_t getIndicesStride(const VerticesIdxOrganization eVtxIdxOrganization)
+    {
+        switch (eVtxIdxOrganization)
+        {
+        case VerticesIdxOrganization::VGEO_VTEXTURE:
+        case VerticesIdxOrganization::VGEO_VNORMAL: return 2;
+        case VerticesIdxOrganization::VGEO_VTEXTURE_VNORMAL: return 3;
+
+        case VerticesIdxOrganization::VGEO:
+        default: return 1;
+        }
+    }
+
+    /// \brief  Move the vertices indices range by an offset in the index buffer.
+    ///
+    /// \param  offset Offset added to the range's bounds, modulo 2^64 to move it backward.
+    void offsetVerticesIndicesRange(const size_t offset)
+    {
+        m_firstIdx += offset;
+        m_lastIdx += offset;
+    }
+
     // Accessors ===================================================================================
 
+    size_t getIndicesStride() const { return getIndicesStride(m_eVtxIdxOrganization); }
+    size_t getCornersCount() const { return (m_lastIdx - m_firstIdx + 1) / getIndicesStride(); }
     size_t getFirstVertexIndex() const { return m_firstIdx; }
     size_t getLastVertexIndex() const { return m_lastIdx; }
     VerticesIdxOrganization getVerticesIndicesOrganization() const { return m_eVtxIdxOrganization; }
@@ -0,0 +1,115 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      LineReader.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "LineReader.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+namespace ObjUtils
+{
+std::optional<std::string_view> LineReader::readLine()
+{
+    // Positions relative to the line start, which moves when a block is read.
+    size_t segmentStart = 0;  // Start of the current physical line.
+    size_t scanPos = 0;       // Resume position of the end of line search.
+
+    while (true)
+    {
+        char* const pLine = m_buffer.data() + m_lineStart;
+        const size_t dataSize = m_dataEnd - m_lineStart;
+
+        const void* pNewLine = std::memchr(pLine + scanPos, '\n', dataSize - scanPos);
+        size_t lineEnd = dataSize;
+        if (pNewLine != nullptr)
+        {
+            lineEnd = static_cast<const char*>(pNewLine) - pLine;
+        }
+        else if (m_endOfFile == false)
+        {
+            // The line goes on in the next block.
+            scanPos = dataSize;
+            m_endOfFile = (readBlock() == false);
+            continue;
+        }
+        else if (dataSize == 0)
+        {
+            return std::nullopt;
+        }
+
+        // The physical line is continued if its last non blank character is a backslash. Only
+        // the blanks of this physical line are scanned, so joining stays linear.
+        size_t lastCharPos = lineEnd;
+        while ((lastCharPos > segmentStart) &&
+               (std::isspace(static_cast<unsigned char>(pLine[lastCharPos - 1])) != 0))
+        {
+            --lastCharPos;
+        }
+
+        if ((lastCharPos > segmentStart) && (pLine[lastCharPos - 1] == '\\'))
+        {
+            // Blank the continuation character up to the end of line, the joined line stays
+            // contiguous in the buffer.
+            std::fill(pLine + lastCharPos - 1, pLine + std::min(lineEnd + 1, dataSize), ' ');
+            if (lineEnd < dataSize)
+            {
+                segmentStart = scanPos = lineEnd + 1;
+                continue;
+            }
+        }
+
+        m_lineStart += std::min(lineEnd + 1, dataSize);
+
+        return std::string_view(pLine, lineEnd);
+    }
+}
+
+// =================================================================================================
+
+bool LineReader::readBlock()
+{
+    const size_t lineSize = m_dataEnd - m_lineStart;
+    if (m_lineStart > 0)
+    {
+        std::memmove(m_buffer.data(), m_buffer.data() + m_lineStart, lineSize);
+        m_lineStart = 0;
+        m_dataEnd = lineSize;
+    }
+
+    // The current line fills the whole buffer.
+    if (m_dataEnd == m_buffer.size())
+    {
+        m_buffer.resize(m_buffer.size() * 2);
+    }
+
+    const size_t readSize = m_reader.read(m_buffer.data() + m_dataEnd, m_buffer.size() - m_dataEnd);
+    m_dataEnd += readSize;
+    m_readBytesCount += readSize;
+
+    return (readSize > 0);
+}
+
+} /* namespace ObjUtils */
@@ -0,0 +1,303 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      MtlFileParser.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "MtlFileParser.h"
+#include "LineReader.h"
+
+#include "Utils.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+/// \brief  Parse the number starting the arguments and remove it from them, 0 if malformed.
+float parseFloat(std::string_view& args)
+{
+    return ObjUtils::StringUtils::parseNumber<float>(args).value_or(0.0f);
+}
+
+}  // namespace
+
+// =================================================================================================
+
+ObjMaterialLibrary MtlFileParser::parseFile()
+{
+    OBJLOG("Mtl file parsing started...");
+
+    namespace fs = std::filesystem;
+
+    if ((fs::exists(m_mtlFilePath) == true) && (fs::is_regular_file(m_mtlFilePath) == true))
+    {
+        const std::unique_ptr<std::FILE, decltype(&fclose)> smtMtlFile(fopen(m_mtlFilePath.c_str(),
+                                                                             "r"),
+                                                                       &fclose);
+
+        if (smtMtlFile != nullptr)
+        {
+            // Only the lines ending with the continuation character (\) are joined, backslashes
+            // elsewhere are kept, they are common in texture paths.
+            ObjFileStreamReader fileReader(smtMtlFile.get());
+            ObjUtils::LineReader lineReader(fileReader);
+
+            for (std::optional<std::string_view> oneLine = lineReader.readLine();
+                 oneLine.has_value() == true; oneLine = lineReader.readLine())
+            {
+                parseElement(*oneLine);
+            }
+
+            OBJLOG("Mtl file parsing ended");
+        }
+    }
+
+    // The textures are resolved in the background, the Obj parsing goes on meanwhile.
+    m_mtlLibrary.resolveTextures();
+
+    // std::move used because the library is no longer needed by the Parser.
+    return std::move(m_mtlLibrary);
+}
+
+// =================================================================================================
+
+void MtlFileParser::parseElement(std::string_view oneLine)
+{
+    ObjUtils::StringUtils::removeSurroundingBlanks(oneLine);
+
+    const std::optional<MtlElemIDResult_t> elemTypeRes = getElementType(oneLine);
+
+    // False if the line is either empty, a comment or the element is unknown.
+    if (elemTypeRes.has_value() == false)
+    {
+        return;
+    }
+
+    auto [elemType, args] = *elemTypeRes;
+
+    if (elemType == MtlElementType::NEW_MATERIAL)
+    {
+        m_pCurrentMaterial = &m_mtlLibrary.insertMaterial(args);
+        return;
+    }
+
+    // Statements before the first newmtl have no material to apply to.
+    if ((m_pCurrentMaterial == nullptr) || (args.empty() == true))
+    {
+        OBJLOG("Mtl statement ignored : ", static_cast<uint8_t>(elemType));
+        return;
+    }
+
+    ObjMaterial::ColorAndIllumination& colors = m_pCurrentMaterial->getColors();
+    using MapType = ObjMaterial::TextureMapType;
+
+    // The arguments view the line buffer, which isn't null-terminated. Like with strtof, malformed
+    // numbers read as 0.
+    switch (elemType)
+    {
+    case MtlElementType::AMBIENT: parseColor(args, colors.m_ambient); break;
+    case MtlElementType::DIFFUSE: parseColor(args, colors.m_diffuse); break;
+    case MtlElementType::SPECULAR: parseColor(args, colors.m_specular); break;
+    case MtlElementType::EMISSIVE: parseColor(args, colors.m_emissive); break;
+    case MtlElementType::TRANSMISSION_FILTER: parseColor(args, colors.m_transmissionFilter); break;
+
+    case MtlElementType::ILLUMINATION:
+        colors.m_illuminationModel = static_cast<uint8_t>(
+            ObjUtils::StringUtils::parseNumber<int64_t>(args).value_or(0));
+        break;
+
+    case MtlElementType::DISSOLVE:
+        // "d -halo factor" is read as a plain dissolve factor.
+        if (args.compare(0, 5, "-halo") == 0)
+        {
+            args.remove_prefix(5);
+        }
+        colors.m_dissolve = parseFloat(args);
+        break;
+
+    case MtlElementType::TRANSPARENCY:
+        // Tr is the complement of d.
+        colors.m_dissolve = 1.0f - parseFloat(args);
+        break;
+
+    case MtlElementType::SPECULAR_EXPONENT:
+        colors.m_specularExponent = parseFloat(args);
+        break;
+
+    case MtlElementType::SHARPNESS: colors.m_sharpness = parseFloat(args); break;
+
+    case MtlElementType::OPTICAL_DENSITY:
+        colors.m_opticalDensity = parseFloat(args);
+        break;
+
+    case MtlElementType::MAP_AMBIENT: setTextureMap(MapType::AMBIENT, args); break;
+    case MtlElementType::MAP_DIFFUSE: setTextureMap(MapType::DIFFUSE, args); break;
+    case MtlElementType::MAP_SPECULAR: setTextureMap(MapType::SPECULAR, args); break;
+    case MtlElementType::MAP_EMISSIVE: setTextureMap(MapType::EMISSIVE, args); break;
+    case MtlElementType::MAP_SPECULAR_EXP: setTextureMap(MapType::SPECULAR_EXPONENT, args); break;
+    case MtlElementType::MAP_DISSOLVE: setTextureMap(MapType::DISSOLVE, args); break;
+    case MtlElementType::MAP_BUMP: setTextureMap(MapType::BUMP, args); break;
+    case MtlElementType::MAP_DISPLACEMENT: setTextureMap(MapType::DISPLACEMENT, args); break;
+    case MtlElementType::MAP_DECAL: setTextureMap(MapType::DECAL, args); break;
+    case MtlElementType::MAP_REFLECTION: setTextureMap(MapType::REFLECTION, args); break;
+
+    default: OBJASSERT(false, "Unknown Mtl element type"); break;
+    }
+}
+
+// =================================================================================================
+
+void MtlFileParser::setTextureMap(const ObjMaterial::TextureMapType mapType, std::string_view args)
+{
+    ObjMaterial::TextureMap textureMap = parseTextureMap(args);
+    textureMap.m_textureIdx = m_mtlLibrary.insertTexture(textureMap.m_filePath);
+
+    m_pCurrentMaterial->setTextureMap(mapType, std::move(textureMap));
+}
+
+// =================================================================================================
+
+std::optional<MtlFileParser::MtlElemIDResult_t>
+MtlFileParser::getElementType(std::string_view oneLine) const
+{
+    // Skip this line if it is empty or is a comment line.
+    if ((oneLine.empty() == true) || (isspace(*oneLine.data()) != 0) || (*oneLine.data() == '#'))
+    {
+        return std::nullopt;
+    }
+
+    // Go to the next white space (Only \t & ' ').
+    auto nextBlankItr = std::find_if(oneLine.cbegin(), oneLine.cend(), &isblank);
+
+    // Extract the element's type keyword.
+    const std::string_view typeKeyword(oneLine.data(), std::distance(oneLine.cbegin(),
+                                                                     nextBlankItr));
+
+    // Find the element's type keyword in the keywords list.
+    if (MtlKeywordsMap_t::const_iterator keyItr = elementsKeywords.find(typeKeyword);
+        keyItr == elementsKeywords.cend())
+    {
+        OBJLOG("Mtl keyword not supported : ", typeKeyword);
+        return std::nullopt;
+    }
+    else
+    {
+        // Keep only the element's arguments.
+        oneLine.remove_prefix(typeKeyword.size());
+        ObjUtils::StringUtils::removeSurroundingBlanks(oneLine);
+
+        // Store the element's type and its arguments.
+        return std::make_pair(keyItr->second, oneLine);
+    }
+}
+
+// =================================================================================================
+
+void MtlFileParser::parseColor(std::string_view args, RGB& color)
+{
+    // Spectral curves (.rfl files) and CIEXYZ colors are not supported.
+    if ((args.compare(0, 8, "spectral") == 0) || (args.compare(0, 3, "xyz") == 0))
+    {
+        OBJLOG("Mtl spectral and xyz colors not yet supported");
+        return;
+    }
+
+    color.m_r = parseFloat(args);
+
+    // Looks like: "r". The g and b components default to r.
+    color.m_g = (args.empty() == false) ? parseFloat(args) : color.m_r;
+    color.m_b = (args.empty() == false) ? parseFloat(args) : color.m_r;
+}
+
+// =================================================================================================
+
+ObjMaterial::TextureMap MtlFileParser::parseTextureMap(std::string_view args)
+{
+    // Count of arguments of each option. -o, -s & -t take 1 to 3 numeric arguments.
+    auto getOptionArgsCount = [](const std::string_view option) -> std::optional<size_t> {
+        constexpr std::array<std::string_view, 9> oneArgOptions = {
+            "-blendu", "-blendv", "-cc", "-clamp", "-texres", "-bm", "-boost", "-imfchan", "-type"};
+
+        if (std::find(oneArgOptions.cbegin(), oneArgOptions.cend(), option) !=
+            oneArgOptions.cend())
+        {
+            return 1;
+        }
+
+        if (option == "-mm")
+        {
+            return 2;
+        }
+
+        if ((option == "-o") || (option == "-s") || (option == "-t"))
+        {
+            return 3;
+        }
+
+        return std::nullopt;
+    };
+
+    // Remove the next blank separated token from the arguments and return it.
+    auto popToken = [&args]() {
+        ObjUtils::StringUtils::removeSurroundingBlanks(args);
+        const auto nextBlankItr = std::find_if(args.cbegin(), args.cend(), &isblank);
+        const std::string_view token(args.data(), std::distance(args.cbegin(), nextBlankItr));
+        args.remove_prefix(token.size());
+        ObjUtils::StringUtils::removeSurroundingBlanks(args);
+
+        return token;
+    };
+
+    const char* const pOptionsBegin = args.data();
+    while ((args.empty() == false) && (args.front() == '-'))
+    {
+        const std::string_view option = popToken();
+
+        const std::optional<size_t> argsCount = getOptionArgsCount(option);
+        if (argsCount.has_value() == false)
+        {
+            OBJLOG("Mtl texture map option not supported : ", option);
+            continue;
+        }
+
+        for (size_t argIdx = 0; (argIdx < *argsCount) && (args.empty() == false); ++argIdx)
+        {
+            // Only the first argument of -o, -s & -t is mandatory, the next ones are numeric.
+            if ((argIdx > 0) && (*argsCount == 3) &&
+                (std::strchr("+-.0123456789", args.front()) == nullptr))
+            {
+                break;
+            }
+
+            popToken();
+        }
+    }
+
+    // The remaining of the line is the texture file, which may contain blanks.
+    std::string_view options(pOptionsBegin, std::distance(pOptionsBegin, args.data()));
+    ObjUtils::StringUtils::removeSurroundingBlanks(options);
+
+    return {std::string(args), std::string(options)};
+}
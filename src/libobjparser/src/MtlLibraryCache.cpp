@@ -0,0 +1,100 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      MtlLibraryCache.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "MtlLibraryCache.h"
+
+#include "MtlFileParser.h"
+#include "Utils.h"
+
+MtlLibraryCache& MtlLibraryCache::getInstance()
+{
+    static MtlLibraryCache cache;
+    return cache;
+}
+
+// =================================================================================================
+
+std::shared_ptr<const ObjMaterialLibrary>
+MtlLibraryCache::getLibrary(const std::filesystem::path& mtlFilePath)
+{
+    namespace fs = std::filesystem;
+
+    std::error_code errorCode;
+    const fs::path canonicalPath = fs::canonical(mtlFilePath, errorCode);
+    if ((errorCode) || (fs::is_regular_file(canonicalPath, errorCode) == false))
+    {
+        OBJLOG("Material library not found : ", mtlFilePath.c_str());
+        return nullptr;
+    }
+
+    const fs::file_time_type lastWriteTime = fs::last_write_time(canonicalPath, errorCode);
+
+    SharedLibrary_t cachedLibrary;
+    std::promise<std::shared_ptr<const ObjMaterialLibrary>> libraryPromise;
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+
+        CacheEntry& entry = m_entries[canonicalPath.string()];
+        if ((entry.m_library.valid() == true) && (entry.m_lastWriteTime == lastWriteTime))
+        {
+            cachedLibrary = entry.m_library;
+        }
+        else
+        {
+            // First use, or the file changed since it was parsed.
+            entry.m_lastWriteTime = lastWriteTime;
+            entry.m_library = libraryPromise.get_future().share();
+        }
+    }
+
+    // Parsed, or being parsed by another thread.
+    if (cachedLibrary.valid() == true)
+    {
+        return cachedLibrary.get();
+    }
+
+    // Parse outside the lock, the other libraries remain available.
+    std::shared_ptr<const ObjMaterialLibrary> pLibrary = std::make_shared<const ObjMaterialLibrary>(
+        MtlFileParser(canonicalPath).parseFile());
+    libraryPromise.set_value(pLibrary);
+
+    return pLibrary;
+}
+
+// =================================================================================================
+
+void MtlLibraryCache::clear()
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+}
+
+// =================================================================================================
+
+size_t MtlLibraryCache::getLibrariesCount() const
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
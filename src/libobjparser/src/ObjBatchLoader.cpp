@@ -0,0 +1,413 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ObjBatchLoader.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "ObjBatchLoader.h"
+
+#include "ObjFileParser.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <string_view>
+#include <unordered_set>
+
+#if __has_include(<glob.h>)
+#define OBJ_HAS_GLOB
+#include <glob.h>
+#endif
+
+namespace
+{
+/// \brief  Files waiting to be parsed by one worker, largest first.
+struct WorkerQueue
+{
+    std::mutex m_mutex;                 ///< Protects m_filesIndices, other workers steal from it.
+    std::deque<size_t> m_filesIndices;  ///< Indices of the files to parse.
+
+    /// \brief  Pop the largest file of the queue.
+    std::optional<size_t> pop()
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_filesIndices.empty() == true)
+        {
+            return std::nullopt;
+        }
+
+        const size_t fileIdx = m_filesIndices.front();
+        m_filesIndices.pop_front();
+        return fileIdx;
+    }
+};
+
+/// \brief  Joins the started workers when leaving its scope, even through an exception.
+struct WorkersJoiner
+{
+    std::vector<std::thread>& m_workers;  ///< Started workers.
+
+    ~WorkersJoiner()
+    {
+        for (std::thread& worker : m_workers)
+        {
+            if (worker.joinable() == true)
+            {
+                worker.join();
+            }
+        }
+    }
+};
+
+#ifdef OBJ_HAS_GLOB
+
+/// \brief  Append the regular files matching a glob pattern.
+void appendGlobMatches(const std::string& pattern, std::vector<std::filesystem::path>& filesPaths)
+{
+    glob_t globResult{};
+    if (glob(pattern.c_str(), 0, nullptr, &globResult) == 0)
+    {
+        std::error_code errorCode;
+        for (size_t pathIdx = 0; pathIdx < globResult.gl_pathc; ++pathIdx)
+        {
+            if (std::filesystem::is_regular_file(globResult.gl_pathv[pathIdx], errorCode) == true)
+            {
+                filesPaths.emplace_back(globResult.gl_pathv[pathIdx]);
+            }
+        }
+    }
+    globfree(&globResult);
+}
+
+#else
+
+/// \brief  Return true if a name matches a pattern of '*' and '?' wildcards.
+bool matchesWildcards(const std::string_view pattern, const std::string_view name)
+{
+    size_t patternIdx = 0;
+    size_t nameIdx = 0;
+
+    // Position after the last '*' and the name's position it was matched up to.
+    size_t starPatternIdx = std::string_view::npos;
+    size_t starNameIdx = 0;
+
+    while (nameIdx < name.size())
+    {
+        if ((patternIdx < pattern.size()) &&
+            ((pattern[patternIdx] == '?') || (pattern[patternIdx] == name[nameIdx])))
+        {
+            ++patternIdx;
+            ++nameIdx;
+        }
+        else if ((patternIdx < pattern.size()) && (pattern[patternIdx] == '*'))
+        {
+            starPatternIdx = ++patternIdx;
+            starNameIdx = nameIdx;
+        }
+        else if (starPatternIdx != std::string_view::npos)
+        {
+            // Let the last '*' match one more character.
+            patternIdx = starPatternIdx;
+            nameIdx = ++starNameIdx;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    while ((patternIdx < pattern.size()) && (pattern[patternIdx] == '*'))
+    {
+        ++patternIdx;
+    }
+
+    return (patternIdx == pattern.size());
+}
+
+/// \brief  Append the regular files matching a pattern whose wildcards are in its last component.
+void appendGlobMatches(const std::string& pattern, std::vector<std::filesystem::path>& filesPaths)
+{
+    namespace fs = std::filesystem;
+
+    const fs::path patternPath(pattern);
+    const fs::path dirPath = patternPath.has_parent_path() ? patternPath.parent_path() : ".";
+    const std::string namePattern = patternPath.filename().string();
+
+    std::vector<fs::path> matchedPaths;
+    std::error_code errorCode;
+    for (const fs::directory_entry& entry : fs::directory_iterator(dirPath, errorCode))
+    {
+        if ((entry.is_regular_file(errorCode) == true) &&
+            (matchesWildcards(namePattern, entry.path().filename().string()) == true))
+        {
+            matchedPaths.push_back(patternPath.has_parent_path() ? entry.path()
+                                                                 : entry.path().filename());
+        }
+    }
+
+    // glob() sorts its matches.
+    std::sort(matchedPaths.begin(), matchedPaths.end());
+    filesPaths.insert(filesPaths.end(), matchedPaths.cbegin(), matchedPaths.cend());
+}
+
+#endif
+
+}  // namespace
+
+// =================================================================================================
+
+ObjBatchLoader::ObjBatchLoader(const size_t workersCount) :
+    m_workersCount((workersCount > 0) ? workersCount
+                                      : std::max<size_t>(std::thread::hardware_concurrency(), 1))
+{
+}
+
+// =================================================================================================
+
+ObjBatchLoader::~ObjBatchLoader()
+{
+    if (m_asyncBatch.joinable() == true)
+    {
+        m_asyncBatch.join();
+    }
+}
+
+// =================================================================================================
+
+ObjBatchLoader::BatchStats
+ObjBatchLoader::loadFiles(const std::vector<std::filesystem::path>& objFilesPaths,
+                          const CompletionCallback_t& onFileParsed,
+                          const FailureCallback_t& onFileFailed)
+{
+    const auto startTime = std::chrono::steady_clock::now();
+
+    const size_t filesCount = objFilesPaths.size();
+    const size_t workersCount = std::clamp<size_t>(filesCount, 1, m_workersCount);
+
+    std::vector<uintmax_t> filesSizes(filesCount, 0);
+    for (size_t fileIdx = 0; fileIdx < filesCount; ++fileIdx)
+    {
+        std::error_code errorCode;
+        filesSizes[fileIdx] = std::filesystem::file_size(objFilesPaths[fileIdx], errorCode);
+        if (errorCode)
+        {
+            filesSizes[fileIdx] = 0;
+        }
+    }
+
+    // Deal the files largest first: each worker's queue is sorted from its largest file.
+    std::vector<size_t> sortedFiles(filesCount);
+    std::iota(sortedFiles.begin(), sortedFiles.end(), 0);
+    std::stable_sort(sortedFiles.begin(),
+                     sortedFiles.end(),
+                     [&filesSizes](const size_t lhs, const size_t rhs) {
+                         return (filesSizes[lhs] > filesSizes[rhs]);
+                     });
+
+    std::vector<WorkerQueue> queues(workersCount);
+    for (size_t sortedIdx = 0; sortedIdx < filesCount; ++sortedIdx)
+    {
+        queues[sortedIdx % workersCount].m_filesIndices.push_back(sortedFiles[sortedIdx]);
+    }
+
+    std::atomic<size_t> parsedFilesCount = 0;
+    std::atomic<size_t> failedFilesCount = 0;
+    std::atomic<uintmax_t> parsedBytesCount = 0;
+
+    auto runWorker = [&](const size_t workerIdx) {
+        while (true)
+        {
+            // Own files first, then steal the largest file left by the next workers.
+            std::optional<size_t> fileIdx = queues[workerIdx].pop();
+            for (size_t victimOffset = 1; (fileIdx.has_value() == false) &&
+                                          (victimOffset < workersCount);
+                 ++victimOffset)
+            {
+                fileIdx = queues[(workerIdx + victimOffset) % workersCount].pop();
+            }
+
+            // No file is queued after the start, so empty queues mean the end of the batch.
+            if (fileIdx.has_value() == false)
+            {
+                return;
+            }
+
+            // An exception escaping a worker thread would terminate the process: a malformed
+            // file, or a completion callback which throws, only fails its own slot.
+            try
+            {
+                ObjFileParser fp(objFilesPaths[*fileIdx].string());
+                ObjDatabase objDB = fp.parseFile();
+
+                if (onFileParsed != nullptr)
+                {
+                    onFileParsed(*fileIdx, std::move(objDB));
+                }
+            }
+            catch (...)
+            {
+                ++failedFilesCount;
+                if (onFileFailed != nullptr)
+                {
+                    // The failure callback's own exceptions are dropped, for the same reason.
+                    try
+                    {
+                        onFileFailed(*fileIdx, std::current_exception());
+                    }
+                    catch (...)
+                    {
+                    }
+                }
+                continue;
+            }
+
+            parsedBytesCount += filesSizes[*fileIdx];
+            ++parsedFilesCount;
+        }
+    };
+
+    // The calling thread is the first worker.
+    std::vector<std::thread> workers;
+    {
+        const WorkersJoiner joiner{workers};
+        workers.reserve(workersCount - 1);
+        for (size_t workerIdx = 1; workerIdx < workersCount; ++workerIdx)
+        {
+            workers.emplace_back(runWorker, workerIdx);
+        }
+        runWorker(0);
+    }
+
+    BatchStats stats;
+    stats.m_filesCount = parsedFilesCount;
+    stats.m_failedFilesCount = failedFilesCount;
+    stats.m_bytesCount = parsedBytesCount;
+    stats.m_elapsedSeconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    return stats;
+}
+
+// =================================================================================================
+
+std::vector<std::future<ObjDatabase>>
+ObjBatchLoader::loadFilesAsync(const std::vector<std::filesystem::path>& objFilesPaths)
+{
+    if (m_asyncBatch.joinable() == true)
+    {
+        m_asyncBatch.join();
+    }
+
+    auto pPromises = std::make_shared<std::vector<std::promise<ObjDatabase>>>(objFilesPaths.size());
+
+    std::vector<std::future<ObjDatabase>> futures;
+    futures.reserve(objFilesPaths.size());
+    for (std::promise<ObjDatabase>& promise : *pPromises)
+    {
+        futures.push_back(promise.get_future());
+    }
+
+    m_asyncBatch = std::thread([this, objFilesPaths, pPromises]() {
+        loadFiles(
+            objFilesPaths,
+            [&pPromises](const size_t fileIdx, ObjDatabase&& objDB) {
+                (*pPromises)[fileIdx].set_value(std::move(objDB));
+            },
+            [&pPromises](const size_t fileIdx, std::exception_ptr pError) {
+                (*pPromises)[fileIdx].set_exception(pError);
+            });
+    });
+
+    return futures;
+}
+
+// =================================================================================================
+
+std::vector<std::filesystem::path>
+ObjBatchLoader::expandPaths(const std::vector<std::string>& patterns)
+{
+    namespace fs = std::filesystem;
+
+    std::vector<fs::path> objFilesPaths;
+
+    auto getExtension = [](const fs::path& filePath) {
+        std::string extension = filePath.extension().string();
+        std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+
+        return extension;
+    };
+
+    // Compressed Obj files are named *.obj.gz or *.obj.zst.
+    auto isObjFile = [&getExtension](const fs::path& filePath) {
+        const std::string extension = getExtension(filePath);
+        if ((extension == ".gz") || (extension == ".zst"))
+        {
+            return (getExtension(filePath.stem()) == ".obj");
+        }
+
+        return (extension == ".obj");
+    };
+
+    for (const std::string& pattern : patterns)
+    {
+        std::error_code errorCode;
+        if (fs::is_directory(pattern, errorCode) == true)
+        {
+            for (const fs::directory_entry& entry : fs::recursive_directory_iterator(pattern,
+                                                                                     errorCode))
+            {
+                if ((entry.is_regular_file(errorCode) == true) && (isObjFile(entry.path()) == true))
+                {
+                    objFilesPaths.push_back(entry.path());
+                }
+            }
+        }
+        else if (fs::is_regular_file(pattern, errorCode) == true)
+        {
+            objFilesPaths.emplace_back(pattern);
+        }
+        else
+        {
+            appendGlobMatches(pattern, objFilesPaths);
+        }
+    }
+
+    // A file matched by several patterns is parsed once.
+    std::unordered_set<std::string> uniquePaths;
+    objFilesPaths.erase(std::remove_if(objFilesPaths.begin(),
+                                       objFilesPaths.end(),
+                                       [&uniquePaths](const fs::path& filePath) {
+                                           std::error_code errorCode;
+                                           const fs::path canonicalPath =
+                                               fs::weakly_canonical(filePath, errorCode);
+                                           return (uniquePaths.insert(canonicalPath.string())
+                                                       .second == false);
+                                       }),
+                        objFilesPaths.end());
+
+    return objFilesPaths;
+}
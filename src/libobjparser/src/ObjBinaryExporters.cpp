@@ -0,0 +1,370 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ObjBinaryExporters.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "ObjBinaryExporters.h"
+
+#include "ObjDatabase.h"
+#include "ObjRenderMesh.h"
+#include "TextBuffer.h"
+#include "Utils.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+/// Size of the staging buffer. Arrays at least this large are written without being staged.
+constexpr size_t stagingSize = 1 << 20;
+
+/// Largest count of corners of a PLY polygon, its count is stored as an unsigned char.
+constexpr size_t maxPlyCorners = std::numeric_limits<uint8_t>::max();
+
+using FilePtr_t = std::unique_ptr<std::FILE, decltype(&fclose)>;
+
+/// \brief  Return true if the host stores numbers in little-endian, as both formats require.
+bool isLittleEndianHost()
+{
+    const uint16_t value = 1;
+    uint8_t firstByte = 0;
+    std::memcpy(&firstByte, &value, 1);
+
+    return (firstByte == 1);
+}
+
+/// \brief  Open a file for binary writing.
+FilePtr_t openFile(const std::filesystem::path& filePath)
+{
+    return FilePtr_t(std::fopen(filePath.c_str(), "wb"), &fclose);
+}
+
+/// \brief  Buffered binary writer. Small values are staged, large arrays are written as is.
+class StagingWriter
+{
+public:
+    explicit StagingWriter(std::FILE* pFile) : m_pFile(pFile), m_staging(stagingSize) {}
+
+    template<typename T>
+    void write(const T value)
+    {
+        static_assert(std::is_trivially_copyable_v<T> == true);
+
+        if (m_size + sizeof(T) > m_staging.size())
+        {
+            flush();
+        }
+
+        std::memcpy(m_staging.data() + m_size, &value, sizeof(T));
+        m_size += sizeof(T);
+    }
+
+    template<typename T>
+    void writeArray(const T* pValues, const size_t count)
+    {
+        static_assert(std::is_trivially_copyable_v<T> == true);
+
+        const size_t arraySize = count * sizeof(T);
+        if (m_size + arraySize > m_staging.size())
+        {
+            flush();
+        }
+
+        if (arraySize >= m_staging.size())
+        {
+            m_written = m_written && (std::fwrite(pValues, sizeof(T), count, m_pFile) == count);
+        }
+        else
+        {
+            std::memcpy(m_staging.data() + m_size, pValues, arraySize);
+            m_size += arraySize;
+        }
+    }
+
+    /// \brief  Write the staged bytes. Return true if all the bytes so far were written.
+    bool flush()
+    {
+        m_written = m_written && (std::fwrite(m_staging.data(), 1, m_size, m_pFile) == m_size);
+        m_size = 0;
+
+        return m_written;
+    }
+
+private:
+    std::FILE* m_pFile;              ///< Destination file.
+    std::vector<uint8_t> m_staging;  ///< Staged bytes.
+    size_t m_size = 0;               ///< Count of staged bytes.
+    bool m_written = true;           ///< False after the first write error.
+};
+
+/// \brief  Return the geometric vertices indices of a face, or false if one is invalid.
+bool getFaceVertices(const ObjDatabase& objDB,
+                     const ObjEntityFace& face,
+                     std::vector<uint32_t>& faceVertices)
+{
+    const size_t verticesCount = objDB.getVerticesCount();
+    const size_t stride = face.getIndicesStride();
+    const auto [idxItr, idxEnd] = objDB.getVerticesIterators(face);
+
+    faceVertices.clear();
+    for (auto tripletItr = idxItr; tripletItr < idxEnd; tripletItr += stride)
+    {
+        if ((*tripletItr < 1) || (*tripletItr > verticesCount))
+        {
+            return false;
+        }
+
+        faceVertices.push_back(static_cast<uint32_t>(*tripletItr - 1));
+    }
+
+    return (faceVertices.size() >= 3);
+}
+
+/// \brief  Write the fan triangles of a polygon.
+void writeFanTriangles(StagingWriter& writer,
+                       const std::vector<uint32_t>& faceVertices,
+                       const bool withPlyCount)
+{
+    for (size_t cornerIdx = 2; cornerIdx < faceVertices.size(); ++cornerIdx)
+    {
+        if (withPlyCount == true)
+        {
+            writer.write(uint8_t{3});
+        }
+        writer.write(faceVertices[0]);
+        writer.write(faceVertices[cornerIdx - 1]);
+        writer.write(faceVertices[cornerIdx]);
+    }
+}
+
+/// \brief  Write the geometric vertices of an Obj database as x, y, z floats.
+void writeDatabasePositions(StagingWriter& writer, const ObjDatabase& objDB)
+{
+    objDB.forEachVertex(ElementType::VERTEX, [&writer](const Vertex_t& vtx) {
+        writer.write(vtx.m_x);
+        writer.write(vtx.m_y);
+        writer.write(vtx.m_z);
+    });
+}
+
+/// \brief  Write a render mesh's buffer to a raw file, without staging.
+template<typename T>
+bool writeRawFile(const std::filesystem::path& filePath, const std::vector<T>& values)
+{
+    const FilePtr_t smtFile = openFile(filePath);
+
+    return (smtFile != nullptr) &&
+           (std::fwrite(values.data(), sizeof(T), values.size(), smtFile.get()) == values.size());
+}
+
+}  // namespace
+
+// =================================================================================================
+
+bool ObjPlyExporter::exportFile(const std::filesystem::path& plyFilePath) const
+{
+    OBJASSERT(isLittleEndianHost() == true, "Big-endian hosts are not supported");
+    if (isLittleEndianHost() == false)
+    {
+        return false;
+    }
+
+    const FilePtr_t smtPlyFile = openFile(plyFilePath);
+    if (smtPlyFile == nullptr)
+    {
+        return false;
+    }
+
+    // The elements counts are written in the header: count the database's valid polygons first.
+    size_t verticesCount = 0;
+    size_t facesCount = 0;
+    std::vector<uint32_t> faceVertices;
+
+    if (m_pObjDB != nullptr)
+    {
+        verticesCount = m_pObjDB->getVerticesCount();
+        std::for_each(m_pObjDB->cbegin<ElementType::FACE>(),
+                      m_pObjDB->cend<ElementType::FACE>(),
+                      [this, &facesCount, &faceVertices](const ObjEntityFace& face) {
+                          if (getFaceVertices(*m_pObjDB, face, faceVertices) == true)
+                          {
+                              facesCount += (faceVertices.size() <= maxPlyCorners) ?
+                                                1 :
+                                                faceVertices.size() - 2;
+                          }
+                      });
+    }
+    else
+    {
+        verticesCount = m_pRenderMesh->getVerticesCount();
+        facesCount = m_pRenderMesh->getTrianglesCount();
+    }
+
+    const bool hasNormals = (m_pRenderMesh != nullptr) && (m_pRenderMesh->hasNormals() == true);
+    const bool hasTexCoords = (m_pRenderMesh != nullptr) &&
+                              (m_pRenderMesh->hasTexCoords() == true);
+
+    ObjUtils::TextBuffer header(1024);
+    header.append("ply\nformat binary_little_endian 1.0\ncomment Written by dotObjParser\n");
+    header.append("element vertex ").append(verticesCount).append('\n');
+    header.append("property float x\nproperty float y\nproperty float z\n");
+    if (hasNormals == true)
+    {
+        header.append("property float nx\nproperty float ny\nproperty float nz\n");
+    }
+    if (hasTexCoords == true)
+    {
+        header.append("property float s\nproperty float t\n");
+    }
+    header.append("element face ").append(facesCount).append('\n');
+    header.append("property list uchar uint vertex_indices\nend_header\n");
+    if (header.flush(smtPlyFile.get()) == false)
+    {
+        return false;
+    }
+
+    StagingWriter writer(smtPlyFile.get());
+
+    if (m_pObjDB != nullptr)
+    {
+        writeDatabasePositions(writer, *m_pObjDB);
+
+        std::for_each(m_pObjDB->cbegin<ElementType::FACE>(),
+                      m_pObjDB->cend<ElementType::FACE>(),
+                      [this, &writer, &faceVertices](const ObjEntityFace& face) {
+                          if (getFaceVertices(*m_pObjDB, face, faceVertices) == false)
+                          {
+                              return;
+                          }
+
+                          if (faceVertices.size() <= maxPlyCorners)
+                          {
+                              writer.write(static_cast<uint8_t>(faceVertices.size()));
+                              writer.writeArray(faceVertices.data(), faceVertices.size());
+                          }
+                          else
+                          {
+                              writeFanTriangles(writer, faceVertices, true);
+                          }
+                      });
+    }
+    else
+    {
+        const std::vector<float>& positions = m_pRenderMesh->getPositions();
+        const std::vector<float>& normals = m_pRenderMesh->getNormals();
+        const std::vector<float>& texCoords = m_pRenderMesh->getTexCoords();
+
+        // The positions are written as is when they are the only vertices' properties.
+        if ((hasNormals == false) && (hasTexCoords == false))
+        {
+            writer.writeArray(positions.data(), positions.size());
+        }
+        else
+        {
+            for (size_t vtxIdx = 0; vtxIdx < verticesCount; ++vtxIdx)
+            {
+                writer.writeArray(positions.data() + vtxIdx * 3, 3);
+                if (hasNormals == true)
+                {
+                    writer.writeArray(normals.data() + vtxIdx * 3, 3);
+                }
+                if (hasTexCoords == true)
+                {
+                    writer.writeArray(texCoords.data() + vtxIdx * 2, 2);
+                }
+            }
+        }
+
+        const std::vector<uint32_t>& indices = m_pRenderMesh->getIndices();
+        for (size_t firstIdx = 0; firstIdx < indices.size(); firstIdx += 3)
+        {
+            writer.write(uint8_t{3});
+            writer.writeArray(indices.data() + firstIdx, 3);
+        }
+    }
+
+    return writer.flush();
+}
+
+// =================================================================================================
+
+bool ObjRawBuffersExporter::exportFiles(const std::filesystem::path& basePath) const
+{
+    OBJASSERT(isLittleEndianHost() == true, "Big-endian hosts are not supported");
+    if (isLittleEndianHost() == false)
+    {
+        return false;
+    }
+
+    const std::string basePathStr = basePath;
+
+    // The render mesh's buffers are already contiguous, they are written as is.
+    if (m_pRenderMesh != nullptr)
+    {
+        bool written = writeRawFile(basePathStr + ".positions.f32",
+                                    m_pRenderMesh->getPositions()) &&
+                       writeRawFile(basePathStr + ".indices.u32", m_pRenderMesh->getIndices());
+        if (m_pRenderMesh->hasNormals() == true)
+        {
+            written = written &&
+                      writeRawFile(basePathStr + ".normals.f32", m_pRenderMesh->getNormals());
+        }
+        if (m_pRenderMesh->hasTexCoords() == true)
+        {
+            written = written &&
+                      writeRawFile(basePathStr + ".texcoords.f32", m_pRenderMesh->getTexCoords());
+        }
+
+        return written;
+    }
+
+    // The database's vertices and faces are streamed through the staging buffer.
+    const FilePtr_t smtPositionsFile = openFile(basePathStr + ".positions.f32");
+    const FilePtr_t smtIndicesFile = openFile(basePathStr + ".indices.u32");
+    if ((smtPositionsFile == nullptr) || (smtIndicesFile == nullptr))
+    {
+        return false;
+    }
+
+    StagingWriter positionsWriter(smtPositionsFile.get());
+    writeDatabasePositions(positionsWriter, *m_pObjDB);
+
+    StagingWriter indicesWriter(smtIndicesFile.get());
+    std::vector<uint32_t> faceVertices;
+    std::for_each(m_pObjDB->cbegin<ElementType::FACE>(),
+                  m_pObjDB->cend<ElementType::FACE>(),
+                  [this, &indicesWriter, &faceVertices](const ObjEntityFace& face) {
+                      if (getFaceVertices(*m_pObjDB, face, faceVertices) == true)
+                      {
+                          writeFanTriangles(indicesWriter, faceVertices, false);
+                      }
+                  });
+
+    return positionsWriter.flush() && indicesWriter.flush();
+}
@@ -0,0 +1,572 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ObjCacheDaemon.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "ObjCacheDaemon.h"
+
+#include "ObjFileParser.h"
+#include "Utils.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <exception>
+#include <vector>
+
+#include <unistd.h>
+
+#if defined(__linux__) && __has_include(<sys/un.h>)
+#define OBJ_HAS_UNIX_SOCKETS
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#endif
+
+#if defined(__linux__) && __has_include(<sys/inotify.h>)
+#define OBJ_HAS_INOTIFY
+#include <sys/inotify.h>
+#endif
+
+namespace
+{
+constexpr size_t MAX_REQUEST_SIZE = 16 * 1024;  ///< Longest request line.
+
+#ifdef OBJ_HAS_UNIX_SOCKETS
+/// \brief  Set the address of a Unix domain socket.
+///
+/// \return false if the path is too long.
+bool setSocketAddress(const std::filesystem::path& socketPath, sockaddr_un& address)
+{
+    const std::string& pathStr = socketPath.native();
+    if (pathStr.size() >= sizeof(address.sun_path))
+    {
+        OBJLOG("Socket path too long : ", pathStr);
+        return false;
+    }
+
+    address = {};
+    address.sun_family = AF_UNIX;
+    std::copy(pathStr.cbegin(), pathStr.cend(), address.sun_path);
+
+    return true;
+}
+
+/// \brief  Send a whole text through a socket.
+///
+/// \return false if the peer is gone.
+bool sendAll(const int fd, std::string_view text)
+{
+    while (text.empty() == false)
+    {
+        const ssize_t sentSize = send(fd, text.data(), text.size(), MSG_NOSIGNAL);
+        if (sentSize < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            return false;
+        }
+
+        text.remove_prefix(static_cast<size_t>(sentSize));
+    }
+
+    return true;
+}
+#endif
+
+}  // namespace
+
+// =================================================================================================
+
+ObjCacheDaemon::ObjCacheDaemon(std::filesystem::path socketPath, const size_t memoryBudget)
+    : m_socketPath(std::move(socketPath)), m_memoryBudget(memoryBudget), m_wakeFds{-1, -1}
+{
+#ifdef OBJ_HAS_UNIX_SOCKETS
+    // requestStop() must not block, even when called repeatedly, nor run() when draining it.
+    if (pipe2(m_wakeFds.data(), O_NONBLOCK | O_CLOEXEC) != 0)
+    {
+        m_wakeFds = {-1, -1};
+    }
+#endif
+
+#ifdef OBJ_HAS_INOTIFY
+    m_inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+#endif
+}
+
+// =================================================================================================
+
+ObjCacheDaemon::~ObjCacheDaemon()
+{
+    for (const auto& [objFilePath, cachedFile] : m_cachedFiles)
+    {
+        ObjSharedDatabase::unpublish(cachedFile.m_segmentName);
+    }
+
+#ifdef OBJ_HAS_UNIX_SOCKETS
+    for (const int fd : {m_wakeFds[0], m_wakeFds[1], m_inotifyFd})
+    {
+        if (fd != -1)
+        {
+            close(fd);
+        }
+    }
+#endif
+}
+
+// =================================================================================================
+
+bool ObjCacheDaemon::run()
+{
+#ifdef OBJ_HAS_UNIX_SOCKETS
+    sockaddr_un address;
+    if ((m_wakeFds[0] == -1) || (setSocketAddress(m_socketPath, address) == false))
+    {
+        return false;
+    }
+
+    const int listenFd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (listenFd == -1)
+    {
+        return false;
+    }
+
+    // Replace the socket left by a previous daemon.
+    unlink(address.sun_path);
+    if ((bind(listenFd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) ||
+        (listen(listenFd, SOMAXCONN) != 0))
+    {
+        OBJLOG("Unable to listen on : ", m_socketPath.string());
+        close(listenFd);
+        return false;
+    }
+
+    /// \brief Connected client and its request being received.
+    struct Client
+    {
+        int m_fd;               ///< Client's socket.
+        std::string m_request;  ///< Received part of the request.
+    };
+
+    std::vector<Client> clients;
+    std::vector<pollfd> pollFds;
+
+    bool isStopRequested = false;
+    while (isStopRequested == false)
+    {
+        pollFds.clear();
+        pollFds.push_back({m_wakeFds[0], POLLIN, 0});
+        pollFds.push_back({listenFd, POLLIN, 0});
+        pollFds.push_back({m_inotifyFd, POLLIN, 0});
+        for (const Client& client : clients)
+        {
+            pollFds.push_back({client.m_fd, POLLIN, 0});
+        }
+
+        if (poll(pollFds.data(), pollFds.size(), -1) == -1)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            break;
+        }
+
+        isStopRequested = (pollFds[0].revents != 0);
+
+        if (pollFds[2].revents != 0)
+        {
+            readFilesChanges();
+        }
+
+        // From the last client, so that the closed ones are removed in place.
+        for (size_t clientIdx = clients.size(); clientIdx-- > 0;)
+        {
+            Client& client = clients[clientIdx];
+            if (pollFds[3 + clientIdx].revents == 0)
+            {
+                continue;
+            }
+
+            std::array<char, 4096> received;
+            const ssize_t receivedSize = recv(client.m_fd, received.data(), received.size(), 0);
+            bool isClientValid = (receivedSize > 0);
+            if (isClientValid == true)
+            {
+                client.m_request.append(received.data(), static_cast<size_t>(receivedSize));
+            }
+
+            for (size_t lineEnd = client.m_request.find('\n');
+                 (isClientValid == true) && (lineEnd != std::string::npos);
+                 lineEnd = client.m_request.find('\n'))
+            {
+                std::string_view request(client.m_request.data(), lineEnd);
+                if ((request.empty() == false) && (request.back() == '\r'))
+                {
+                    request.remove_suffix(1);
+                }
+
+                isClientValid = sendAll(client.m_fd, answerRequest(request) + '\n');
+                client.m_request.erase(0, lineEnd + 1);
+            }
+
+            if ((isClientValid == false) || (client.m_request.size() > MAX_REQUEST_SIZE))
+            {
+                close(client.m_fd);
+                clients.erase(clients.begin() + clientIdx);
+            }
+        }
+
+        if (pollFds[1].revents != 0)
+        {
+            if (const int clientFd = accept4(listenFd, nullptr, nullptr, SOCK_CLOEXEC);
+                clientFd != -1)
+            {
+                clients.push_back({clientFd, {}});
+            }
+        }
+    }
+
+    for (const Client& client : clients)
+    {
+        close(client.m_fd);
+    }
+
+    close(listenFd);
+    unlink(address.sun_path);
+
+    // Ready to run again.
+    for (std::array<char, 64> drained; read(m_wakeFds[0], drained.data(), drained.size()) > 0;)
+    {
+    }
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+// =================================================================================================
+
+void ObjCacheDaemon::requestStop()
+{
+#ifdef OBJ_HAS_UNIX_SOCKETS
+    const char stop = 0;
+    const ssize_t writtenSize = write(m_wakeFds[1], &stop, 1);
+    (void)writtenSize;
+#endif
+}
+
+// =================================================================================================
+
+std::optional<ObjSharedDatabase> ObjCacheDaemon::fetch(const std::filesystem::path& socketPath,
+                                                       const std::filesystem::path& objFilePath)
+{
+    std::error_code errCode;
+    const std::filesystem::path absolutePath = std::filesystem::absolute(objFilePath, errCode);
+    if (errCode.value() != 0)
+    {
+        return std::nullopt;
+    }
+
+    // A segment dropped between the answer and its attachment is requested again.
+    for (uint8_t attemptIdx = 0; attemptIdx < 2; ++attemptIdx)
+    {
+        const auto answer = sendRequest(socketPath, "GET " + absolutePath.string());
+        if ((answer.has_value() == false) || (answer->compare(0, 3, "OK ") != 0))
+        {
+            return std::nullopt;
+        }
+
+        const size_t nameEnd = answer->find(' ', 3);
+        if (auto sharedDB = ObjSharedDatabase::attach(answer->substr(3, nameEnd - 3));
+            sharedDB.has_value() == true)
+        {
+            return sharedDB;
+        }
+    }
+
+    return std::nullopt;
+}
+
+// =================================================================================================
+
+std::optional<std::string> ObjCacheDaemon::sendRequest(const std::filesystem::path& socketPath,
+                                                       const std::string& request)
+{
+#ifdef OBJ_HAS_UNIX_SOCKETS
+    sockaddr_un address;
+    if (setSocketAddress(socketPath, address) == false)
+    {
+        return std::nullopt;
+    }
+
+    const int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd == -1)
+    {
+        return std::nullopt;
+    }
+
+    std::string answer;
+    bool isAnswered = (connect(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) ==
+                       0) &&
+                      (sendAll(fd, request + '\n') == true);
+
+    std::array<char, 1024> received;
+    while ((isAnswered == true) && (answer.find('\n') == std::string::npos))
+    {
+        const ssize_t receivedSize = recv(fd, received.data(), received.size(), 0);
+        if ((receivedSize < 0) && (errno == EINTR))
+        {
+            continue;
+        }
+
+        isAnswered = (receivedSize > 0);
+        if (isAnswered == true)
+        {
+            answer.append(received.data(), static_cast<size_t>(receivedSize));
+        }
+    }
+
+    close(fd);
+
+    if (isAnswered == false)
+    {
+        return std::nullopt;
+    }
+
+    answer.resize(answer.find('\n'));
+
+    return answer;
+#else
+    (void)socketPath;
+    (void)request;
+
+    return std::nullopt;
+#endif
+}
+
+// =================================================================================================
+
+std::string ObjCacheDaemon::answerRequest(std::string_view request)
+{
+    constexpr std::string_view getRequest = "GET ";
+
+    if (request.compare(0, getRequest.size(), getRequest) == 0)
+    {
+        std::error_code errCode;
+        const std::filesystem::path objFilePath =
+            std::filesystem::weakly_canonical(request.substr(getRequest.size()), errCode);
+        if (errCode.value() != 0)
+        {
+            return "ERR invalid path";
+        }
+
+        const auto cachedFile = getCachedFile(objFilePath.string());
+        if (cachedFile.has_value() == false)
+        {
+            return "ERR unable to parse " + objFilePath.string();
+        }
+
+        return "OK " + cachedFile->get().m_segmentName + ' ' +
+               std::to_string(cachedFile->get().m_segmentSize);
+    }
+
+    if (request == "STATS")
+    {
+        return "OK " + std::to_string(m_cachedFiles.size()) + ' ' + std::to_string(m_cachedBytes) +
+               ' ' + std::to_string(m_hitsCount) + ' ' + std::to_string(m_missesCount);
+    }
+
+    return "ERR unknown request";
+}
+
+// =================================================================================================
+
+std::optional<std::reference_wrapper<const ObjCacheDaemon::CachedFile>>
+ObjCacheDaemon::getCachedFile(const std::string& objFilePath)
+{
+    std::error_code errCode;
+    const std::filesystem::file_time_type fileTime =
+        std::filesystem::last_write_time(objFilePath, errCode);
+    const uintmax_t fileSize =
+        (errCode.value() == 0) ? std::filesystem::file_size(objFilePath, errCode) : 0;
+    const bool isFileFound = (errCode.value() == 0);
+
+    if (const auto fileItr = m_cachedFiles.find(objFilePath); fileItr != m_cachedFiles.end())
+    {
+        CachedFile& cachedFile = fileItr->second;
+        if ((isFileFound == true) && (cachedFile.m_fileTime == fileTime) &&
+            (cachedFile.m_fileSize == fileSize))
+        {
+            m_lruFiles.splice(m_lruFiles.begin(), m_lruFiles, cachedFile.m_lruItr);
+            ++m_hitsCount;
+
+            return cachedFile;
+        }
+
+        // Changed while unwatched.
+        dropFile(objFilePath);
+    }
+
+    if (isFileFound == false)
+    {
+        return std::nullopt;
+    }
+
+    ++m_missesCount;
+
+    // Watched before the parsing, so that a change during the parsing drops the file.
+    int watch = -1;
+#ifdef OBJ_HAS_INOTIFY
+    if (m_inotifyFd != -1)
+    {
+        watch = inotify_add_watch(m_inotifyFd,
+                                  objFilePath.c_str(),
+                                  IN_MODIFY | IN_ATTRIB | IN_CLOSE_WRITE | IN_DELETE_SELF |
+                                      IN_MOVE_SELF);
+    }
+#endif
+
+    // A malformed or unreadable file is answered an error, the daemon keeps serving.
+    std::optional<ObjDatabase> objDB;
+    try
+    {
+        ObjFileParser fp(objFilePath);
+        objDB = fp.parseFile();
+    }
+    catch (const std::exception& exc)
+    {
+        OBJLOG("Obj file not cached : ", objFilePath, " : ", exc.what());
+    }
+
+    // Segments are never renamed: the processes attached to a dropped one keep it.
+    const std::string segmentName =
+        "objparser-" + std::to_string(getpid()) + '-' + std::to_string(m_segmentsCount++);
+
+    std::optional<ObjSharedDatabase> sharedDB;
+    if ((objDB.has_value() == true) && (objDB->isEmpty() == false) &&
+        (ObjSharedDatabase::publish(*objDB, segmentName) == true))
+    {
+        sharedDB = ObjSharedDatabase::attach(segmentName);
+    }
+
+    if (sharedDB.has_value() == false)
+    {
+#ifdef OBJ_HAS_INOTIFY
+        if (watch != -1)
+        {
+            inotify_rm_watch(m_inotifyFd, watch);
+        }
+#endif
+        return std::nullopt;
+    }
+
+    m_lruFiles.push_front(objFilePath);
+
+    CachedFile& cachedFile = m_cachedFiles[objFilePath];
+    cachedFile.m_segmentName = segmentName;
+    cachedFile.m_segmentSize = sharedDB->getSegmentSize();
+    cachedFile.m_fileTime = fileTime;
+    cachedFile.m_fileSize = fileSize;
+    cachedFile.m_watch = watch;
+    cachedFile.m_lruItr = m_lruFiles.begin();
+
+    if (watch != -1)
+    {
+        m_watchedFiles[watch] = objFilePath;
+    }
+
+    m_cachedBytes += cachedFile.m_segmentSize;
+    enforceMemoryBudget();
+
+    return cachedFile;
+}
+
+// =================================================================================================
+
+void ObjCacheDaemon::enforceMemoryBudget()
+{
+    while ((m_cachedBytes > m_memoryBudget) && (m_lruFiles.size() > 1))
+    {
+        const std::string lruFilePath = m_lruFiles.back();
+        dropFile(lruFilePath);
+    }
+}
+
+// =================================================================================================
+
+void ObjCacheDaemon::dropFile(const std::string& objFilePath)
+{
+    const auto fileItr = m_cachedFiles.find(objFilePath);
+    if (fileItr == m_cachedFiles.end())
+    {
+        return;
+    }
+
+    const CachedFile& cachedFile = fileItr->second;
+
+    ObjSharedDatabase::unpublish(cachedFile.m_segmentName);
+
+    if (cachedFile.m_watch != -1)
+    {
+#ifdef OBJ_HAS_INOTIFY
+        inotify_rm_watch(m_inotifyFd, cachedFile.m_watch);
+#endif
+        m_watchedFiles.erase(cachedFile.m_watch);
+    }
+
+    m_cachedBytes -= cachedFile.m_segmentSize;
+    m_lruFiles.erase(cachedFile.m_lruItr);
+    m_cachedFiles.erase(fileItr);
+}
+
+// =================================================================================================
+
+void ObjCacheDaemon::readFilesChanges()
+{
+#ifdef OBJ_HAS_INOTIFY
+    alignas(inotify_event) std::array<char, 4096> events;
+
+    for (ssize_t readSize = read(m_inotifyFd, events.data(), events.size()); readSize > 0;
+         readSize = read(m_inotifyFd, events.data(), events.size()))
+    {
+        for (const char* pEvent = events.data(); pEvent < events.data() + readSize;)
+        {
+            const inotify_event& event = *reinterpret_cast<const inotify_event*>(pEvent);
+            if (const auto watchItr = m_watchedFiles.find(event.wd);
+                watchItr != m_watchedFiles.end())
+            {
+                const std::string changedFilePath = watchItr->second;
+                dropFile(changedFilePath);
+            }
+
+            pEvent += sizeof(inotify_event) + event.len;
+        }
+    }
+#endif
+}
@@ -0,0 +1,353 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ObjCompressedStreamReader.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "ObjCompressedStreamReader.h"
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <optional>
+
+#ifdef OBJ_HAS_ZLIB
+#include <zlib.h>
+#endif
+
+#ifdef OBJ_HAS_ZSTD
+#include <zstd.h>
+#endif
+
+namespace
+{
+/// Size of the compressed blocks read from the file.
+constexpr size_t compressedBlockSize = 128 * 1024;
+
+/// Decompresses the next bytes of a file: count of bytes, 0 at the end, std::nullopt on error.
+using Decoder_t = std::function<std::optional<size_t>(char* pBuffer, const size_t size)>;
+
+/// \brief  Return the decoder of an uncompressed file.
+Decoder_t makeRawDecoder(const std::filesystem::path& filePath)
+{
+    std::FILE* pFile = fopen(filePath.c_str(), "rb");
+    if (pFile == nullptr)
+    {
+        return nullptr;
+    }
+
+    const std::shared_ptr<std::FILE> spFile(pFile, &fclose);
+
+    return [spFile](char* pBuffer, const size_t size) -> std::optional<size_t> {
+        const size_t readSize = std::fread(pBuffer, 1, size, spFile.get());
+        if ((readSize == 0) && (std::ferror(spFile.get()) != 0))
+        {
+            return std::nullopt;
+        }
+
+        return readSize;
+    };
+}
+
+#ifdef OBJ_HAS_ZLIB
+/// \brief  Return the decoder of a gzip file, concatenated members included.
+Decoder_t makeGzipDecoder(const std::filesystem::path& filePath)
+{
+    gzFile pGzFile = gzopen(filePath.c_str(), "rb");
+    if (pGzFile == nullptr)
+    {
+        return nullptr;
+    }
+
+    gzbuffer(pGzFile, compressedBlockSize);
+    const std::shared_ptr<gzFile_s> spGzFile(pGzFile, &gzclose);
+
+    return [spGzFile](char* pBuffer, const size_t size) -> std::optional<size_t> {
+        const int readSize = gzread(spGzFile.get(),
+                                    pBuffer,
+                                    static_cast<unsigned int>(std::min<size_t>(size, INT_MAX)));
+        if (readSize < 0)
+        {
+            return std::nullopt;
+        }
+
+        // A member cut short ends the reading with a buffer error.
+        int errorCode = Z_OK;
+        gzerror(spGzFile.get(), &errorCode);
+        if ((readSize == 0) && (errorCode != Z_OK))
+        {
+            return std::nullopt;
+        }
+
+        return static_cast<size_t>(readSize);
+    };
+}
+#endif
+
+#ifdef OBJ_HAS_ZSTD
+/// \brief  Return the decoder of a zstd file, concatenated frames included.
+Decoder_t makeZstdDecoder(const std::filesystem::path& filePath)
+{
+    /// \brief Decompression state shared by the decoder's copies.
+    struct ZstdState
+    {
+        std::unique_ptr<std::FILE, decltype(&fclose)> m_smtFile;
+        std::unique_ptr<ZSTD_DStream, decltype(&ZSTD_freeDStream)> m_smtStream;
+        std::vector<char> m_input = std::vector<char>(compressedBlockSize);
+        ZSTD_inBuffer m_inBuffer = {nullptr, 0, 0};
+        size_t m_frameRemainder = 0;  ///< 0 between two frames.
+    };
+
+    auto spState = std::make_shared<ZstdState>(
+        ZstdState{{fopen(filePath.c_str(), "rb"), &fclose},
+                  {ZSTD_createDStream(), &ZSTD_freeDStream}});
+    if ((spState->m_smtFile == nullptr) || (spState->m_smtStream == nullptr))
+    {
+        return nullptr;
+    }
+
+    ZSTD_initDStream(spState->m_smtStream.get());
+    spState->m_inBuffer.src = spState->m_input.data();
+
+    return [spState](char* pBuffer, const size_t size) -> std::optional<size_t> {
+        ZstdState& state = *spState;
+
+        ZSTD_outBuffer outBuffer = {pBuffer, size, 0};
+        while (outBuffer.pos == 0)
+        {
+            if (state.m_inBuffer.pos == state.m_inBuffer.size)
+            {
+                state.m_inBuffer.size = std::fread(state.m_input.data(),
+                                                   1,
+                                                   state.m_input.size(),
+                                                   state.m_smtFile.get());
+                state.m_inBuffer.pos = 0;
+
+                // A frame cut short is an error.
+                if (state.m_inBuffer.size == 0)
+                {
+                    return (state.m_frameRemainder == 0) ? std::optional<size_t>(0) : std::nullopt;
+                }
+            }
+
+            state.m_frameRemainder = ZSTD_decompressStream(state.m_smtStream.get(),
+                                                           &outBuffer,
+                                                           &state.m_inBuffer);
+            if (ZSTD_isError(state.m_frameRemainder) != 0)
+            {
+                return std::nullopt;
+            }
+        }
+
+        return outBuffer.pos;
+    };
+}
+#endif
+
+/// \brief  Return the decoder of a file, nullptr if it cannot be opened or its codec is missing.
+Decoder_t makeDecoder(const std::filesystem::path& filePath,
+                      const ObjCompressedStreamReader::Compression compression)
+{
+    switch (compression)
+    {
+#ifdef OBJ_HAS_ZLIB
+    case ObjCompressedStreamReader::Compression::GZIP: return makeGzipDecoder(filePath);
+#endif
+#ifdef OBJ_HAS_ZSTD
+    case ObjCompressedStreamReader::Compression::ZSTD: return makeZstdDecoder(filePath);
+#endif
+    case ObjCompressedStreamReader::Compression::NONE: return makeRawDecoder(filePath);
+
+    default: return nullptr;
+    }
+}
+
+}  // namespace
+
+// =================================================================================================
+
+ObjCompressedStreamReader::ObjCompressedStreamReader(const std::filesystem::path& filePath,
+                                                     const size_t blockSize,
+                                                     const size_t blocksCount) :
+    m_blocks(std::max<size_t>(blocksCount, 2), std::vector<char>(std::max<size_t>(blockSize, 1))),
+    m_blocksSizes(m_blocks.size(), 0)
+{
+    m_decompressor = std::thread(&ObjCompressedStreamReader::runDecompressor, this, filePath);
+}
+
+// =================================================================================================
+
+ObjCompressedStreamReader::~ObjCompressedStreamReader()
+{
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        m_isStopping = true;
+    }
+    m_blockFreed.notify_one();
+
+    if (m_decompressor.joinable() == true)
+    {
+        m_decompressor.join();
+    }
+}
+
+// =================================================================================================
+
+size_t ObjCompressedStreamReader::read(char* pBuffer, const size_t size)
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_blockFilled.wait(lock, [this]() {
+            return (m_filledBlocksCount > 0) || (m_isEndOfFile == true);
+        });
+
+        if (m_filledBlocksCount == 0)
+        {
+            return 0;
+        }
+    }
+
+    // The filled block is owned by the parser until it is read to its end.
+    const size_t blockSize = m_blocksSizes[m_readBlockIdx];
+    const size_t readSize = std::min(size, blockSize - m_readPos);
+    std::memcpy(pBuffer, m_blocks[m_readBlockIdx].data() + m_readPos, readSize);
+    m_readPos += readSize;
+
+    if (m_readPos == blockSize)
+    {
+        m_readPos = 0;
+        m_readBlockIdx = (m_readBlockIdx + 1) % m_blocks.size();
+
+        {
+            const std::lock_guard<std::mutex> lock(m_mutex);
+            --m_filledBlocksCount;
+        }
+        m_blockFreed.notify_one();
+    }
+
+    return readSize;
+}
+
+// =================================================================================================
+
+ObjCompressedStreamReader::Compression
+ObjCompressedStreamReader::detectCompression(const std::filesystem::path& filePath)
+{
+    const std::unique_ptr<std::FILE, decltype(&fclose)> smtFile(fopen(filePath.c_str(), "rb"),
+                                                                &fclose);
+    if (smtFile == nullptr)
+    {
+        return Compression::NONE;
+    }
+
+    std::array<unsigned char, 4> magic = {0};
+    const size_t readSize = std::fread(magic.data(), 1, magic.size(), smtFile.get());
+
+    if ((readSize >= 2) && (magic[0] == 0x1F) && (magic[1] == 0x8B))
+    {
+        return Compression::GZIP;
+    }
+    if ((readSize == 4) && (magic == std::array<unsigned char, 4>{0x28, 0xB5, 0x2F, 0xFD}))
+    {
+        return Compression::ZSTD;
+    }
+
+    return Compression::NONE;
+}
+
+// =================================================================================================
+
+bool ObjCompressedStreamReader::isCompressionAvailable(const Compression compression)
+{
+    switch (compression)
+    {
+#ifdef OBJ_HAS_ZLIB
+    case Compression::GZIP: return true;
+#endif
+#ifdef OBJ_HAS_ZSTD
+    case Compression::ZSTD: return true;
+#endif
+    case Compression::NONE: return true;
+
+    default: return false;
+    }
+}
+
+// =================================================================================================
+
+void ObjCompressedStreamReader::runDecompressor(const std::filesystem::path filePath)
+{
+    const Decoder_t decoder = makeDecoder(filePath, detectCompression(filePath));
+    if (decoder == nullptr)
+    {
+        {
+            const std::lock_guard<std::mutex> lock(m_mutex);
+            m_isEndOfFile = true;
+            m_hasFailed = true;
+        }
+        m_blockFilled.notify_one();
+
+        return;
+    }
+
+    bool isEndOfFile = false;
+    for (size_t blockIdx = 0; isEndOfFile == false; blockIdx = (blockIdx + 1) % m_blocks.size())
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_blockFreed.wait(lock, [this]() {
+                return (m_filledBlocksCount < m_blocks.size()) || (m_isStopping == true);
+            });
+
+            if (m_isStopping == true)
+            {
+                return;
+            }
+        }
+
+        // The free block is owned by the decompressor until it is filled.
+        std::vector<char>& block = m_blocks[blockIdx];
+        size_t blockSize = 0;
+        bool hasFailed = false;
+        while ((blockSize < block.size()) && (isEndOfFile == false))
+        {
+            const std::optional<size_t> decodedSize = decoder(block.data() + blockSize,
+                                                              block.size() - blockSize);
+            hasFailed = (decodedSize.has_value() == false);
+            isEndOfFile = (hasFailed == true) || (*decodedSize == 0);
+            blockSize += decodedSize.value_or(0);
+        }
+
+        // An empty block only ends the file, it is not handed over.
+        {
+            const std::lock_guard<std::mutex> lock(m_mutex);
+            m_blocksSizes[blockIdx] = blockSize;
+            m_filledBlocksCount += (blockSize > 0) ? 1 : 0;
+            m_isEndOfFile = isEndOfFile;
+            m_hasFailed = hasFailed;
+        }
+        m_blockFilled.notify_one();
+    }
+}
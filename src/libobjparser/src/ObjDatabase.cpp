@@ -25,11 +25,41 @@
 
 #include "ObjDatabase.h"
 
+#include "ParallelUtils.h"
 #include "Utils.h"
+
 #include <algorithm>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <unordered_map>
+
+ObjDatabase::ObjDatabase(const std::shared_ptr<std::pmr::memory_resource>& spBuffersMemory)
+{
+    // The buffers are empty, assigning them propagates their allocators.
+    m_IdxBuffer = IndexBuffer_t(IndexBuffer_t::allocator_type(spBuffersMemory));
+
+    const VertexBuffer_t::value_type::allocator_type vtxAllocator(spBuffersMemory);
+    for (auto& vBuffer : m_vertexBuffer)
+    {
+        vBuffer = VertexBuffer_t::value_type(vtxAllocator);
+    }
+
+    m_faceBuffer = FaceBuffer_t(FaceBuffer_t::allocator_type(spBuffersMemory));
+    m_groupBuffer = GroupBuffer_t(GroupBuffer_t::allocator_type(spBuffersMemory));
+    m_allEntitiesTable = EntitiesTable_t(EntitiesTable_t::allocator_type(spBuffersMemory));
+}
+
+// =================================================================================================
 
 VerticesRefList_t ObjDatabase::getVerticesList(const VertexBasedEntity& elemWithVertices) const
 {
+    if (m_pQuantizedVertices != nullptr)
+    {
+        throw std::logic_error("Quantized vertices cannot be referenced");
+    }
+
     const auto [rangeBegin, rangeEnd] = elemWithVertices.getVerticesIndicesRange();
     const VerticesIdxOrganization vtxIdxOrg = elemWithVertices.getVerticesIndicesOrganization();
 
@@ -77,23 +107,527 @@ ObjDatabase::getVerticesIterators(const VertexBasedEntity& elemWithVertices) con
 
 // =================================================================================================
 
-EntitiesRefList_t ObjDatabase::getEntitiesInGroup(const ObjEntityGroup& group) const
+const ObjEntity& ObjDatabase::getEntity(const size_t entityTableIdx) const
 {
-    const std::vector<EntitiesIndexRange_t>& entIdxRange = group.getEntitiesIndicesRange();
+    OBJASSERT(entityTableIdx < m_allEntitiesTable.size(), "Invalid entity index");
 
-    EntitiesRefList_t includedEntities;
+    const auto [entityType, bufferIdx] = m_allEntitiesTable[entityTableIdx];
 
-    std::for_each(entIdxRange.cbegin(),
-                  entIdxRange.cend(),
-                  [this, &includedEntities](const EntitiesIndexRange_t& range) {
-                      const auto [begin, end] = range;
+    if ((m_pQuantizedVertices != nullptr) && (entityType <= ElementType::VERTEX_NORMAL))
+    {
+        throw std::logic_error("Quantized vertices cannot be referenced");
+    }
 
-                      includedEntities.reserve(end - begin + 1);
+    switch (entityType)
+    {
+    case ElementType::VERTEX: return m_vertexBuffer[0][bufferIdx];
+    case ElementType::VERTEX_TEXTURE: return m_vertexBuffer[1][bufferIdx];
+    case ElementType::VERTEX_NORMAL: return m_vertexBuffer[2][bufferIdx];
+    case ElementType::VERTEX_PARAM_SPACE: return m_vertexBuffer[3][bufferIdx];
+    case ElementType::FACE: return m_faceBuffer[bufferIdx];
 
-                      std::copy(m_allEntitiesTable.cbegin() + begin,
-                                m_allEntitiesTable.cend() + begin + end,
-                                std::back_inserter(includedEntities));
-                  });
+    // Only groups remain.
+    default: return m_groupBuffer[bufferIdx];
+    }
+}
+
+// =================================================================================================
+
+std::optional<ObjEntityVertex> ObjDatabase::getVertex(const ElementType type,
+                                                      const size_t idx) const
+{
+    if ((type > ElementType::VERTEX_PARAM_SPACE) || (idx >= getVerticesCount(type)))
+    {
+        return std::nullopt;
+    }
+
+    const uint8_t bufferIdx = getVertexBufferIdx(type);
+    if ((m_pQuantizedVertices == nullptr) || (bufferIdx == 3))
+    {
+        return m_vertexBuffer[bufferIdx][idx];
+    }
+
+    std::array<float, 3> values = {0.0f, 0.0f, 0.0f};
+    decodeQuantizedVertices(type, idx, 1, values.data());
+
+    ObjEntityVertex vtx(type);
+    std::tie(vtx.m_x, vtx.m_y, vtx.m_z) = std::tie(values[0], values[1], values[2]);
+
+    return vtx;
+}
+
+// =================================================================================================
+
+size_t ObjDatabase::decodeQuantizedVertices(const ElementType type,
+                                            const size_t first,
+                                            const size_t count,
+                                            float* pValues) const
+{
+    OBJASSERT(m_pQuantizedVertices != nullptr, "The database is not quantized");
+
+    switch (type)
+    {
+    case ElementType::VERTEX_TEXTURE:
+        m_pQuantizedVertices->decodeTexCoords(first, count, pValues);
+        return 2;
+
+    case ElementType::VERTEX_NORMAL:
+        m_pQuantizedVertices->decodeNormals(first, count, pValues);
+        return 3;
+
+    default:
+        m_pQuantizedVertices->decodePositions(first, count, pValues);
+        return 3;
+    }
+}
+
+// =================================================================================================
+
+const ObjEntity& ObjGroupEntitiesView::const_iterator::operator*() const
+{
+    return m_pObjDB->getEntity(m_entityIdx);
+}
+
+// =================================================================================================
+
+std::optional<MaterialID_t> ObjDatabase::insertMaterialName(std::string_view name)
+{
+    if (const auto materialItr = m_materialsIDs.find(name); materialItr != m_materialsIDs.cend())
+    {
+        return materialItr->second;
+    }
+
+    // NO_MATERIAL_ID is reserved.
+    if (m_materialsNames.size() >= NO_MATERIAL_ID)
+    {
+        OBJLOG("Too many materials, usemtl ignored : ", name);
+        return std::nullopt;
+    }
+
+    const MaterialID_t materialID = static_cast<MaterialID_t>(m_materialsNames.size());
+    m_materialsIDs.emplace(m_materialsNames.emplace_back(name), materialID);
+
+    return materialID;
+}
+
+// =================================================================================================
+
+void ObjDatabase::resolveMaterials()
+{
+    m_materials.assign(m_materialsNames.size(), nullptr);
+
+    for (size_t materialID = 0; materialID < m_materialsNames.size(); ++materialID)
+    {
+        for (const auto& pLibrary : m_materialLibraries)
+        {
+            if (pLibrary == nullptr)
+            {
+                continue;
+            }
+
+            if (const auto materialOpt = pLibrary->findMaterial(m_materialsNames[materialID]);
+                materialOpt.has_value() == true)
+            {
+                m_materials[materialID] = &materialOpt->get();
+                break;
+            }
+        }
+
+        if (m_materials[materialID] == nullptr)
+        {
+            OBJLOG("Material not found in the material libraries : ", m_materialsNames[materialID]);
+        }
+    }
+}
+
+// =================================================================================================
+
+ObjDatabase::Checkpoint ObjDatabase::getCheckpoint() const
+{
+    Checkpoint checkpoint;
+    checkpoint.m_indicesCount = m_IdxBuffer.size();
+    for (size_t bufferIdx = 0; bufferIdx < m_vertexBuffer.size(); ++bufferIdx)
+    {
+        checkpoint.m_verticesCounts[bufferIdx] = m_vertexBuffer[bufferIdx].size();
+    }
+    checkpoint.m_facesCount = m_faceBuffer.size();
+    checkpoint.m_groupsCount = m_groupBuffer.size();
+    checkpoint.m_entitiesCount = m_allEntitiesTable.size();
+    checkpoint.m_materialsCount = m_materialsNames.size();
+    checkpoint.m_materialLibrariesCount = m_materialLibrariesRefs.size();
+
+    return checkpoint;
+}
+
+// =================================================================================================
+
+void ObjDatabase::rollback(const Checkpoint& checkpoint)
+{
+    // Popped from the back, groups and faces are not assignable so they cannot be erased.
+    auto truncate = [](auto& buffer, const size_t count) {
+        while (buffer.size() > count)
+        {
+            buffer.pop_back();
+        }
+    };
+
+    truncate(m_IdxBuffer, checkpoint.m_indicesCount);
+    for (size_t bufferIdx = 0; bufferIdx < m_vertexBuffer.size(); ++bufferIdx)
+    {
+        truncate(m_vertexBuffer[bufferIdx], checkpoint.m_verticesCounts[bufferIdx]);
+    }
+    truncate(m_faceBuffer, checkpoint.m_facesCount);
+    truncate(m_groupBuffer, checkpoint.m_groupsCount);
+    truncate(m_allEntitiesTable, checkpoint.m_entitiesCount);
+
+    while (m_materialsNames.size() > checkpoint.m_materialsCount)
+    {
+        m_materialsIDs.erase(m_materialsNames.back());
+        m_materialsNames.pop_back();
+    }
+    truncate(m_materials, checkpoint.m_materialsCount);
+
+    truncate(m_materialLibrariesRefs, checkpoint.m_materialLibrariesCount);
+    truncate(m_materialLibraries, checkpoint.m_materialLibrariesCount);
+}
+
+// =================================================================================================
+
+ObjDatabase::DetachedEntities ObjDatabase::detach(const Checkpoint& checkpoint)
+{
+    auto detachBuffer = [](auto& buffer, const size_t count, auto& detachedBuffer) {
+        detachedBuffer.reserve(buffer.size() - count);
+        std::move(buffer.begin() + count, buffer.end(), std::back_inserter(detachedBuffer));
+    };
+
+    DetachedEntities detached;
+    detached.m_checkpoint = checkpoint;
+
+    detachBuffer(m_IdxBuffer, checkpoint.m_indicesCount, detached.m_IdxBuffer);
+    for (size_t bufferIdx = 0; bufferIdx < m_vertexBuffer.size(); ++bufferIdx)
+    {
+        detachBuffer(m_vertexBuffer[bufferIdx],
+                     checkpoint.m_verticesCounts[bufferIdx],
+                     detached.m_vertexBuffer[bufferIdx]);
+    }
+    detachBuffer(m_faceBuffer, checkpoint.m_facesCount, detached.m_faceBuffer);
+    detachBuffer(m_groupBuffer, checkpoint.m_groupsCount, detached.m_groupBuffer);
+    detachBuffer(m_allEntitiesTable, checkpoint.m_entitiesCount, detached.m_allEntitiesTable);
+    // Copied, the materials IDs are found by views of the names.
+    detached.m_materialsNames.assign(m_materialsNames.cbegin() + checkpoint.m_materialsCount,
+                                     m_materialsNames.cend());
+    detachBuffer(m_materialLibrariesRefs,
+                 checkpoint.m_materialLibrariesCount,
+                 detached.m_materialLibrariesRefs);
+    detachBuffer(m_materialLibraries,
+                 checkpoint.m_materialLibrariesCount,
+                 detached.m_materialLibraries);
+
+    // The kept groups ended after the checkpoint lose their end once reopened.
+    for (size_t grpIdx = 0; grpIdx < checkpoint.m_groupsCount; ++grpIdx)
+    {
+        const ObjEntityGroup& grp = m_groupBuffer[grpIdx];
+        const size_t rangeEnd = grp.getAllIncludedEntitiesRanges().back().second;
+        if ((grp.getType() != ElementType::OBJECT_NAME) && (rangeEnd != 0) &&
+            (rangeEnd + 1 >= checkpoint.m_entitiesCount))
+        {
+            detached.m_keptGroupsEnds.emplace(grp.getID(), rangeEnd);
+        }
+    }
+
+    rollback(checkpoint);
+
+    return detached;
+}
+
+// =================================================================================================
+
+void ObjDatabase::splice(DetachedEntities& detached,
+                         const Checkpoint& from,
+                         const std::vector<std::pair<size_t, size_t>>& continuedGroups,
+                         const std::vector<std::pair<size_t, size_t>>& relativeFaces)
+{
+    const Checkpoint& detachedAt = detached.m_checkpoint;
+    const Checkpoint to = getCheckpoint();
+
+    // Offsets of the appended entities' locations, modulo 2^64 when they move backward.
+    const size_t indicesOffset = to.m_indicesCount - from.m_indicesCount;
+    const size_t facesOffset = to.m_facesCount - from.m_facesCount;
+    const size_t groupsOffset = to.m_groupsCount - from.m_groupsCount;
+    const size_t entitiesOffset = to.m_entitiesCount - from.m_entitiesCount;
+    std::array<size_t, 4> verticesOffsets = {};
+    for (size_t bufferIdx = 0; bufferIdx < verticesOffsets.size(); ++bufferIdx)
+    {
+        verticesOffsets[bufferIdx] =
+            to.m_verticesCounts[bufferIdx] - from.m_verticesCounts[bufferIdx];
+    }
+
+    auto spliceBuffer = [](auto& detachedBuffer, const size_t first, auto& buffer) {
+        std::move(detachedBuffer.begin() + first, detachedBuffer.end(), std::back_inserter(buffer));
+    };
+
+    // The continued groups end where their detached counterparts ended.
+    for (const auto& [detachedGrpID, grpID] : continuedGroups)
+    {
+        std::optional<size_t> rangeEnd;
+        if (const auto keptEndItr = detached.m_keptGroupsEnds.find(detachedGrpID);
+            keptEndItr != detached.m_keptGroupsEnds.cend())
+        {
+            rangeEnd = keptEndItr->second;
+        }
+        else if (const auto grpOpt = detached.getGroup(detachedGrpID); grpOpt.has_value() == true)
+        {
+            rangeEnd = grpOpt->get().getAllIncludedEntitiesRanges().back().second;
+        }
+
+        std::optional<std::reference_wrapper<ObjEntityGroup>> grpOpt = getGroup(grpID);
+        OBJASSERT((rangeEnd.has_value() == true) && (grpOpt.has_value() == true),
+                  "Invalid group index");
+        if ((rangeEnd.has_value() == true) && (grpOpt.has_value() == true))
+        {
+            grpOpt->get().endIncludedEntityRange(*rangeEnd + entitiesOffset);
+        }
+    }
+
+    spliceBuffer(
+        detached.m_IdxBuffer, from.m_indicesCount - detachedAt.m_indicesCount, m_IdxBuffer);
+    for (size_t bufferIdx = 0; bufferIdx < m_vertexBuffer.size(); ++bufferIdx)
+    {
+        spliceBuffer(detached.m_vertexBuffer[bufferIdx],
+                     from.m_verticesCounts[bufferIdx] - detachedAt.m_verticesCounts[bufferIdx],
+                     m_vertexBuffer[bufferIdx]);
+    }
+    spliceBuffer(detached.m_faceBuffer, from.m_facesCount - detachedAt.m_facesCount, m_faceBuffer);
+    spliceBuffer(
+        detached.m_groupBuffer, from.m_groupsCount - detachedAt.m_groupsCount, m_groupBuffer);
+
+    for (size_t faceIdx = to.m_facesCount; faceIdx < m_faceBuffer.size(); ++faceIdx)
+    {
+        m_faceBuffer[faceIdx].offsetVerticesIndicesRange(indicesOffset);
+    }
+    for (size_t grpIdx = to.m_groupsCount; grpIdx < m_groupBuffer.size(); ++grpIdx)
+    {
+        m_groupBuffer[grpIdx].offsetIncludedEntities(entitiesOffset);
+    }
+
+    // Negative indices are relative to the vertices parsed before their face.
+    for (const auto& [firstFace, lastFace] : relativeFaces)
+    {
+        for (size_t faceIdx = firstFace + facesOffset; faceIdx < lastFace + facesOffset; ++faceIdx)
+        {
+            const ObjEntityFace& face = m_faceBuffer[faceIdx];
+
+            std::array<uint8_t, 3> idxBuffersIdxs = {0, 1, 2};
+            if (face.getVerticesIndicesOrganization() == VerticesIdxOrganization::VGEO_VNORMAL)
+            {
+                idxBuffersIdxs[1] = 2;
+            }
+
+            const size_t idxStride = face.getIndicesStride();
+            for (size_t idx = face.getFirstVertexIndex(); idx <= face.getLastVertexIndex(); ++idx)
+            {
+                const size_t cornerIdx = idx - face.getFirstVertexIndex();
+                m_IdxBuffer[idx] += verticesOffsets[idxBuffersIdxs[cornerIdx % idxStride]];
+            }
+        }
+    }
+
+    // The IDs follow the entities' locations, as given by insertEntity().
+    for (size_t entityIdx = from.m_entitiesCount - detachedAt.m_entitiesCount;
+         entityIdx < detached.m_allEntitiesTable.size();
+         ++entityIdx)
+    {
+        const auto [entityType, detachedBufferIdx] = detached.m_allEntitiesTable[entityIdx];
+        const size_t entityID = m_allEntitiesTable.size() + 1;
+
+        size_t bufferIdx = 0;
+        switch (entityType)
+        {
+        case ElementType::VERTEX:
+        case ElementType::VERTEX_TEXTURE:
+        case ElementType::VERTEX_NORMAL:
+        case ElementType::VERTEX_PARAM_SPACE:
+        {
+            const uint8_t vtxBufferIdx = getVertexBufferIdx(entityType);
+            bufferIdx = detachedBufferIdx + verticesOffsets[vtxBufferIdx];
+            m_vertexBuffer[vtxBufferIdx][bufferIdx].setID((bufferIdx != 0) ? bufferIdx : entityID);
+        }
+        break;
+
+        case ElementType::FACE:
+            bufferIdx = detachedBufferIdx + facesOffset;
+            m_faceBuffer[bufferIdx].setID(entityID);
+            break;
+
+        default:
+            bufferIdx = detachedBufferIdx + groupsOffset;
+            m_groupBuffer[bufferIdx].setID(entityID);
+            break;
+        }
+
+        m_allEntitiesTable.emplace_back(entityType, bufferIdx);
+    }
+
+    for (size_t nameIdx = from.m_materialsCount - detachedAt.m_materialsCount;
+         nameIdx < detached.m_materialsNames.size();
+         ++nameIdx)
+    {
+        insertMaterialName(detached.m_materialsNames[nameIdx]);
+    }
+    for (size_t libraryIdx = from.m_materialLibrariesCount - detachedAt.m_materialLibrariesCount;
+         libraryIdx < detached.m_materialLibrariesRefs.size();
+         ++libraryIdx)
+    {
+        insertMaterialLibrary(detached.m_materialLibrariesRefs[libraryIdx],
+                              std::move(detached.m_materialLibraries[libraryIdx]));
+    }
+}
+
+// =================================================================================================
+
+std::optional<std::reference_wrapper<const ObjEntityGroup>>
+ObjDatabase::DetachedEntities::getGroup(const size_t id) const
+{
+    if ((id <= m_checkpoint.m_entitiesCount) ||
+        (id - m_checkpoint.m_entitiesCount > m_allEntitiesTable.size()))
+    {
+        return std::nullopt;
+    }
+
+    const auto [entityType, bufferIdx] = m_allEntitiesTable[id - m_checkpoint.m_entitiesCount - 1];
+    if ((entityType != ElementType::GROUP_NAME) && (entityType != ElementType::SMOOTHING_GROUP) &&
+        (entityType != ElementType::MERGING_GROUP) && (entityType != ElementType::OBJECT_NAME))
+    {
+        return std::nullopt;
+    }
+
+    return m_groupBuffer[bufferIdx - m_checkpoint.m_groupsCount];
+}
+
+// =================================================================================================
+
+void ObjDatabase::reserve(const Checkpoint& counts)
+{
+    m_IdxBuffer.reserve(counts.m_indicesCount);
+    for (size_t bufferIdx = 0; bufferIdx < m_vertexBuffer.size(); ++bufferIdx)
+    {
+        m_vertexBuffer[bufferIdx].reserve(counts.m_verticesCounts[bufferIdx]);
+    }
+    m_faceBuffer.reserve(counts.m_facesCount);
+    m_groupBuffer.reserve(counts.m_groupsCount);
+    m_allEntitiesTable.reserve(counts.m_entitiesCount);
+}
+
+// =================================================================================================
+
+void ObjDatabase::quantizeVertices()
+{
+    if (m_pQuantizedVertices != nullptr)
+    {
+        return;
+    }
+
+    m_pQuantizedVertices = std::make_unique<ObjQuantizedVertices>(*this);
+
+    // Swapped with empty buffers, clear() would keep their memory.
+    for (size_t bufferIdx = 0; bufferIdx < 3; ++bufferIdx)
+    {
+        VertexBuffer_t::value_type(m_vertexBuffer[bufferIdx].get_allocator())
+            .swap(m_vertexBuffer[bufferIdx]);
+    }
+}
+
+// =================================================================================================
+
+ObjDatabase::FacesBatches ObjDatabase::getFacesBatches(const bool byGroup) const
+{
+    constexpr uint32_t noGroup = std::numeric_limits<uint32_t>::max();
+
+    FacesBatches facesBatches;
+
+    std::vector<uint32_t> faces(m_faceBuffer.size());
+    std::iota(faces.begin(), faces.end(), 0);
+
+    // Least significant key first: the stable material pass keeps the groups' order.
+    std::vector<std::string_view> groupsNames;
+    std::vector<uint32_t> faceGroup;
+    if (byGroup == true)
+    {
+        faceGroup.assign(m_faceBuffer.size(), noGroup);
+        std::unordered_map<std::string_view, uint32_t> groupsRanks;
+
+        for (const ObjEntityGroup& grp : m_groupBuffer)
+        {
+            const ObjGroupFacesView facesView = getFacesInGroup(grp);
+            if ((grp.getType() != ElementType::GROUP_NAME) || (facesView.empty() == true))
+            {
+                continue;
+            }
+
+            const std::string_view grpName = grp.getGroupName()->get();
+            const auto [rankItr, inserted] = groupsRanks.try_emplace(grpName, groupsNames.size());
+            if (inserted == true)
+            {
+                groupsNames.push_back(grpName);
+            }
+
+            for (const ObjEntityFace& face : facesView)
+            {
+                uint32_t& faceGroupRank = faceGroup[&face - m_faceBuffer.data()];
+                if (faceGroupRank == noGroup)
+                {
+                    faceGroupRank = rankItr->second;
+                }
+            }
+        }
+
+        // Faces included in no group come last.
+        std::replace(faceGroup.begin(), faceGroup.end(), noGroup, uint32_t(groupsNames.size()));
+        groupsNames.emplace_back();
+
+        ObjUtils::ParallelUtils::parallelCountingSort(
+            faces, facesBatches.m_sortedFaces, groupsNames.size(), [&faceGroup](uint32_t faceIdx) {
+                return faceGroup[faceIdx];
+            });
+        faces.swap(facesBatches.m_sortedFaces);
+    }
+
+    // Faces without material get the last bucket.
+    const size_t materialsCount = m_materialsNames.size();
+    const std::vector<size_t> materialsOffsets = ObjUtils::ParallelUtils::parallelCountingSort(
+        faces, facesBatches.m_sortedFaces, materialsCount + 1, [this](uint32_t faceIdx) {
+            return std::min<size_t>(m_faceBuffer[faceIdx].getMaterialID(), m_materialsNames.size());
+        });
+
+    // One batch per material, split where the group changes.
+    for (size_t bucketIdx = 0; bucketIdx <= materialsCount; ++bucketIdx)
+    {
+        const MaterialID_t materialID = (bucketIdx < materialsCount)
+                                            ? static_cast<MaterialID_t>(bucketIdx)
+                                            : NO_MATERIAL_ID;
+
+        for (size_t sortedIdx = materialsOffsets[bucketIdx];
+             sortedIdx < materialsOffsets[bucketIdx + 1];
+             ++sortedIdx)
+        {
+            const uint32_t grpRank = (byGroup == true)
+                                         ? faceGroup[facesBatches.m_sortedFaces[sortedIdx]]
+                                         : 0;
+
+            if ((sortedIdx == materialsOffsets[bucketIdx]) ||
+                ((byGroup == true) &&
+                 (grpRank != faceGroup[facesBatches.m_sortedFaces[sortedIdx - 1]])))
+            {
+                facesBatches.m_batches.push_back(FacesBatch{
+                    materialID,
+                    (byGroup == true) ? groupsNames[grpRank] : std::string_view(),
+                    sortedIdx,
+                    0});
+            }
+
+            ++facesBatches.m_batches.back().m_facesCount;
+        }
+    }
 
-    return includedEntities;
+    return facesBatches;
 }
@@ -27,9 +27,10 @@
 
 ObjEntityFace::ObjEntityFace(const size_t firstIdx,
                              const size_t lastIdx,
-                             const VerticesIdxOrganization eVtxIdxOrganization) :
+                             const VerticesIdxOrganization eVtxIdxOrganization,
+                             const MaterialID_t materialID) :
     ObjEntity(ElementType::FACE),
-    VertexBasedEntity(firstIdx, lastIdx, eVtxIdxOrganization)
+    VertexBasedEntity(firstIdx, lastIdx, eVtxIdxOrganization), m_materialID(materialID)
 {
     m_isTriangle = (((lastIdx - firstIdx + 1) % 3) == 0);
     m_hasTextureVertex = (eVtxIdxOrganization == VerticesIdxOrganization::VGEO_VTEXTURE_VNORMAL);
@@ -124,7 +124,7 @@ bool ObjEntityGroup::operator==(const ObjEntity& other) const
 
 // =================================================================================================
 
-auto ObjEntityGroup::getGroupName() const
+std::optional<std::reference_wrapper<const std::string>> ObjEntityGroup::getGroupName() const
 {
     using ConstStringRef_t = std::reference_wrapper<const std::string>;
 
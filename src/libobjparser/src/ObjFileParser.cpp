@@ -24,68 +24,423 @@
 /// \date      08-11-2017
 
 #include "ObjFileParser.h"
+#include "LineReader.h"
+#include "ObjCompressedStreamReader.h"
+#include "ObjReadAheadStreamReader.h"
+#include "MtlLibraryCache.h"
 
 #include "Utils.h"
 
 #include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+/// \brief  Throw if a reader could not read its whole text: the database would be silently
+///         incomplete.
+///
+/// \param  reader Reader of the parsed text.
+/// \param  source Name of the text, for the error message.
+/// \throw  std::runtime_error if the reader failed.
+void throwIfFailed(const ObjStreamReader& reader, const std::string& source)
+{
+    if (reader.hasFailed() == true)
+    {
+        throw std::runtime_error("Obj text reading failed: " + source);
+    }
+}
 
-ObjDatabase ObjFileParser::parseFile()
+/// \brief  Parse the number starting the arguments of an element and remove it from them. The
+///         arguments view the line buffer, which isn't null-terminated.
+///
+/// \throw  std::invalid_argument if the arguments don't start with a number.
+template<typename NumberT>
+NumberT parseArgument(std::string_view& args)
 {
-    OBJLOG("Obj file parsing started...");
+    const std::optional<NumberT> number = ObjUtils::StringUtils::parseNumber<NumberT>(args);
+    if (number.has_value() == false)
+    {
+        throw std::invalid_argument("Malformed Obj element argument: " + std::string(args));
+    }
 
-    namespace fs = std::filesystem;
+    return *number;
+}
 
-    OBJASSERT((fs::exists(m_objFilePath) == true) && (fs::is_regular_file(m_objFilePath) == true),
-              "Obj file not found");
-    if ((fs::exists(m_objFilePath) == true) && (fs::is_regular_file(m_objFilePath) == true))
+/// Size from which the Obj files are read ahead, smaller ones are read in a few blocks anyway.
+constexpr uintmax_t readAheadMinFileSize = 4 * 1024 * 1024;
+
+/// Size of the chunks in which the followed Obj files are parsed.
+constexpr size_t followChunkSize = 1024 * 1024;
+
+/// Count of the samples of an Obj file from which its entities are counted.
+constexpr size_t estimateSamplesCount = 16;
+
+/// Size of the samples of an Obj file from which its entities are counted.
+constexpr size_t estimateSampleSize = 64 * 1024;
+
+/// \brief  Add the entities of the complete lines of an Obj text sample to counts.
+///
+/// \return Size of the counted lines.
+size_t countSampleEntities(std::string_view sample, ObjDatabase::Checkpoint& counts)
+{
+    auto isIndexChar = [](const char chr) {
+        return (std::isdigit(static_cast<unsigned char>(chr)) != 0) || (chr == '-');
+    };
+
+    size_t countedSize = 0;
+    for (size_t lineEnd = sample.find('\n'); lineEnd != std::string_view::npos;
+         lineEnd = sample.find('\n'))
     {
-        const std::unique_ptr<std::FILE, decltype(&fclose)> smtObjFile(fopen(m_objFilePath.c_str(),
-                                                                             "r"),
-                                                                       &fclose);
+        std::string_view line = sample.substr(0, lineEnd);
+        sample.remove_prefix(lineEnd + 1);
+        countedSize += lineEnd + 1;
 
-        if (smtObjFile != nullptr)
+        ObjUtils::StringUtils::removeSurroundingBlanks(line);
+        const size_t keywordSize = std::min(line.find_first_of(" \t"), line.size());
+        const std::string_view keyword = line.substr(0, keywordSize);
+        const std::string_view args = line.substr(keywordSize);
+
+        if (keyword == "v")
+        {
+            ++counts.m_verticesCounts[0];
+        }
+        else if (keyword == "vt")
+        {
+            ++counts.m_verticesCounts[1];
+        }
+        else if (keyword == "vn")
+        {
+            ++counts.m_verticesCounts[2];
+        }
+        else if (keyword == "vp")
         {
-            const uint16_t lineBufferSize = 1024;
-            char lineBuffer[lineBufferSize];
+            ++counts.m_verticesCounts[3];
+        }
+        else if (keyword == "f")
+        {
+            // One index per run of digits, whatever the triplets' organization.
+            ++counts.m_facesCount;
+            for (size_t charIdx = 0; charIdx < args.size(); ++charIdx)
+            {
+                if ((isIndexChar(args[charIdx]) == true) &&
+                    ((charIdx == 0) || (isIndexChar(args[charIdx - 1]) == false)))
+                {
+                    ++counts.m_indicesCount;
+                }
+            }
+        }
+        else if (keyword == "g")
+        {
+            counts.m_groupsCount += ObjUtils::StringUtils::splitString(args).size();
+        }
+        else if ((keyword == "s") || (keyword == "mg") || (keyword == "o"))
+        {
+            ++counts.m_groupsCount;
+        }
+    }
 
-            std::string oneLine;
-            oneLine.reserve(lineBufferSize);
+    return countedSize;
+}
 
-            // Create the default group named "default" before parsing the first entity.
-            m_currentGroups.push_back(
-                m_objDB.insertEntity(ObjEntityGroup{ElementType::GROUP_NAME, 0, "default"}));
+/// \brief  Estimate the counts of the entities of an uncompressed Obj file from evenly spaced
+///         samples, or from the whole file if it is small. The counts are rounded up by a margin.
+///
+/// \return Estimated counts, std::nullopt if the file cannot be read.
+std::optional<ObjDatabase::Checkpoint> estimateEntitiesCounts(const std::filesystem::path& filePath)
+{
+    std::error_code errCode;
+    const uintmax_t fileSize = std::filesystem::file_size(filePath, errCode);
+    std::ifstream objFile(filePath, std::ios::binary);
+    if ((errCode.value() != 0) || (objFile.is_open() == false))
+    {
+        return std::nullopt;
+    }
 
-            // Lambda that handles the case of multiple joind lines via the line continuation
-            // character (\).
-            auto handleLineContinuation = [&smtObjFile, &lineBuffer, &oneLine]() {
-                for (size_t nextLinePos = oneLine.rfind('\\'); nextLinePos != std::string::npos;)
-                {
-                    oneLine[nextLinePos] = ' ';
-                    if (fgets(lineBuffer, lineBufferSize, smtObjFile.get()) != nullptr)
-                    {
-                        oneLine += lineBuffer;
-                    }
+    const bool isSampled = (fileSize > estimateSamplesCount * estimateSampleSize);
+    const size_t samplesCount = (isSampled == true) ? estimateSamplesCount : 1;
 
-                    nextLinePos = oneLine.rfind('\\');
-                }
-            };
+    ObjDatabase::Checkpoint counts;
+    uintmax_t countedSize = 0;
+    std::string sample;
+    for (size_t sampleIdx = 0; sampleIdx < samplesCount; ++sampleIdx)
+    {
+        uintmax_t sampleOffset = 0;
+        sample.resize(static_cast<size_t>(fileSize));
+        if (isSampled == true)
+        {
+            sampleOffset = (fileSize - estimateSampleSize) * sampleIdx / (samplesCount - 1);
+            sample.resize(estimateSampleSize);
+        }
+
+        objFile.seekg(static_cast<std::streamoff>(sampleOffset));
+        objFile.read(sample.data(), static_cast<std::streamsize>(sample.size()));
+        sample.resize(static_cast<size_t>(objFile.gcount()));
+
+        // A sample starts at its first complete line. The last line of the file counts too.
+        std::string_view lines(sample);
+        if (sampleOffset > 0)
+        {
+            lines.remove_prefix(std::min(lines.find('\n'), lines.size() - 1) + 1);
+        }
+        if (isSampled == false)
+        {
+            sample.push_back('\n');
+            lines = sample;
+        }
+
+        countedSize += countSampleEntities(lines, counts);
+    }
+
+    if (countedSize == 0)
+    {
+        return std::nullopt;
+    }
+
+    // The groups are entities, the default group included.
+    ++counts.m_groupsCount;
+    const double scale = static_cast<double>(fileSize) / countedSize;
+    auto extrapolate = [scale](size_t& count) {
+        if (count > 0)
+        {
+            count = static_cast<size_t>(count * scale);
+            count += count / 8 + 16;
+        }
+    };
+
+    extrapolate(counts.m_indicesCount);
+    std::for_each(counts.m_verticesCounts.begin(), counts.m_verticesCounts.end(), extrapolate);
+    extrapolate(counts.m_facesCount);
+    extrapolate(counts.m_groupsCount);
+
+    counts.m_entitiesCount = counts.m_verticesCounts[0] + counts.m_verticesCounts[1] +
+                             counts.m_verticesCounts[2] + counts.m_verticesCounts[3] +
+                             counts.m_facesCount + counts.m_groupsCount;
+
+    return counts;
+}
 
-            while (fgets(lineBuffer, lineBufferSize, smtObjFile.get()) != nullptr)
+/// \brief  Return the fingerprint of a chunk of an Obj file, hashed by words of 8 bytes.
+uint64_t hashChunk(const std::string_view chunk)
+{
+    auto mix = [](uint64_t hash, const uint64_t word) {
+        hash = (hash ^ word) * 0xBF58476D1CE4E5B9;
+        return hash ^ (hash >> 31);
+    };
+
+    uint64_t hash = 0x9E3779B97F4A7C15 ^ chunk.size();
+
+    size_t pos = 0;
+    for (; pos + sizeof(uint64_t) <= chunk.size(); pos += sizeof(uint64_t))
+    {
+        uint64_t word = 0;
+        std::memcpy(&word, chunk.data() + pos, sizeof(uint64_t));
+        hash = mix(hash, word);
+    }
+
+    if (pos < chunk.size())
+    {
+        uint64_t word = 0;
+        std::memcpy(&word, chunk.data() + pos, chunk.size() - pos);
+        hash = mix(hash, word);
+    }
+
+    return hash;
+}
+
+/// \brief  Return whether the line ending at a position is continued by a backslash, as joined by
+///         the LineReader.
+bool isContinuedLine(const std::string_view text, size_t lineEnd)
+{
+    // Only the blanks of this line are skipped.
+    while ((lineEnd > 0) && (text[lineEnd - 1] != '\n') &&
+           (std::isspace(static_cast<unsigned char>(text[lineEnd - 1])) != 0))
+    {
+        --lineEnd;
+    }
+
+    return (lineEnd > 0) && (text[lineEnd - 1] == '\\');
+}
+
+/// \brief  Return the size of the complete lines of a text, up to the end of its last line that
+///         is neither continued nor unterminated.
+size_t getCompleteLinesSize(const std::string_view text)
+{
+    for (size_t lineEnd = text.rfind('\n'); lineEnd != std::string_view::npos;
+         lineEnd = (lineEnd > 0) ? text.rfind('\n', lineEnd - 1) : std::string_view::npos)
+    {
+        if (isContinuedLine(text, lineEnd) == false)
+        {
+            return lineEnd + 1;
+        }
+    }
+
+    return 0;
+}
+
+/// \brief  Return the table of the gear hash, which splits the Obj texts in chunks: one random
+///         word per byte value.
+constexpr std::array<uint64_t, 256> makeGearTable()
+{
+    std::array<uint64_t, 256> gearTable = {};
+
+    // splitmix64 sequence.
+    uint64_t state = 0;
+    for (uint64_t& word : gearTable)
+    {
+        state += 0x9E3779B97F4A7C15;
+        word = state;
+        word = (word ^ (word >> 30)) * 0xBF58476D1CE4E5B9;
+        word = (word ^ (word >> 27)) * 0x94D049BB133111EB;
+        word ^= word >> 31;
+    }
+
+    return gearTable;
+}
+
+constexpr std::array<uint64_t, 256> gearTable = makeGearTable();
+
+/// \brief  Split a text read from a reader in chunks of about chunkSize bytes. A chunk ends at the
+///         end of the line of its first byte, past half the chunk size, whose gear hash of the 64
+///         bytes ending with it matches a mask, or past 4 times the chunk size. The places depend
+///         on the text around them, a text is split at the same places before and after an edit
+///         but for the chunks around it. Continued lines are kept in one chunk.
+void forEachChunk(ObjStreamReader& reader,
+                  const size_t chunkSize,
+                  const std::function<void(std::string_view)>& onChunk)
+{
+    const size_t minChunkSize = std::max<size_t>(chunkSize / 2, 1);
+    const size_t maxChunkSize = std::max<size_t>(chunkSize * 4, 1);
+
+    // The hash matches the mask once every 2^maskBitsCount bytes on average.
+    size_t maskBitsCount = 0;
+    while ((maskBitsCount < 63) && ((size_t{2} << maskBitsCount) <= chunkSize - minChunkSize))
+    {
+        ++maskBitsCount;
+    }
+    const uint64_t cutMask = ~(~uint64_t{0} >> maskBitsCount);
+
+    std::string pendingText;
+    size_t hashedSize = 0;              // Size of the chunk's hashed text.
+    uint64_t gearHash = 0;              // Hash of the 64 bytes ending the hashed text.
+    size_t cutPos = std::string::npos;  // Position from which the chunk ends at a line end.
+    size_t searchPos = 0;               // Position from which that line end is searched.
+    bool isTextEnd = false;
+
+    while (true)
+    {
+        // The hash only depends on the last 64 bytes, the ones before are skipped.
+        hashedSize = std::max(hashedSize, minChunkSize - std::min<size_t>(minChunkSize, 64));
+        for (; (cutPos == std::string::npos) && (hashedSize < pendingText.size()); ++hashedSize)
+        {
+            gearHash = (gearHash << 1) + gearTable[static_cast<uint8_t>(pendingText[hashedSize])];
+            if (((hashedSize + 1 >= minChunkSize) && ((gearHash & cutMask) == 0)) ||
+                (hashedSize + 1 >= maxChunkSize))
             {
-                oneLine = lineBuffer;
+                cutPos = hashedSize;
+            }
+        }
 
-                handleLineContinuation();
+        size_t chunkEnd = std::string::npos;
+        if (cutPos != std::string::npos)
+        {
+            for (size_t lineEnd = pendingText.find('\n', std::max(searchPos, cutPos));
+                 lineEnd != std::string::npos;
+                 lineEnd = pendingText.find('\n', lineEnd + 1))
+            {
+                if (isContinuedLine(pendingText, lineEnd) == false)
+                {
+                    chunkEnd = lineEnd + 1;
+                    break;
+                }
+            }
+        }
 
-                parseElement(oneLine);
+        if (chunkEnd != std::string::npos)
+        {
+            onChunk(std::string_view(pendingText.data(), chunkEnd));
+            pendingText.erase(0, chunkEnd);
+            hashedSize = 0;
+            gearHash = 0;
+            cutPos = std::string::npos;
+            searchPos = 0;
+        }
+        else if (isTextEnd == true)
+        {
+            if (pendingText.empty() == false)
+            {
+                onChunk(pendingText);
             }
 
-            // Set the last included entity index for any remaining active groups.
-            endCurrentGroupsEntitiesRanges();
+            return;
+        }
+        else
+        {
+            // The chunk's last line goes on in the next block.
+            searchPos = pendingText.size();
+
+            const size_t readSize = std::max<size_t>(chunkSize, 64 * 1024);
+            pendingText.resize(searchPos + readSize);
+            const size_t readBytesCount = reader.read(pendingText.data() + searchPos, readSize);
+            pendingText.resize(searchPos + readBytesCount);
+            isTextEnd = (readBytesCount == 0);
+        }
+    }
+}
+
+/// \brief  Return the parsing phase of an element's arguments.
+ParsePhase getElementPhase(const ElementType elemType)
+{
+    switch (elemType)
+    {
+    case ElementType::VERTEX:
+    case ElementType::VERTEX_TEXTURE:
+    case ElementType::VERTEX_NORMAL:
+    case ElementType::VERTEX_PARAM_SPACE: return ParsePhase::FLOAT_PARSE;
+
+    case ElementType::FACE: return ParsePhase::FACE_PARSE;
 
-            OBJLOG("Obj file parsing ended");
+    case ElementType::GROUP_NAME:
+    case ElementType::SMOOTHING_GROUP:
+    case ElementType::MERGING_GROUP:
+    case ElementType::OBJECT_NAME: return ParsePhase::GROUP_HANDLING;
+
+    case ElementType::MATERIAL_NAME:
+    case ElementType::MATERIAL_LIB: return ParsePhase::MATERIALS;
+
+    default: return ParsePhase::TOKENIZE;
+    }
+}
+
+}  // namespace
+
+// =================================================================================================
+
+ObjDatabase ObjFileParser::parseFile()
+{
+    // Buffers held out of core are allocated once, at their estimated size: growing a mapped
+    // buffer would map a new file twice as large and copy the old one to it.
+    if ((m_objDB.hasBuffersMemory() == true) &&
+        (ObjCompressedStreamReader::detectCompression(m_objFilePath) ==
+         ObjCompressedStreamReader::Compression::NONE))
+    {
+        if (const std::optional<ObjDatabase::Checkpoint> counts = estimateEntitiesCounts(
+                m_objFilePath);
+            counts.has_value() == true)
+        {
+            m_objDB.reserve(*counts);
         }
     }
 
+    readFile([this](ObjStreamReader& reader) { parseLines(reader); });
+
     // std::move used because:
     // - Obj Database instance no longer needed by the Parser.
     // - Returning the instance as lvalue will call the copy ctor because m_objDB
@@ -95,11 +450,561 @@ ObjDatabase ObjFileParser::parseFile()
 
 // =================================================================================================
 
+ObjDatabase ObjFileParser::parseFile(ParseStats& stats)
+{
+    return parseWithStats(stats, [this]() { return parseFile(); });
+}
+
+// =================================================================================================
+
+ObjDatabase ObjFileParser::parseBuffer(std::string_view objText)
+{
+    ObjMemoryStreamReader memoryReader(objText);
+    parseLines(memoryReader);
+
+    return std::move(m_objDB);
+}
+
+// =================================================================================================
+
+ObjDatabase ObjFileParser::parseBuffer(const std::byte* pData, const size_t size)
+{
+    return parseBuffer(std::string_view(reinterpret_cast<const char*>(pData), size));
+}
+
+// =================================================================================================
+
+ObjDatabase ObjFileParser::parseStream(ObjStreamReader& reader)
+{
+    parseLines(reader);
+    throwIfFailed(reader, "Obj stream");
+
+    return std::move(m_objDB);
+}
+
+// =================================================================================================
+
+ObjDatabase ObjFileParser::parseStream(ObjStreamReader& reader, ParseStats& stats)
+{
+    return parseWithStats(stats, [this, &reader]() { return parseStream(reader); });
+}
+
+// =================================================================================================
+
+const ObjDatabase& ObjFileParser::parseFileIncrementally(const size_t chunkSize)
+{
+    m_chunkSize = std::max<size_t>(chunkSize, 1);
+    m_parsedChunks.clear();
+
+    resetParsing();
+    parseChangedChunks();
+
+    return m_objDB;
+}
+
+// =================================================================================================
+
+uint64_t ObjFileParser::reparseChanges()
+{
+    OBJASSERT(m_chunkSize > 0, "Obj file not parsed incrementally");
+    if ((m_chunkSize == 0) || (std::filesystem::is_regular_file(m_objFilePath) == false))
+    {
+        return 0;
+    }
+
+    return parseChangedChunks();
+}
+
+// =================================================================================================
+
+uint64_t ObjFileParser::parseChangedChunks()
+{
+    uint64_t reparsedBytesCount = 0;
+    bool isChanged = false;
+
+    // The chunks whose entities are in the database, followed as long as the text is unchanged.
+    std::vector<ParsedChunk> keptChunks = std::move(m_parsedChunks);
+    ParsingCheckpoint keptTextEndCheckpoint = m_textEndCheckpoint;
+    size_t keptChunkIdx = 0;
+    bool isKeptTextFollowed = true;
+
+    std::optional<DetachedChunks> detachedChunks;
+    m_parsedChunks.clear();
+
+    readFile([&](ObjStreamReader& reader) {
+        forEachChunk(reader, m_chunkSize, [&](const std::string_view chunk) {
+            const uint64_t chunkHash = hashChunk(chunk);
+
+            if (isKeptTextFollowed == true)
+            {
+                if ((keptChunkIdx < keptChunks.size()) &&
+                    (keptChunks[keptChunkIdx].m_size == chunk.size()) &&
+                    (keptChunks[keptChunkIdx].m_hash == chunkHash))
+                {
+                    m_parsedChunks.push_back(std::move(keptChunks[keptChunkIdx]));
+                    ++keptChunkIdx;
+                    return;
+                }
+
+                // The chunks after the changed one are detached until their text is found again.
+                isChanged = true;
+                isKeptTextFollowed = false;
+                detachedChunks = detachChunks(keptChunks, keptChunkIdx, keptTextEndCheckpoint);
+            }
+            else if (auto splicedChunks =
+                         spliceDetachedChunks(*detachedChunks, chunkHash, chunk.size());
+                     splicedChunks.has_value() == true)
+            {
+                keptChunks = std::move(splicedChunks->first);
+                keptTextEndCheckpoint = std::move(splicedChunks->second);
+                m_parsedChunks.push_back(std::move(keptChunks.front()));
+                keptChunkIdx = 1;
+                isKeptTextFollowed = true;
+                return;
+            }
+
+            m_parsedChunks.push_back(ParsedChunk{chunkHash, chunk.size(), getParsingCheckpoint()});
+            m_hasParsedRelativeIndices = false;
+            m_hasParsedAbsoluteIndices = false;
+
+            ObjMemoryStreamReader chunkReader(chunk);
+            readLines(chunkReader);
+
+            m_parsedChunks.back().m_hasRelativeIndices = m_hasParsedRelativeIndices;
+            m_parsedChunks.back().m_hasAbsoluteIndices = m_hasParsedAbsoluteIndices;
+            reparsedBytesCount += chunk.size();
+        });
+    });
+
+    if (isKeptTextFollowed == true)
+    {
+        if (keptChunkIdx < keptChunks.size())
+        {
+            // The file was truncated at the end of an unchanged chunk.
+            isChanged = true;
+            rollback(keptChunks[keptChunkIdx].m_checkpoint);
+        }
+        else if (isChanged == true)
+        {
+            // The groups active at the end of the spliced chunks go on.
+            rollback(keptTextEndCheckpoint);
+        }
+    }
+
+    if (isChanged == true)
+    {
+        m_textEndCheckpoint = getParsingCheckpoint();
+        endParsing();
+    }
+
+    return reparsedBytesCount;
+}
+
+// =================================================================================================
+
+ObjFileParser::DetachedChunks
+ObjFileParser::detachChunks(std::vector<ParsedChunk>& chunks,
+                            const size_t firstChunkIdx,
+                            const ParsingCheckpoint& textEndCheckpoint)
+{
+    const ParsingCheckpoint checkpoint = (firstChunkIdx < chunks.size())
+                                             ? chunks[firstChunkIdx].m_checkpoint
+                                             : textEndCheckpoint;
+
+    DetachedChunks detached;
+    detached.m_entities = m_objDB.detach(checkpoint.m_dbCheckpoint);
+    detached.m_chunks.assign(std::make_move_iterator(chunks.begin() + firstChunkIdx),
+                             std::make_move_iterator(chunks.end()));
+    detached.m_textEndCheckpoint = textEndCheckpoint;
+    for (size_t chunkIdx = 0; chunkIdx < detached.m_chunks.size(); ++chunkIdx)
+    {
+        detached.m_chunksIdxs.emplace(detached.m_chunks[chunkIdx].m_hash, chunkIdx);
+    }
+
+    rollback(checkpoint);
+
+    return detached;
+}
+
+// =================================================================================================
+
+std::optional<std::pair<std::vector<ObjFileParser::ParsedChunk>, ObjFileParser::ParsingCheckpoint>>
+ObjFileParser::spliceDetachedChunks(DetachedChunks& detached,
+                                    const uint64_t chunkHash,
+                                    const size_t chunkSize)
+{
+    const auto chunkIdxItr = detached.m_chunksIdxs.find(chunkHash);
+    if ((chunkIdxItr == detached.m_chunksIdxs.cend()) ||
+        (detached.m_chunks[chunkIdxItr->second].m_size != chunkSize))
+    {
+        return std::nullopt;
+    }
+
+    const size_t firstChunkIdx = chunkIdxItr->second;
+    const ParsingCheckpoint from = detached.m_chunks[firstChunkIdx].m_checkpoint;
+    const ObjDatabase::Checkpoint& detachedAt = detached.m_entities.m_checkpoint;
+    const ObjDatabase::Checkpoint to = m_objDB.getCheckpoint();
+
+    // The chunks must be parsed in the same state: same active groups and usemtl names.
+    if ((m_currentMaterialID != from.m_currentMaterialID) ||
+        (to.m_materialsCount != from.m_dbCheckpoint.m_materialsCount) ||
+        (m_currentGroups.size() != from.m_currentGroups.size()))
+    {
+        return std::nullopt;
+    }
+
+    for (size_t materialID = detachedAt.m_materialsCount; materialID < to.m_materialsCount;
+         ++materialID)
+    {
+        if (m_objDB.getMaterialName(static_cast<MaterialID_t>(materialID)) !=
+            detached.m_entities.m_materialsNames[materialID - detachedAt.m_materialsCount])
+        {
+            return std::nullopt;
+        }
+    }
+
+    std::vector<std::pair<size_t, size_t>> continuedGroups;
+    for (size_t grpIdx = 0; grpIdx < m_currentGroups.size(); ++grpIdx)
+    {
+        const size_t detachedGrpID = from.m_currentGroups[grpIdx];
+        const auto grpOpt = std::as_const(m_objDB).getGroup(m_currentGroups[grpIdx]);
+        const auto detachedGrpOpt = (detachedGrpID <= detachedAt.m_entitiesCount)
+                                        ? std::as_const(m_objDB).getGroup(detachedGrpID)
+                                        : detached.m_entities.getGroup(detachedGrpID);
+        if ((grpOpt.has_value() == false) || (detachedGrpOpt.has_value() == false) ||
+            ((grpOpt->get() == detachedGrpOpt->get()) == false))
+        {
+            return std::nullopt;
+        }
+
+        continuedGroups.emplace_back(detachedGrpID, m_currentGroups[grpIdx]);
+    }
+
+    // Negative indices are moved with the vertices counts, unless mixed with positive ones.
+    const bool areVerticesMoved = (to.m_verticesCounts != from.m_dbCheckpoint.m_verticesCounts);
+    std::vector<std::pair<size_t, size_t>> relativeFaces;
+    for (size_t chunkIdx = firstChunkIdx; chunkIdx < detached.m_chunks.size(); ++chunkIdx)
+    {
+        const ParsedChunk& chunk = detached.m_chunks[chunkIdx];
+        if ((areVerticesMoved == false) || (chunk.m_hasRelativeIndices == false))
+        {
+            continue;
+        }
+        if (chunk.m_hasAbsoluteIndices == true)
+        {
+            return std::nullopt;
+        }
+
+        const ParsingCheckpoint& chunkEnd = (chunkIdx + 1 < detached.m_chunks.size())
+                                                ? detached.m_chunks[chunkIdx + 1].m_checkpoint
+                                                : detached.m_textEndCheckpoint;
+        relativeFaces.emplace_back(chunk.m_checkpoint.m_dbCheckpoint.m_facesCount,
+                                   chunkEnd.m_dbCheckpoint.m_facesCount);
+    }
+
+    m_objDB.splice(detached.m_entities, from.m_dbCheckpoint, continuedGroups, relativeFaces);
+
+    // The spliced chunks' checkpoints are moved as their entities.
+    auto moveCheckpoint = [&from, &to, this](ParsingCheckpoint& checkpoint) {
+        ObjDatabase::Checkpoint& counts = checkpoint.m_dbCheckpoint;
+        const ObjDatabase::Checkpoint& fromCounts = from.m_dbCheckpoint;
+
+        counts.m_indicesCount += to.m_indicesCount - fromCounts.m_indicesCount;
+        for (size_t bufferIdx = 0; bufferIdx < counts.m_verticesCounts.size(); ++bufferIdx)
+        {
+            counts.m_verticesCounts[bufferIdx] +=
+                to.m_verticesCounts[bufferIdx] - fromCounts.m_verticesCounts[bufferIdx];
+        }
+        counts.m_facesCount += to.m_facesCount - fromCounts.m_facesCount;
+        counts.m_groupsCount += to.m_groupsCount - fromCounts.m_groupsCount;
+        counts.m_entitiesCount += to.m_entitiesCount - fromCounts.m_entitiesCount;
+        counts.m_materialLibrariesCount +=
+            to.m_materialLibrariesCount - fromCounts.m_materialLibrariesCount;
+
+        // The groups IDs follow their location in the entities table but for the continued ones.
+        for (size_t& grpID : checkpoint.m_currentGroups)
+        {
+            const auto continuedItr =
+                std::find(from.m_currentGroups.cbegin(), from.m_currentGroups.cend(), grpID);
+            grpID = (continuedItr != from.m_currentGroups.cend())
+                        ? m_currentGroups[continuedItr - from.m_currentGroups.cbegin()]
+                        : grpID + to.m_entitiesCount - fromCounts.m_entitiesCount;
+        }
+    };
+
+    std::vector<ParsedChunk> splicedChunks(
+        std::make_move_iterator(detached.m_chunks.begin() + firstChunkIdx),
+        std::make_move_iterator(detached.m_chunks.end()));
+    for (ParsedChunk& chunk : splicedChunks)
+    {
+        moveCheckpoint(chunk.m_checkpoint);
+    }
+    ParsingCheckpoint textEndCheckpoint = std::move(detached.m_textEndCheckpoint);
+    moveCheckpoint(textEndCheckpoint);
+
+    // The detached entities were all spliced.
+    detached.m_chunks.clear();
+    detached.m_chunksIdxs.clear();
+
+    return std::make_pair(std::move(splicedChunks), std::move(textEndCheckpoint));
+}
+
+// =================================================================================================
+
+uint64_t ObjFileParser::followFile()
+{
+    namespace fs = std::filesystem;
+
+    std::error_code errCode;
+    const uintmax_t fileSize = fs::file_size(m_objFilePath, errCode);
+    if (errCode.value() != 0)
+    {
+        OBJLOG("Followed Obj file not found : ", m_objFilePath);
+        return 0;
+    }
+
+    // A file now shorter than the parsed text was rewritten.
+    if ((m_isFollowing == false) || (fileSize < m_followedBytesCount))
+    {
+        resetParsing();
+        m_isFollowing = true;
+        m_followedBytesCount = 0;
+    }
+    else if (fileSize == m_followedBytesCount)
+    {
+        return 0;
+    }
+
+    const std::unique_ptr<std::FILE, decltype(&fclose)> smtObjFile(
+        fopen(m_objFilePath.c_str(), "r"), &fclose);
+    if ((smtObjFile == nullptr) ||
+        (std::fseek(smtObjFile.get(), static_cast<long>(m_followedBytesCount), SEEK_SET) != 0))
+    {
+        return 0;
+    }
+
+    // The groups ended at the end of the parsed text go on.
+    rollback(m_textEndCheckpoint);
+
+    uint64_t parsedBytesCount = 0;
+    ObjFileStreamReader fileReader(smtObjFile.get());
+    forEachChunk(fileReader, followChunkSize, [this, &parsedBytesCount](std::string_view chunk) {
+        // Only the text's last chunk may end with a line still being written.
+        chunk = chunk.substr(0, getCompleteLinesSize(chunk));
+
+        ObjMemoryStreamReader chunkReader(chunk);
+        readLines(chunkReader);
+
+        parsedBytesCount += chunk.size();
+    });
+    m_followedBytesCount += parsedBytesCount;
+
+    m_textEndCheckpoint = getParsingCheckpoint();
+    endParsing();
+
+    return parsedBytesCount;
+}
+
+// =================================================================================================
+
+void ObjFileParser::resetParsing()
+{
+    discardParsing();
+    startParsing();
+    m_textEndCheckpoint = getParsingCheckpoint();
+}
+
+// =================================================================================================
+
+void ObjFileParser::discardParsing()
+{
+    // The database's buffers keep their allocator.
+    m_objDB.rollback(ObjDatabase::Checkpoint{});
+    m_currentGroups.clear();
+    m_currentMaterialID = NO_MATERIAL_ID;
+    m_lastElementType = ElementType::VERTEX;
+}
+
+// =================================================================================================
+
+ObjFileParser::ParsingCheckpoint ObjFileParser::getParsingCheckpoint() const
+{
+    return ParsingCheckpoint{
+        m_objDB.getCheckpoint(), m_currentGroups, m_currentMaterialID, m_lastElementType};
+}
+
+// =================================================================================================
+
+void ObjFileParser::rollback(const ParsingCheckpoint& checkpoint)
+{
+    m_objDB.rollback(checkpoint.m_dbCheckpoint);
+
+    // The groups active at the checkpoint were ended since, their range goes on.
+    m_currentGroups = checkpoint.m_currentGroups;
+    for (const size_t grpIdx : m_currentGroups)
+    {
+        std::optional<std::reference_wrapper<ObjEntityGroup>> grpOpt = m_objDB.getGroup(grpIdx);
+        OBJASSERT(grpOpt.has_value() == true, "Invalid group index");
+
+        grpOpt->get().reopenIncludedEntityRange();
+    }
+
+    m_currentMaterialID = checkpoint.m_currentMaterialID;
+    m_lastElementType = checkpoint.m_lastElementType;
+}
+
+// =================================================================================================
+
+void ObjFileParser::readFile(const std::function<void(ObjStreamReader&)>& readText)
+{
+    namespace fs = std::filesystem;
+
+    OBJASSERT((fs::exists(m_objFilePath) == true) && (fs::is_regular_file(m_objFilePath) == true),
+              "Obj file not found");
+    if ((fs::exists(m_objFilePath) == true) && (fs::is_regular_file(m_objFilePath) == true))
+    {
+        if (ObjCompressedStreamReader::detectCompression(m_objFilePath) !=
+            ObjCompressedStreamReader::Compression::NONE)
+        {
+            // Decompressed on another thread while the lines are parsed.
+            ObjCompressedStreamReader compressedReader(m_objFilePath);
+            readText(compressedReader);
+
+            // A corrupted or truncated archive ends the text early.
+            throwIfFailed(compressedReader, m_objFilePath.string());
+        }
+        else if (fs::file_size(m_objFilePath) >= readAheadMinFileSize)
+        {
+            // Blocks are read ahead while the previous ones are parsed.
+            ObjReadAheadStreamReader readAheadReader(m_objFilePath);
+            readText(readAheadReader);
+
+            throwIfFailed(readAheadReader, m_objFilePath.string());
+        }
+        else
+        {
+            const std::unique_ptr<std::FILE, decltype(&fclose)> smtObjFile(
+                fopen(m_objFilePath.c_str(), "r"), &fclose);
+
+            if (smtObjFile != nullptr)
+            {
+                ObjFileStreamReader fileReader(smtObjFile.get());
+                readText(fileReader);
+
+                throwIfFailed(fileReader, m_objFilePath.string());
+            }
+        }
+    }
+}
+
+// =================================================================================================
+
+void ObjFileParser::parseLines(ObjStreamReader& reader)
+{
+    OBJLOG("Obj text parsing started...");
+
+    startParsing();
+    readLines(reader);
+    endParsing();
+
+    OBJLOG("Obj text parsing ended");
+}
+
+// =================================================================================================
+
+void ObjFileParser::startParsing()
+{
+    // Create the default group named "default" before parsing the first entity.
+    m_currentGroups.push_back(
+        m_objDB.insertEntity(ObjEntityGroup{ElementType::GROUP_NAME, 0, "default"}));
+}
+
+// =================================================================================================
+
+void ObjFileParser::readLines(ObjStreamReader& reader)
+{
+    ObjUtils::LineReader lineReader(reader);
+
+    for (std::optional<std::string_view> oneLine = lineReader.readLine();
+         oneLine.has_value() == true; oneLine = lineReader.readLine())
+    {
+        if (m_pStats != nullptr)
+        {
+            ++m_pStats->m_linesCount;
+            lapPhase(ParsePhase::IO);
+        }
+
+        parseElement(*oneLine);
+    }
+
+    if (m_pStats != nullptr)
+    {
+        m_pStats->m_bytesCount += lineReader.getReadBytesCount();
+    }
+}
+
+// =================================================================================================
+
+void ObjFileParser::endParsing()
+{
+    // Set the last included entity index for any remaining active groups.
+    endCurrentGroupsEntitiesRanges();
+
+    // Bind the usemtl names to the parsed materials.
+    m_objDB.resolveMaterials();
+
+    lapPhase(ParsePhase::FINALIZE);
+}
+
+// =================================================================================================
+
+ObjDatabase ObjFileParser::parseWithStats(ParseStats& stats,
+                                          const std::function<ObjDatabase()>& parse)
+{
+    const auto [allocationsCount, allocatedBytes] = ParseStats::getThreadAllocations();
+
+    ParsePhaseClock phaseClock(stats);
+    m_pStats = &stats;
+    m_pPhaseClock = &phaseClock;
+
+    // The stats and the clock must not outlive this call, the parser may be reused.
+    ObjDatabase objDB;
+    try
+    {
+        objDB = parse();
+    }
+    catch (...)
+    {
+        m_pStats = nullptr;
+        m_pPhaseClock = nullptr;
+        discardParsing();
+        throw;
+    }
+
+    m_pStats = nullptr;
+    m_pPhaseClock = nullptr;
+
+    if (ParseStats::isCountingAllocations() == true)
+    {
+        const auto [endAllocationsCount, endAllocatedBytes] = ParseStats::getThreadAllocations();
+        stats.m_allocationsCount = stats.m_allocationsCount.value_or(0) + endAllocationsCount -
+                                   allocationsCount;
+        stats.m_allocatedBytes = stats.m_allocatedBytes.value_or(0) + endAllocatedBytes -
+                                 allocatedBytes;
+    }
+    ++stats.m_filesCount;
+
+    return objDB;
+}
+
+// =================================================================================================
+
 void ObjFileParser::parseElement(std::string_view oneLine)
 {
     ObjUtils::StringUtils::removeSurroundingBlanks(oneLine);
 
     const std::optional<ElemIDResult_t> elemTypeRes = getElementType(oneLine);
+    lapPhase(ParsePhase::TOKENIZE);
 
     // False if the line is either empty or the element is unknown.
     if (elemTypeRes.has_value() == true)
@@ -124,6 +1029,12 @@ void ObjFileParser::parseElement(std::string_view oneLine)
 
         // Parse the arguments of each element.
         parseElementArgs(*elemTypeRes);
+
+        if (m_pStats != nullptr)
+        {
+            ++m_pStats->m_elementsCounts[static_cast<size_t>(currentElemType)];
+            lapPhase(getElementPhase(currentElemType));
+        }
     }
 }
 
@@ -149,11 +1060,11 @@ void ObjFileParser::parseElementArgs(const ElemIDResult_t& elementIDRes)
         parseGroup(elementIDRes);
         break;
 
-    case ElementType::MATERIAL_NAME: OBJLOG("usemtl command not yet supported"); break;
+    case ElementType::MATERIAL_NAME: parseMaterialName(elementIDRes); break;
 
     case ElementType::LOD: OBJLOG("lod command not yet supported"); break;
 
-    case ElementType::MATERIAL_LIB: OBJLOG("mtllib command not yet supported"); break;
+    case ElementType::MATERIAL_LIB: parseMaterialLibrary(elementIDRes); break;
 
     default:
         OBJLOG("Element's type not yet supported : ", static_cast<uint8_t>(elemType));
@@ -252,30 +1163,23 @@ void ObjFileParser::parseVertex(const ElemIDResult_t& elementIDRes)
 
     auto [vtxType, vtxArgs] = elementIDRes;
 
-    size_t processedCharsCount = 0;
-
     Vertex_t vtx{vtxType};
     auto& [x, y, z, w] = vtx;
 
-    // Parse x component.
-    x = std::stof(vtxArgs.data(), &processedCharsCount);
-    vtxArgs.remove_prefix(processedCharsCount);
-
-    // Parse y component.
-    y = std::stof(vtxArgs.data(), &processedCharsCount);
-    vtxArgs.remove_prefix(processedCharsCount);
+    // Parse x and y components.
+    x = parseArgument<float>(vtxArgs);
+    y = parseArgument<float>(vtxArgs);
 
     // Check if the z component exists.
     if (vtxArgs.size() > 0)
     {
-        z = std::stof(vtxArgs.data(), &processedCharsCount);
-        vtxArgs.remove_prefix(processedCharsCount);
+        z = parseArgument<float>(vtxArgs);
     }
 
     // Check if the w component exists.
     if (vtxArgs.size() > 0)
     {
-        w = std::stof(vtxArgs.data(), &processedCharsCount);
+        w = parseArgument<float>(vtxArgs);
     }
 
     m_objDB.insertEntity(vtx);
@@ -303,15 +1207,49 @@ void ObjFileParser::parseFace(const ElemIDResult_t& elementIDRes)
         return;
     }
 
+    // Vertices types referenced by the indices of one triplet.
+    std::array<ElementType, 3> idxTypes = {ElementType::VERTEX};
+    switch (*vtxIdxOrg)
+    {
+    case VerticesIdxOrganization::VGEO_VTEXTURE: idxTypes[1] = ElementType::VERTEX_TEXTURE; break;
+    case VerticesIdxOrganization::VGEO_VNORMAL: idxTypes[1] = ElementType::VERTEX_NORMAL; break;
+    case VerticesIdxOrganization::VGEO_VTEXTURE_VNORMAL:
+        idxTypes[1] = ElementType::VERTEX_TEXTURE;
+        idxTypes[2] = ElementType::VERTEX_NORMAL;
+        break;
+
+    default: break;
+    }
+
+    const size_t idxStride = VertexBasedEntity::getIndicesStride(*vtxIdxOrg);
+
     const size_t indexBufferOldSize = m_objDB.getIndexBufferCount();
-    for (const std::string_view& part : parts)
+    for (size_t partIdx = 0; partIdx < parts.size(); ++partIdx)
     {
-        const int64_t vtxIdx = std::stol(part.data());
+        std::string_view idxArg = parts[partIdx];
+        int64_t vtxIdx = parseArgument<int64_t>(idxArg);
+
+        // Negative indices are relative to the last vertex read so far (-1 is the last one).
+        if (vtxIdx < 0)
+        {
+            const ElementType idxType = idxTypes[partIdx % idxStride];
+            vtxIdx += m_objDB.getVerticesCount(idxType) +
+                      m_pulledVerticesCounts[static_cast<size_t>(idxType)] + 1;
+            m_hasParsedRelativeIndices = true;
+        }
+        else
+        {
+            m_hasParsedAbsoluteIndices = true;
+        }
+
         m_objDB.insertIndex(vtxIdx);
     }
     const size_t indexBufferNewSize = m_objDB.getIndexBufferCount();
 
-    m_objDB.insertEntity(ObjEntityFace(indexBufferOldSize, indexBufferNewSize - 1, *vtxIdxOrg));
+    m_objDB.insertEntity(ObjEntityFace(indexBufferOldSize,
+                                       indexBufferNewSize - 1,
+                                       *vtxIdxOrg,
+                                       m_currentMaterialID));
 }
 
 // =================================================================================================
@@ -320,15 +1258,12 @@ void ObjFileParser::parseGroup(const ElemIDResult_t& elementIDRes)
 {
     OBJLOG("Parsing a Group");
 
-    // Set the last included entity index for all the previous active groups
-    // before parsing new ones.
-    endCurrentGroupsEntitiesRanges();
-
-    // Clear the list of previous active groups in order to receive the new ones.
-    m_currentGroups.clear();
-
     auto [grpType, grpArgs] = elementIDRes;
 
+    // Set the last included entity index for the previous active groups of the same type before
+    // parsing new ones. Groups of the other types (g/s/mg) remain active.
+    endCurrentGroupsEntitiesRanges(grpType);
+
     switch (const size_t entityTableIdx = m_objDB.getEntitiesCount(); grpType)
     {
     case ElementType::GROUP_NAME:
@@ -352,7 +1287,7 @@ void ObjFileParser::parseGroup(const ElemIDResult_t& elementIDRes)
     {
         if (grpArgs != "off" && grpArgs != "0")
         {
-            const size_t groupNum = std::stol(grpArgs.data());
+            const size_t groupNum = parseArgument<int64_t>(grpArgs);
 
             m_currentGroups.push_back(
                 m_objDB.insertEntity(ObjEntityGroup{grpType, entityTableIdx, groupNum}));
@@ -364,15 +1299,13 @@ void ObjFileParser::parseGroup(const ElemIDResult_t& elementIDRes)
     {
         if (grpArgs != "off" && grpArgs != "0")
         {
-            const std::vector<std::string_view> grpNbrAndRes = ObjUtils::StringUtils::splitString(
-                grpArgs);
-
-            const size_t groupNum = std::stol(grpNbrAndRes[0].data());
+            // Looks like: "mg group_number [resolution]".
+            const size_t groupNum = parseArgument<int64_t>(grpArgs);
 
             uint32_t resolution = 0;
-            if (grpNbrAndRes.size() > 1)
+            if (grpArgs.size() > 0)
             {
-                resolution = std::stol(grpNbrAndRes[1].data());
+                resolution = parseArgument<int64_t>(grpArgs);
             }
 
             m_currentGroups.push_back(m_objDB.insertEntity(
@@ -387,14 +1320,80 @@ void ObjFileParser::parseGroup(const ElemIDResult_t& elementIDRes)
 
 // =================================================================================================
 
-void ObjFileParser::endCurrentGroupsEntitiesRanges()
+void ObjFileParser::parseMaterialLibrary(const ElemIDResult_t& elementIDRes)
+{
+    OBJLOG("Parsing a Material library");
+
+    namespace fs = std::filesystem;
+
+    const std::string_view libArgs{elementIDRes.second};
+
+    // Libraries are relative to the Obj file's directory.
+    const fs::path objDirectory = m_objFilePath.parent_path();
+
+    auto insertLibrary = [this, &objDirectory](const std::string_view reference) {
+        // Libraries shared by many Obj files are parsed once.
+        m_objDB.insertMaterialLibrary(
+            reference, MtlLibraryCache::getInstance().getLibrary(objDirectory / reference));
+    };
+
+    // mtllib takes a list of files. A whole argument naming an existing file is one library whose
+    // name contains blanks.
+    if (libArgs.empty() == true)
+    {
+        return;
+    }
+
+    if (fs::is_regular_file(objDirectory / libArgs) == true)
+    {
+        insertLibrary(libArgs);
+    }
+    else
+    {
+        for (const std::string_view& reference : ObjUtils::StringUtils::splitString(libArgs))
+        {
+            insertLibrary(reference);
+        }
+    }
+}
+
+// =================================================================================================
+
+void ObjFileParser::parseMaterialName(const ElemIDResult_t& elementIDRes)
 {
-    for (size_t grpIdx : m_currentGroups)
+    OBJLOG("Parsing a Material name");
+
+    // A usemtl without name resets the material of the next faces.
+    const std::string_view materialName{elementIDRes.second};
+    if (materialName.empty() == true)
     {
+        m_currentMaterialID = NO_MATERIAL_ID;
+        return;
+    }
+
+    m_currentMaterialID = m_objDB.insertMaterialName(materialName).value_or(NO_MATERIAL_ID);
+}
+
+// =================================================================================================
+
+void ObjFileParser::endCurrentGroupsEntitiesRanges(const std::optional<ElementType> grpType)
+{
+    auto endGroupRange = [this, grpType](const size_t grpIdx) {
         std::optional<std::reference_wrapper<ObjEntityGroup>> grpOpt = m_objDB.getGroup(grpIdx);
         OBJASSERT(grpOpt.has_value() == true, "Invalid group index");
 
         ObjEntityGroup& grp = *grpOpt;
+        if ((grpType.has_value() == true) && (grp.getType() != *grpType))
+        {
+            return false;
+        }
+
         grp.endIncludedEntityRange(m_objDB.getEntitiesCount() - 1);
-    }
+        return true;
+    };
+
+    // Ended groups are no longer active.
+    m_currentGroups.erase(
+        std::remove_if(m_currentGroups.begin(), m_currentGroups.end(), endGroupRange),
+        m_currentGroups.end());
 }
@@ -0,0 +1,500 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ObjFileWriter.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "ObjFileWriter.h"
+
+#include "ObjDatabase.h"
+#include "ParallelUtils.h"
+#include "TextBuffer.h"
+#include "Utils.h"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdio>
+#include <iterator>
+
+#if __has_include(<fcntl.h>) && __has_include(<sys/uio.h>) && __has_include(<unistd.h>)
+#define OBJ_HAS_WRITEV
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+/// Minimum count of entities formatted by one worker.
+constexpr size_t minEntitiesPerWorker = 1 << 14;
+
+/// Count of entities formatted by one worker before the buffers are written. Bounds the memory
+/// used by the text buffers.
+constexpr size_t maxEntitiesPerWorker = 1 << 18;
+
+/// Order of the statements ending the groups, before the groups statements of the same entity.
+constexpr size_t endStatementOrder = 0;
+
+/// \brief  Return true if the type is a group type (g/s/mg/o).
+bool isGroupType(const ElementType type)
+{
+    return (type == ElementType::GROUP_NAME) || (type == ElementType::SMOOTHING_GROUP) ||
+           (type == ElementType::MERGING_GROUP) || (type == ElementType::OBJECT_NAME);
+}
+
+/// \brief  Return true if the group is the implicit "default" group the parser creates before
+///         the first entity.
+bool isImplicitDefaultGroup(const ObjEntityGroup& grp)
+{
+    const auto& ranges = grp.getEntitiesIndicesRange();
+
+    return (grp.getID() == 1) && (grp.getType() == ElementType::GROUP_NAME) &&
+           (grp.getGroupName()->get() == "default") && (ranges.empty() == false) &&
+           (ranges.front().first == 0);
+}
+
+#ifdef OBJ_HAS_WRITEV
+
+/// Output file's descriptor.
+using OutputFile_t = int;
+constexpr OutputFile_t invalidOutputFile = -1;
+
+/// \brief  Open the output file, truncated.
+OutputFile_t openOutputFile(const std::filesystem::path& filePath)
+{
+    return open(filePath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+}
+
+/// \brief  Close the output file. Return false on error.
+bool closeOutputFile(const OutputFile_t fd) { return (close(fd) == 0); }
+
+/// \brief  Write all the text buffers, in order, with one writev call, handling the partial
+///         writes.
+bool writeBuffers(const OutputFile_t fd, const std::vector<ObjUtils::TextBuffer>& buffers)
+{
+    std::vector<iovec> ioVectors;
+    ioVectors.reserve(buffers.size());
+    for (const ObjUtils::TextBuffer& text : buffers)
+    {
+        if (text.isEmpty() == false)
+        {
+            ioVectors.push_back(iovec{const_cast<char*>(text.getData()), text.getSize()});
+        }
+    }
+
+    for (size_t firstVectorIdx = 0; firstVectorIdx < ioVectors.size();)
+    {
+        const ssize_t writtenSize = writev(fd,
+                                           ioVectors.data() + firstVectorIdx,
+                                           static_cast<int>(ioVectors.size() - firstVectorIdx));
+        if (writtenSize < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+
+        // Skip the fully written buffers and advance in the partially written one.
+        size_t remainingSize = static_cast<size_t>(writtenSize);
+        while ((firstVectorIdx < ioVectors.size()) &&
+               (remainingSize >= ioVectors[firstVectorIdx].iov_len))
+        {
+            remainingSize -= ioVectors[firstVectorIdx].iov_len;
+            ++firstVectorIdx;
+        }
+        if (firstVectorIdx < ioVectors.size())
+        {
+            ioVectors[firstVectorIdx].iov_base = static_cast<char*>(
+                                                     ioVectors[firstVectorIdx].iov_base) +
+                                                 remainingSize;
+            ioVectors[firstVectorIdx].iov_len -= remainingSize;
+        }
+    }
+
+    return true;
+}
+
+#else
+
+/// Output file's stream, where writev isn't available.
+using OutputFile_t = std::FILE*;
+constexpr OutputFile_t invalidOutputFile = nullptr;
+
+/// \brief  Open the output file, truncated.
+OutputFile_t openOutputFile(const std::filesystem::path& filePath)
+{
+    return std::fopen(filePath.string().c_str(), "wb");
+}
+
+/// \brief  Close the output file. Return false on error.
+bool closeOutputFile(const OutputFile_t pFile) { return (std::fclose(pFile) == 0); }
+
+/// \brief  Write all the text buffers, in order.
+bool writeBuffers(const OutputFile_t pFile, const std::vector<ObjUtils::TextBuffer>& buffers)
+{
+    return std::all_of(buffers.cbegin(),
+                       buffers.cend(),
+                       [pFile](const ObjUtils::TextBuffer& text) {
+                           return (text.isEmpty() == true) ||
+                                  (std::fwrite(text.getData(), 1, text.getSize(), pFile) ==
+                                   text.getSize());
+                       });
+}
+
+#endif
+
+}  // namespace
+
+// =================================================================================================
+
+bool ObjFileWriter::writeFile(const std::filesystem::path& objFilePath) const
+{
+    const OutputFile_t outFile = openOutputFile(objFilePath);
+    if (outFile == invalidOutputFile)
+    {
+        OBJLOG("Could not open the Obj file for writing");
+        return false;
+    }
+
+    const std::vector<GroupStatement> statements = getGroupsStatements();
+    const size_t entitiesCount = m_objDB.getEntitiesCount();
+
+    std::vector<ObjUtils::TextBuffer> buffers(
+        ObjUtils::ParallelUtils::getWorkersCount(entitiesCount,
+                                                 minEntitiesPerWorker,
+                                                 m_workersCount));
+    const size_t roundSize = buffers.size() * maxEntitiesPerWorker;
+
+    // The first worker's chunk starts the file.
+    for (const std::string& libReference : m_objDB.getMaterialLibrariesRefs())
+    {
+        buffers.front().append("mtllib ").append(libReference).append('\n');
+    }
+
+    // Each round formats up to maxEntitiesPerWorker entities per worker, then writes them.
+    bool written = true;
+    for (size_t roundBegin = 0; (written == true) && (roundBegin < entitiesCount);
+         roundBegin += roundSize)
+    {
+        const size_t roundCount = std::min(roundSize, entitiesCount - roundBegin);
+
+        ObjUtils::ParallelUtils::parallelFor(
+            roundCount,
+            minEntitiesPerWorker,
+            [this, roundBegin, &statements, &buffers](const size_t chunkBegin,
+                                                      const size_t chunkEnd,
+                                                      const size_t workerIdx) {
+                formatEntities(roundBegin + chunkBegin,
+                               roundBegin + chunkEnd,
+                               statements,
+                               buffers[workerIdx]);
+            },
+            buffers.size());
+
+        written = writeBuffers(outFile, buffers);
+
+        for (ObjUtils::TextBuffer& text : buffers)
+        {
+            text.clear();
+        }
+    }
+
+    return (closeOutputFile(outFile) == true) && written;
+}
+
+// =================================================================================================
+
+std::vector<ObjFileWriter::GroupStatement> ObjFileWriter::getGroupsStatements() const
+{
+    const size_t entitiesCount = m_objDB.getEntitiesCount();
+
+    // Ranges of the groups, sorted by first entity then by group creation.
+    struct GroupRange
+    {
+        size_t m_first;
+        size_t m_last;
+        const ObjEntityGroup* m_pGroup;
+    };
+
+    std::vector<GroupRange> groupsRanges;
+    const ObjEntityGroup* pDefaultGroup = nullptr;
+
+    std::for_each(m_objDB.cbegin<ElementType::GROUP_NAME>(),
+                  m_objDB.cend<ElementType::GROUP_NAME>(),
+                  [&groupsRanges, &pDefaultGroup](const ObjEntityGroup& grp) {
+                      if (isImplicitDefaultGroup(grp) == true)
+                      {
+                          pDefaultGroup = &grp;
+                          return;
+                      }
+
+                      for (const auto& [first, last] : grp.getEntitiesIndicesRange())
+                      {
+                          groupsRanges.push_back(GroupRange{first, std::max(first, last), &grp});
+                      }
+                  });
+
+    std::stable_sort(groupsRanges.begin(),
+                     groupsRanges.end(),
+                     [](const GroupRange& lhs, const GroupRange& rhs) {
+                         return (lhs.m_first < rhs.m_first) ||
+                                ((lhs.m_first == rhs.m_first) &&
+                                 (lhs.m_pGroup->getID() < rhs.m_pGroup->getID()));
+                     });
+
+    std::vector<GroupStatement> statements;
+
+    // Ranges of the statements per group type (g/s/mg), to find where the groups end.
+    constexpr std::array<ElementType, 3> endableTypes = {ElementType::GROUP_NAME,
+                                                         ElementType::SMOOTHING_GROUP,
+                                                         ElementType::MERGING_GROUP};
+    std::array<std::vector<EntitiesIndexRange_t>, 3> statementsRanges;
+    if (pDefaultGroup != nullptr)
+    {
+        for (const auto& [first, last] : pDefaultGroup->getEntitiesIndicesRange())
+        {
+            statementsRanges[0].emplace_back(first, std::max(first, last));
+        }
+    }
+
+    for (size_t rangeIdx = 0; rangeIdx < groupsRanges.size(); ++rangeIdx)
+    {
+        const GroupRange& grpRange = groupsRanges[rangeIdx];
+        const ObjEntityGroup& grp = *grpRange.m_pGroup;
+
+        GroupStatement statement{grpRange.m_first, rangeIdx + 1};
+        size_t lastEntityIdx = grpRange.m_last;
+
+        switch (grp.getType())
+        {
+        case ElementType::GROUP_NAME:
+            // Names of the groups starting at the same entity share the same statement.
+            statement.m_line = "g " + grp.getGroupName()->get();
+            while ((rangeIdx + 1 < groupsRanges.size()) &&
+                   (groupsRanges[rangeIdx + 1].m_first == grpRange.m_first) &&
+                   (groupsRanges[rangeIdx + 1].m_pGroup->getType() == ElementType::GROUP_NAME))
+            {
+                ++rangeIdx;
+                statement.m_line += ' ';
+                statement.m_line += groupsRanges[rangeIdx].m_pGroup->getGroupName()->get();
+                lastEntityIdx = std::max(lastEntityIdx, groupsRanges[rangeIdx].m_last);
+            }
+            break;
+
+        case ElementType::SMOOTHING_GROUP:
+            statement.m_line = "s " + std::to_string(*grp.getGroupNumber());
+            break;
+
+        case ElementType::MERGING_GROUP:
+            statement.m_line = "mg " + std::to_string(*grp.getGroupNumber());
+            if (*grp.getResolution() != 0)
+            {
+                statement.m_line += ' ' + std::to_string(*grp.getResolution());
+            }
+            break;
+
+        case ElementType::OBJECT_NAME:
+            statement.m_line = "o " + grp.getGroupName()->get();
+            break;
+
+        default: break;
+        }
+
+        const auto typeItr = std::find(endableTypes.cbegin(), endableTypes.cend(), grp.getType());
+        if (typeItr != endableTypes.cend())
+        {
+            statementsRanges[std::distance(endableTypes.cbegin(), typeItr)].emplace_back(
+                grpRange.m_first, lastEntityIdx);
+        }
+
+        statements.push_back(std::move(statement));
+    }
+
+    // A group ends before the next statement of its type: the entities in between, if any, are
+    // included in no group of that type.
+    constexpr std::array<std::string_view, 3> endLines = {"g", "s off", "mg off"};
+    for (size_t typeIdx = 0; typeIdx < endableTypes.size(); ++typeIdx)
+    {
+        const std::vector<EntitiesIndexRange_t>& ranges = statementsRanges[typeIdx];
+        for (size_t rangeIdx = 0; rangeIdx < ranges.size(); ++rangeIdx)
+        {
+            const size_t nextFirst = (rangeIdx + 1 < ranges.size()) ? ranges[rangeIdx + 1].first :
+                                                                      entitiesCount;
+
+            // Only end the group if non-group entities follow it before the next statement.
+            const size_t endIdx = ranges[rangeIdx].second + 1;
+            size_t entityIdx = endIdx;
+            while ((entityIdx < nextFirst) &&
+                   (isGroupType(m_objDB.getEntitiesTable()[entityIdx].first) == true))
+            {
+                ++entityIdx;
+            }
+
+            if (entityIdx < nextFirst)
+            {
+                statements.push_back(
+                    GroupStatement{endIdx, endStatementOrder, std::string(endLines[typeIdx])});
+            }
+        }
+    }
+
+    std::stable_sort(statements.begin(),
+                     statements.end(),
+                     [](const GroupStatement& lhs, const GroupStatement& rhs) {
+                         return (lhs.m_entityTableIdx < rhs.m_entityTableIdx) ||
+                                ((lhs.m_entityTableIdx == rhs.m_entityTableIdx) &&
+                                 (lhs.m_order < rhs.m_order));
+                     });
+
+    return statements;
+}
+
+// =================================================================================================
+
+void ObjFileWriter::formatEntities(const size_t first,
+                                   const size_t last,
+                                   const std::vector<GroupStatement>& statements,
+                                   ObjUtils::TextBuffer& text) const
+{
+    auto statementItr = std::lower_bound(statements.cbegin(),
+                                         statements.cend(),
+                                         first,
+                                         [](const GroupStatement& statement, const size_t idx) {
+                                             return (statement.m_entityTableIdx < idx);
+                                         });
+
+    // Material of the last face before the range. A face's ID is its entities table index + 1.
+    MaterialID_t currentMaterialID = NO_MATERIAL_ID;
+    if (const auto faceItr = std::partition_point(m_objDB.cbegin<ElementType::FACE>(),
+                                                  m_objDB.cend<ElementType::FACE>(),
+                                                  [first](const ObjEntityFace& face) {
+                                                      return (face.getID() <= first);
+                                                  });
+        faceItr != m_objDB.cbegin<ElementType::FACE>())
+    {
+        currentMaterialID = std::prev(faceItr)->getMaterialID();
+    }
+
+    for (size_t entityIdx = first; entityIdx < last; ++entityIdx)
+    {
+        for (; (statementItr != statements.cend()) && (statementItr->m_entityTableIdx == entityIdx);
+             ++statementItr)
+        {
+            text.append(statementItr->m_line).append('\n');
+        }
+
+        // Vertices are copied from their location: a quantized database decodes them.
+        const auto [entityType, bufferIdx] = m_objDB.getEntitiesTable()[entityIdx];
+        switch (entityType)
+        {
+        case ElementType::VERTEX:
+        {
+            const ObjEntityVertex vtx = *m_objDB.getVertex(entityType, bufferIdx);
+            text.append("v ").append(vtx.m_x).append(' ').append(vtx.m_y).append(' ');
+            text.append(vtx.m_z);
+            if (vtx.m_w != 1.0f)
+            {
+                text.append(' ').append(vtx.m_w);
+            }
+        }
+        break;
+
+        case ElementType::VERTEX_TEXTURE:
+        case ElementType::VERTEX_PARAM_SPACE:
+        {
+            const ObjEntityVertex vtx = *m_objDB.getVertex(entityType, bufferIdx);
+            text.append((entityType == ElementType::VERTEX_TEXTURE) ? "vt " : "vp ");
+            text.append(vtx.m_x).append(' ').append(vtx.m_y);
+            if ((vtx.m_z != 0.0f) || (vtx.m_w != 1.0f))
+            {
+                text.append(' ').append(vtx.m_z);
+            }
+            if (vtx.m_w != 1.0f)
+            {
+                text.append(' ').append(vtx.m_w);
+            }
+        }
+        break;
+
+        case ElementType::VERTEX_NORMAL:
+        {
+            const ObjEntityVertex vtx = *m_objDB.getVertex(entityType, bufferIdx);
+            text.append("vn ").append(vtx.m_x).append(' ').append(vtx.m_y).append(' ');
+            text.append(vtx.m_z);
+        }
+        break;
+
+        case ElementType::FACE:
+        {
+            const ObjEntityFace& face =
+                static_cast<const ObjEntityFace&>(m_objDB.getEntity(entityIdx));
+            if (face.getMaterialID() != currentMaterialID)
+            {
+                currentMaterialID = face.getMaterialID();
+
+                // A usemtl without name resets the material.
+                text.append("usemtl");
+                if (currentMaterialID != NO_MATERIAL_ID)
+                {
+                    text.append(' ').append(m_objDB.getMaterialName(currentMaterialID));
+                }
+                text.append('\n');
+            }
+
+            const size_t stride = face.getIndicesStride();
+            const VerticesIdxOrganization vtxIdxOrg = face.getVerticesIndicesOrganization();
+            const auto [idxItr, idxEnd] = m_objDB.getVerticesIterators(face);
+
+            text.append('f');
+            for (auto tripletItr = idxItr; tripletItr < idxEnd; tripletItr += stride)
+            {
+                text.append(' ').append(tripletItr[0]);
+
+                switch (vtxIdxOrg)
+                {
+                case VerticesIdxOrganization::VGEO_VTEXTURE:
+                    text.append('/').append(tripletItr[1]);
+                    break;
+                case VerticesIdxOrganization::VGEO_VNORMAL:
+                    text.append("//").append(tripletItr[1]);
+                    break;
+                case VerticesIdxOrganization::VGEO_VTEXTURE_VNORMAL:
+                    text.append('/').append(tripletItr[1]).append('/').append(tripletItr[2]);
+                    break;
+
+                case VerticesIdxOrganization::VGEO:
+                default: break;
+                }
+            }
+        }
+        break;
+
+        // Groups are written through their statements.
+        default: continue;
+        }
+
+        text.append('\n');
+    }
+}
@@ -0,0 +1,314 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ObjGlbExporter.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "ObjGlbExporter.h"
+
+#include "ObjRenderMesh.h"
+#include "TextBuffer.h"
+#include "Utils.h"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace
+{
+constexpr uint32_t glbMagic = 0x46546C67;          ///< "glTF".
+constexpr uint32_t glbVersion = 2;                 ///< glTF 2.0.
+constexpr uint32_t glbChunkTypeJson = 0x4E4F534A;  ///< "JSON".
+constexpr uint32_t glbChunkTypeBin = 0x004E4942;   ///< "BIN\0".
+constexpr size_t glbHeaderSize = 12;
+constexpr size_t glbChunkHeaderSize = 8;
+
+// glTF enumerations.
+constexpr int gltfArrayBuffer = 34962;
+constexpr int gltfElementArrayBuffer = 34963;
+constexpr int gltfFloat = 5126;
+constexpr int gltfUnsignedInt = 5125;
+constexpr int gltfTriangles = 4;
+
+/// Count of floats converted at once when streaming the texture coordinates.
+constexpr size_t stagingFloatsCount = 16 * 1024;
+
+/// \brief  Round a size up to the 4 bytes alignment required by the GLB chunks.
+constexpr size_t alignTo4(const size_t size) { return (size + 3) & ~size_t(3); }
+
+/// \brief  Write a 32 bits unsigned integer in little-endian.
+bool writeUInt32(std::FILE* pFile, const uint32_t value)
+{
+    const std::array<unsigned char, 4> bytes = {static_cast<unsigned char>(value),
+                                                static_cast<unsigned char>(value >> 8),
+                                                static_cast<unsigned char>(value >> 16),
+                                                static_cast<unsigned char>(value >> 24)};
+
+    return (std::fwrite(bytes.data(), 1, bytes.size(), pFile) == bytes.size());
+}
+
+/// \brief  Write a vector's content as raw bytes.
+template<typename T>
+bool writeArray(std::FILE* pFile, const std::vector<T>& values)
+{
+    return (std::fwrite(values.data(), sizeof(T), values.size(), pFile) == values.size());
+}
+
+/// Size of the JSON pieces given to the sink.
+constexpr size_t jsonPieceSize = 4 * 1024;
+
+}  // namespace
+
+// =================================================================================================
+
+bool ObjGlbExporter::exportFile(const std::filesystem::path& glbFilePath) const
+{
+    if (m_renderMesh.getTrianglesCount() == 0)
+    {
+        return false;
+    }
+
+    // The JSON document is generated twice: once to measure it, once to write it. This avoids
+    // keeping the whole document in memory.
+    size_t jsonSize = 0;
+    writeJson([&jsonSize](std::string_view piece) { jsonSize += piece.size(); });
+
+    const size_t jsonChunkSize = alignTo4(jsonSize);
+    const size_t binChunkSize = getBinarySize();
+    const size_t glbSize = glbHeaderSize + glbChunkHeaderSize + jsonChunkSize +
+                           glbChunkHeaderSize + binChunkSize;
+
+    if (glbSize > std::numeric_limits<uint32_t>::max())
+    {
+        OBJLOG("GLB files are limited to 4 GiB");
+        return false;
+    }
+
+    const std::unique_ptr<std::FILE, decltype(&fclose)> smtGlbFile(
+        std::fopen(glbFilePath.c_str(), "wb"), &fclose);
+    if (smtGlbFile == nullptr)
+    {
+        return false;
+    }
+
+    std::FILE* pFile = smtGlbFile.get();
+
+    // Header.
+    bool written = writeUInt32(pFile, glbMagic) && writeUInt32(pFile, glbVersion) &&
+                   writeUInt32(pFile, static_cast<uint32_t>(glbSize));
+
+    // JSON chunk, padded with spaces.
+    written = written && writeUInt32(pFile, static_cast<uint32_t>(jsonChunkSize)) &&
+              writeUInt32(pFile, glbChunkTypeJson);
+    writeJson([pFile, &written](std::string_view piece) {
+        written = written && (std::fwrite(piece.data(), 1, piece.size(), pFile) == piece.size());
+    });
+    for (size_t paddingIdx = jsonSize; paddingIdx < jsonChunkSize; ++paddingIdx)
+    {
+        written = written && (std::fputc(' ', pFile) != EOF);
+    }
+
+    // Binary chunk, all its buffer views are 4 bytes aligned.
+    written = written && writeUInt32(pFile, static_cast<uint32_t>(binChunkSize)) &&
+              writeUInt32(pFile, glbChunkTypeBin) && writeBinary(pFile);
+
+    return written;
+}
+
+// =================================================================================================
+
+void ObjGlbExporter::writeJson(const JsonSink_t& sink) const
+{
+    const size_t verticesCount = m_renderMesh.getVerticesCount();
+    const auto& subMeshes = m_renderMesh.getSubMeshes();
+
+    const size_t positionsSize = m_renderMesh.getPositions().size() * sizeof(float);
+    const size_t normalsSize = m_renderMesh.getNormals().size() * sizeof(float);
+    const size_t texCoordsSize = m_renderMesh.getTexCoords().size() * sizeof(float);
+    const size_t indicesSize = m_renderMesh.getIndices().size() * sizeof(uint32_t);
+
+    // Attributes accessors and buffer views share the same index: positions, then normals and
+    // texture coordinates when present. The indices' buffer view comes last.
+    const size_t normalIdx = 1;
+    const size_t texCoordIdx = (m_renderMesh.hasNormals() == true) ? 2 : 1;
+    const size_t attributesCount = 1 + (m_renderMesh.hasNormals() == true) +
+                                   (m_renderMesh.hasTexCoords() == true);
+
+    // The document is built in a bounded buffer, handed to the sink whenever it fills up.
+    ObjUtils::TextBuffer json(jsonPieceSize * 2);
+    auto flushPiece = [&sink, &json](const bool force) {
+        if ((force == true) || (json.getSize() >= jsonPieceSize))
+        {
+            sink(json.getView());
+            json.clear();
+        }
+    };
+
+    json.append(R"({"asset":{"version":"2.0","generator":"dotObjParser"},"scene":0,"scenes":[)");
+    json.append(R"({"nodes":[)");
+    for (size_t meshIdx = 0; meshIdx < subMeshes.size(); ++meshIdx)
+    {
+        json.append((meshIdx == 0) ? "" : ",").append(meshIdx);
+    }
+
+    json.append("]}],\"nodes\":[");
+    for (size_t meshIdx = 0; meshIdx < subMeshes.size(); ++meshIdx)
+    {
+        json.append((meshIdx == 0) ? "" : ",").append("{\"mesh\":").append(meshIdx).append('}');
+        flushPiece(false);
+    }
+
+    // One mesh per sub-mesh, all sharing the same vertices attributes.
+    json.append("],\"meshes\":[");
+    for (size_t meshIdx = 0; meshIdx < subMeshes.size(); ++meshIdx)
+    {
+        json.append((meshIdx == 0) ? "" : ",").append("{\"name\":");
+        json.appendJsonString(subMeshes[meshIdx].m_name);
+        json.append(",\"primitives\":[{\"attributes\":{\"POSITION\":0");
+        if (m_renderMesh.hasNormals() == true)
+        {
+            json.append(",\"NORMAL\":").append(normalIdx);
+        }
+        if (m_renderMesh.hasTexCoords() == true)
+        {
+            json.append(",\"TEXCOORD_0\":").append(texCoordIdx);
+        }
+        json.append("},\"indices\":").append(attributesCount + meshIdx);
+        json.append(",\"mode\":").append(gltfTriangles).append("}]}");
+        flushPiece(false);
+    }
+
+    json.append("],\"buffers\":[{\"byteLength\":").append(getBinarySize()).append("}]");
+
+    // Buffer views.
+    size_t byteOffset = 0;
+    auto appendBufferView = [&json, &byteOffset](const size_t byteLength,
+                                                 const size_t byteStride,
+                                                 const int target) {
+        json.append((byteOffset == 0) ? "" : ",");
+        json.append("{\"buffer\":0,\"byteOffset\":").append(byteOffset);
+        json.append(",\"byteLength\":").append(byteLength);
+        if (byteStride > 0)
+        {
+            json.append(",\"byteStride\":").append(byteStride);
+        }
+        json.append(",\"target\":").append(target).append('}');
+
+        byteOffset += byteLength;
+    };
+
+    json.append(",\"bufferViews\":[");
+    appendBufferView(positionsSize, 3 * sizeof(float), gltfArrayBuffer);
+    if (m_renderMesh.hasNormals() == true)
+    {
+        appendBufferView(normalsSize, 3 * sizeof(float), gltfArrayBuffer);
+    }
+    if (m_renderMesh.hasTexCoords() == true)
+    {
+        appendBufferView(texCoordsSize, 2 * sizeof(float), gltfArrayBuffer);
+    }
+    appendBufferView(indicesSize, 0, gltfElementArrayBuffer);
+
+    // Accessors. Positions require their bounds.
+    auto appendFloatAccessor = [&json, verticesCount](const size_t viewIdx,
+                                                      std::string_view type) {
+        json.append("{\"bufferView\":").append(viewIdx);
+        json.append(",\"componentType\":").append(gltfFloat);
+        json.append(",\"count\":").append(verticesCount);
+        json.append(",\"type\":\"").append(type).append('"');
+    };
+
+    const auto& boundsMin = m_renderMesh.getBoundsMin();
+    const auto& boundsMax = m_renderMesh.getBoundsMax();
+
+    json.append("],\"accessors\":[");
+    appendFloatAccessor(0, "VEC3");
+    json.append(",\"min\":[").append(boundsMin[0]).append(',').append(boundsMin[1]);
+    json.append(',').append(boundsMin[2]);
+    json.append("],\"max\":[").append(boundsMax[0]).append(',').append(boundsMax[1]);
+    json.append(',').append(boundsMax[2]).append("]}");
+
+    if (m_renderMesh.hasNormals() == true)
+    {
+        json.append(',');
+        appendFloatAccessor(normalIdx, "VEC3");
+        json.append('}');
+    }
+    if (m_renderMesh.hasTexCoords() == true)
+    {
+        json.append(',');
+        appendFloatAccessor(texCoordIdx, "VEC2");
+        json.append('}');
+    }
+
+    // One indices accessor per sub-mesh, over its range of the indices buffer view.
+    for (const ObjRenderMesh::SubMesh& subMesh : subMeshes)
+    {
+        json.append(",{\"bufferView\":").append(attributesCount);
+        json.append(",\"byteOffset\":").append(subMesh.m_firstIndex * sizeof(uint32_t));
+        json.append(",\"componentType\":").append(gltfUnsignedInt);
+        json.append(",\"count\":").append(subMesh.m_indicesCount).append(",\"type\":\"SCALAR\"}");
+        flushPiece(false);
+    }
+
+    json.append("]}");
+    flushPiece(true);
+}
+
+// =================================================================================================
+
+bool ObjGlbExporter::writeBinary(std::FILE* pFile) const
+{
+    // The host is assumed little-endian, as glTF requires, so the attributes and indices are
+    // written as is.
+    bool written = writeArray(pFile, m_renderMesh.getPositions()) &&
+                   writeArray(pFile, m_renderMesh.getNormals());
+
+    // glTF's texture coordinates origin is the top left corner, Obj's is the bottom left one.
+    const std::vector<float>& texCoords = m_renderMesh.getTexCoords();
+    std::vector<float> staging(std::min(stagingFloatsCount, texCoords.size()));
+    for (size_t first = 0; (written == true) && (first < texCoords.size()); first += staging.size())
+    {
+        const size_t count = std::min(staging.size(), texCoords.size() - first);
+        for (size_t floatIdx = 0; floatIdx < count; floatIdx += 2)
+        {
+            staging[floatIdx] = texCoords[first + floatIdx];
+            staging[floatIdx + 1] = 1.0f - texCoords[first + floatIdx + 1];
+        }
+
+        written = (std::fwrite(staging.data(), sizeof(float), count, pFile) == count);
+    }
+
+    return written && writeArray(pFile, m_renderMesh.getIndices());
+}
+
+// =================================================================================================
+
+size_t ObjGlbExporter::getBinarySize() const
+{
+    return (m_renderMesh.getPositions().size() + m_renderMesh.getNormals().size() +
+            m_renderMesh.getTexCoords().size()) *
+               sizeof(float) +
+           m_renderMesh.getIndices().size() * sizeof(uint32_t);
+}
@@ -0,0 +1,272 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ObjHalfEdgeMesh.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "ObjHalfEdgeMesh.h"
+
+#include "ObjDatabase.h"
+#include "ParallelUtils.h"
+#include "Utils.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace
+{
+/// Minimum count of faces or half-edges processed by one worker.
+constexpr size_t minChunkSize = 1 << 14;
+
+/// \brief  Undirected edge key of a half-edge: the 2 vertices indices, smallest first.
+struct EdgeKey
+{
+    uint64_t m_vertices;  ///< (min vertex << 32) | max vertex.
+    uint32_t m_heIdx;     ///< Half-edge index.
+};
+
+}  // namespace
+
+// =================================================================================================
+
+ObjHalfEdgeMesh::ObjHalfEdgeMesh(const ObjDatabase& objDB)
+{
+    OBJASSERT(objDB.getVerticesCount() < INVALID_INDEX, "Too many vertices for 32-bit indices");
+
+    buildHalfEdges(objDB);
+    matchTwins();
+
+    // Give each vertex one outgoing half-edge, preferring boundary ones so that walking around a
+    // boundary vertex can start from the boundary.
+    m_vertexHalfEdge.assign(objDB.getVerticesCount(), INVALID_INDEX);
+    for (uint32_t heIdx = 0; heIdx < m_heOrigin.size(); ++heIdx)
+    {
+        uint32_t& vtxHalfEdge = m_vertexHalfEdge[m_heOrigin[heIdx]];
+        if ((vtxHalfEdge == INVALID_INDEX) || (isBoundaryEdge(heIdx) == true))
+        {
+            vtxHalfEdge = heIdx;
+        }
+    }
+}
+
+// =================================================================================================
+
+std::vector<uint32_t> ObjHalfEdgeMesh::getNeighborFaces(const uint32_t faceIdx) const
+{
+    std::vector<uint32_t> neighbors;
+    neighbors.reserve(getFaceHalfEdgesCount(faceIdx));
+
+    for (uint32_t heIdx = m_faceFirstHalfEdge[faceIdx]; heIdx < m_faceFirstHalfEdge[faceIdx + 1];
+         ++heIdx)
+    {
+        if (const uint32_t twinIdx = m_heTwin[heIdx]; twinIdx != INVALID_INDEX)
+        {
+            neighbors.push_back(m_heFace[twinIdx]);
+        }
+    }
+
+    return neighbors;
+}
+
+// =================================================================================================
+
+void ObjHalfEdgeMesh::buildHalfEdges(const ObjDatabase& objDB)
+{
+    const size_t facesCount = objDB.getFacesCount();
+    const size_t verticesCount = objDB.getVerticesCount();
+    const auto facesBegin = objDB.cbegin<ElementType::FACE>();
+
+    // Geometric vertices indices are 1-based, anything outside [1, verticesCount] is invalid.
+    auto isValidIndex = [verticesCount](const size_t vtxIdx) {
+        return (vtxIdx >= 1) && (vtxIdx <= verticesCount);
+    };
+
+    // Count the half-edges of each face, faces with invalid indices get none.
+    m_faceFirstHalfEdge.assign(facesCount + 1, 0);
+    ObjUtils::ParallelUtils::parallelFor(
+        facesCount, minChunkSize, [&](const size_t faceBegin, const size_t faceEnd, size_t) {
+            for (size_t faceIdx = faceBegin; faceIdx < faceEnd; ++faceIdx)
+            {
+                const ObjEntityFace& face = facesBegin[faceIdx];
+                const size_t stride = face.getIndicesStride();
+                const auto [idxItr, idxEnd] = objDB.getVerticesIterators(face);
+
+                size_t cornersCount = 0;
+                for (auto cornerItr = idxItr; cornerItr < idxEnd; cornerItr += stride)
+                {
+                    if (isValidIndex(*cornerItr) == false)
+                    {
+                        cornersCount = 0;
+                        break;
+                    }
+
+                    ++cornersCount;
+                }
+
+                m_faceFirstHalfEdge[faceIdx + 1] = (cornersCount >= 3) ? cornersCount : 0;
+            }
+        });
+
+    std::partial_sum(m_faceFirstHalfEdge.cbegin(),
+                     m_faceFirstHalfEdge.cend(),
+                     m_faceFirstHalfEdge.begin());
+
+    const size_t halfEdgesCount = m_faceFirstHalfEdge.back();
+    OBJASSERT(halfEdgesCount < INVALID_INDEX, "Too many half-edges for 32-bit indices");
+
+    m_heOrigin.resize(halfEdgesCount);
+    m_heFace.resize(halfEdgesCount);
+
+    // Fill the half-edges of each face.
+    ObjUtils::ParallelUtils::parallelFor(
+        facesCount, minChunkSize, [&](const size_t faceBegin, const size_t faceEnd, size_t) {
+            for (size_t faceIdx = faceBegin; faceIdx < faceEnd; ++faceIdx)
+            {
+                uint32_t heIdx = m_faceFirstHalfEdge[faceIdx];
+                if (heIdx == m_faceFirstHalfEdge[faceIdx + 1])
+                {
+                    continue;
+                }
+
+                const ObjEntityFace& face = facesBegin[faceIdx];
+                const size_t stride = face.getIndicesStride();
+                const auto [idxItr, idxEnd] = objDB.getVerticesIterators(face);
+
+                for (auto cornerItr = idxItr; cornerItr < idxEnd; cornerItr += stride, ++heIdx)
+                {
+                    m_heOrigin[heIdx] = static_cast<uint32_t>(*cornerItr - 1);
+                    m_heFace[heIdx] = static_cast<uint32_t>(faceIdx);
+                }
+            }
+        });
+
+    for (size_t faceIdx = 0; faceIdx < facesCount; ++faceIdx)
+    {
+        m_skippedFacesCount += (getFaceHalfEdgesCount(static_cast<uint32_t>(faceIdx)) == 0) ? 1 : 0;
+    }
+}
+
+// =================================================================================================
+
+void ObjHalfEdgeMesh::matchTwins()
+{
+    const size_t halfEdgesCount = m_heOrigin.size();
+
+    m_heTwin.assign(halfEdgesCount, INVALID_INDEX);
+    m_heEdgeFlags.assign(halfEdgesCount, EDGE_MANIFOLD);
+
+    // Key every half-edge by its undirected edge.
+    std::vector<EdgeKey> edgeKeys(halfEdgesCount);
+    ObjUtils::ParallelUtils::parallelFor(
+        halfEdgesCount, minChunkSize, [&](const size_t heBegin, const size_t heEnd, size_t) {
+            for (size_t heIdx = heBegin; heIdx < heEnd; ++heIdx)
+            {
+                const uint64_t originIdx = m_heOrigin[heIdx];
+                const uint64_t targetIdx = m_heOrigin[getNext(static_cast<uint32_t>(heIdx))];
+
+                edgeKeys[heIdx] = {(std::min(originIdx, targetIdx) << 32) |
+                                       std::max(originIdx, targetIdx),
+                                   static_cast<uint32_t>(heIdx)};
+            }
+        });
+
+    // Half-edges of the same edge become neighbors once sorted.
+    ObjUtils::ParallelUtils::parallelSort(edgeKeys.begin(),
+                                          edgeKeys.end(),
+                                          [](const EdgeKey& lhs, const EdgeKey& rhs) {
+                                              return (lhs.m_vertices < rhs.m_vertices) ||
+                                                     ((lhs.m_vertices == rhs.m_vertices) &&
+                                                      (lhs.m_heIdx < rhs.m_heIdx));
+                                          });
+
+    // Classify each run of equal keys. Workers' chunks are moved forward to start on a run.
+    const size_t maxWorkersCount = ObjUtils::ParallelUtils::getWorkersCount(halfEdgesCount,
+                                                                            minChunkSize);
+    std::vector<size_t> boundaryCounts(maxWorkersCount, 0);
+    std::vector<size_t> nonManifoldCounts(maxWorkersCount, 0);
+
+    auto alignOnRun = [&edgeKeys, halfEdgesCount](size_t keyIdx) {
+        while ((keyIdx > 0) && (keyIdx < halfEdgesCount) &&
+               (edgeKeys[keyIdx].m_vertices == edgeKeys[keyIdx - 1].m_vertices))
+        {
+            ++keyIdx;
+        }
+
+        return keyIdx;
+    };
+
+    ObjUtils::ParallelUtils::parallelFor(
+        halfEdgesCount,
+        minChunkSize,
+        [&](const size_t keyBegin, const size_t keyEnd, const size_t workerIdx) {
+            const size_t runsEnd = alignOnRun(keyEnd);
+            for (size_t runBegin = alignOnRun(keyBegin); runBegin < runsEnd;)
+            {
+                size_t runEnd = runBegin + 1;
+                while ((runEnd < halfEdgesCount) &&
+                       (edgeKeys[runEnd].m_vertices == edgeKeys[runBegin].m_vertices))
+                {
+                    ++runEnd;
+                }
+
+                switch (runEnd - runBegin)
+                {
+                case 1: ++boundaryCounts[workerIdx]; break;
+
+                case 2:
+                {
+                    const uint32_t heIdx = edgeKeys[runBegin].m_heIdx;
+                    const uint32_t otherHeIdx = edgeKeys[runBegin + 1].m_heIdx;
+
+                    if (m_heOrigin[heIdx] != m_heOrigin[otherHeIdx])
+                    {
+                        m_heTwin[heIdx] = otherHeIdx;
+                        m_heTwin[otherHeIdx] = heIdx;
+                    }
+                    else
+                    {
+                        m_heEdgeFlags[heIdx] = m_heEdgeFlags[otherHeIdx] = EDGE_INCONSISTENT;
+                        ++nonManifoldCounts[workerIdx];
+                    }
+                }
+                break;
+
+                default:
+                    for (size_t keyIdx = runBegin; keyIdx < runEnd; ++keyIdx)
+                    {
+                        m_heEdgeFlags[edgeKeys[keyIdx].m_heIdx] = EDGE_NON_MANIFOLD;
+                    }
+                    ++nonManifoldCounts[workerIdx];
+                    break;
+                }
+
+                runBegin = runEnd;
+            }
+        });
+
+    m_boundaryEdgesCount = std::accumulate(boundaryCounts.cbegin(),
+                                           boundaryCounts.cend(),
+                                           size_t{0});
+    m_nonManifoldEdgesCount = std::accumulate(nonManifoldCounts.cbegin(),
+                                              nonManifoldCounts.cend(),
+                                              size_t{0});
+}
@@ -0,0 +1,143 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ObjLazyParser.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "ObjLazyParser.h"
+#include "ObjCompressedStreamReader.h"
+#include "ObjReadAheadStreamReader.h"
+
+#include "Utils.h"
+
+#include <algorithm>
+
+namespace
+{
+/// \brief  Return the reader suiting an Obj file.
+std::unique_ptr<ObjStreamReader> openFileReader(const std::string& objFilePath)
+{
+    if (ObjCompressedStreamReader::detectCompression(objFilePath) !=
+        ObjCompressedStreamReader::Compression::NONE)
+    {
+        return std::make_unique<ObjCompressedStreamReader>(objFilePath);
+    }
+
+    return std::make_unique<ObjReadAheadStreamReader>(objFilePath);
+}
+
+/// \brief  Return a group going on from another batch, including no entity yet.
+ObjEntityGroup makeContinuedGroup(const ObjEntityGroup& grp)
+{
+    switch (grp.getType())
+    {
+    case ElementType::SMOOTHING_GROUP:
+        return ObjEntityGroup{grp.getType(), 0, *grp.getGroupNumber()};
+
+    case ElementType::MERGING_GROUP:
+        return ObjEntityGroup{grp.getType(), 0, *grp.getGroupNumber(), *grp.getResolution()};
+
+    default: return ObjEntityGroup{grp.getType(), 0, grp.getGroupName()->get()};
+    }
+}
+
+}  // namespace
+
+// =================================================================================================
+
+ObjLazyParser::ObjLazyParser(const std::string& objFilePath, const size_t batchSize) :
+    m_parser(objFilePath),
+    m_pFileReader(openFileReader(objFilePath)), m_lineReader(*m_pFileReader),
+    m_batchSize(std::max<size_t>(batchSize, 1))
+{
+    // Created before parsing the first entity, as by ObjFileParser.
+    m_activeGroups.emplace_back(ElementType::GROUP_NAME, 0, "default");
+}
+
+// =================================================================================================
+
+ObjLazyParser::ObjLazyParser(ObjStreamReader& reader, const size_t batchSize) :
+    m_lineReader(reader), m_batchSize(std::max<size_t>(batchSize, 1))
+{
+    m_activeGroups.emplace_back(ElementType::GROUP_NAME, 0, "default");
+}
+
+// =================================================================================================
+
+bool ObjLazyParser::parseNextBatch()
+{
+    if (m_isTextEnd == true)
+    {
+        return false;
+    }
+
+    ObjDatabase& objDB = m_parser.m_objDB;
+
+    // The elements of the current batch are removed. Their counts remain, the negative indices
+    // of the next faces are relative to them.
+    for (size_t bufferIdx = 0; bufferIdx < m_parser.m_pulledVerticesCounts.size(); ++bufferIdx)
+    {
+        m_parser.m_pulledVerticesCounts[bufferIdx] +=
+            objDB.getVerticesCount(static_cast<ElementType>(bufferIdx));
+    }
+    m_pulledFacesCount += objDB.getFacesCount();
+
+    // The materials are kept, the faces of all the batches share their IDs.
+    ObjDatabase::Checkpoint batchStart;
+    batchStart.m_materialsCount = objDB.getMaterialsCount();
+    batchStart.m_materialLibrariesCount = objDB.getMaterialLibrariesRefs().size();
+    objDB.rollback(batchStart);
+
+    for (const ObjEntityGroup& grp : m_activeGroups)
+    {
+        m_parser.m_currentGroups.push_back(objDB.insertEntity(makeContinuedGroup(grp)));
+    }
+
+    // The continued groups don't count, each batch parses at least one line.
+    const size_t continuedGroupsCount = objDB.getEntitiesCount();
+    while (objDB.getEntitiesCount() - continuedGroupsCount < m_batchSize)
+    {
+        const std::optional<std::string_view> oneLine = m_lineReader.readLine();
+        if (oneLine.has_value() == false)
+        {
+            m_isTextEnd = true;
+            break;
+        }
+
+        m_parser.parseElement(*oneLine);
+    }
+
+    // The active groups end with the batch, and go on in the next one.
+    m_activeGroups.clear();
+    for (const size_t grpIdx : m_parser.m_currentGroups)
+    {
+        const std::optional<std::reference_wrapper<ObjEntityGroup>> grpOpt = objDB.getGroup(grpIdx);
+        OBJASSERT(grpOpt.has_value() == true, "Invalid group index");
+
+        m_activeGroups.push_back(*grpOpt);
+    }
+
+    m_parser.endParsing();
+
+    // The last batch holding only the groups going on is empty.
+    return (m_isTextEnd == false) || (objDB.getEntitiesCount() > objDB.getGroupsCount());
+}
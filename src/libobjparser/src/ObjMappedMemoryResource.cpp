@@ -0,0 +1,207 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ObjMappedMemoryResource.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "ObjMappedMemoryResource.h"
+
+#include "Utils.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#if __has_include(<sys/mman.h>)
+#define OBJ_HAS_MMAP
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+ObjMappedMemoryResource::ObjMappedMemoryResource(const size_t residentBudget,
+                                                 std::filesystem::path tempDirectory)
+    : m_residentBudget(residentBudget), m_tempDirectory(std::move(tempDirectory))
+{
+}
+
+// =================================================================================================
+
+ObjMappedMemoryResource::~ObjMappedMemoryResource()
+{
+    OBJASSERT((m_heapBytes == 0) && (m_mappings.empty() == true),
+              "Memory resource destroyed before its allocations");
+}
+
+// =================================================================================================
+
+void ObjMappedMemoryResource::releaseResidentPages()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    releaseResidentPagesLocked();
+}
+
+// =================================================================================================
+
+size_t ObjMappedMemoryResource::getHeapBytesCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_heapBytes;
+}
+
+// =================================================================================================
+
+size_t ObjMappedMemoryResource::getMappedBytesCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_mappedBytes;
+}
+
+// =================================================================================================
+
+size_t ObjMappedMemoryResource::getPeakMappedBytesCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_peakMappedBytes;
+}
+
+// =================================================================================================
+
+size_t ObjMappedMemoryResource::getMappingsCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_mappings.size();
+}
+
+// =================================================================================================
+
+void* ObjMappedMemoryResource::do_allocate(size_t bytes, size_t alignment)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+#ifdef OBJ_HAS_MMAP
+    if ((m_heapBytes + bytes) > m_residentBudget)
+    {
+        // Pages are at least as aligned as any fundamental type.
+        OBJASSERT(alignment <= static_cast<size_t>(sysconf(_SC_PAGESIZE)),
+                  "Alignment larger than a page");
+
+        return mapFile(bytes);
+    }
+#endif
+
+    void* const p = std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    m_heapBytes += bytes;
+
+    return p;
+}
+
+// =================================================================================================
+
+void ObjMappedMemoryResource::do_deallocate(void* p, size_t bytes, size_t alignment)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+#ifdef OBJ_HAS_MMAP
+    if (const auto mappingItr = m_mappings.find(p); mappingItr != m_mappings.end())
+    {
+        munmap(p, mappingItr->second);
+        m_mappedBytes -= mappingItr->second;
+        m_mappings.erase(mappingItr);
+
+        return;
+    }
+#endif
+
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    m_heapBytes -= bytes;
+}
+
+// =================================================================================================
+
+void* ObjMappedMemoryResource::mapFile(const size_t bytes)
+{
+#ifdef OBJ_HAS_MMAP
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t mappingSize = ((std::max<size_t>(bytes, 1) + pageSize - 1) / pageSize) * pageSize;
+
+    // Keep the resident pages within the budget, the buffer being grown is read back if needed.
+    if ((m_mappedBytes + mappingSize) > m_residentBudget)
+    {
+        releaseResidentPagesLocked();
+    }
+
+    std::string filePath = (m_tempDirectory / "objparser-XXXXXX").string();
+
+    const int fd = mkstemp(filePath.data());
+    if (fd == -1)
+    {
+        OBJLOG("Unable to create a temporary file in : ", m_tempDirectory.string());
+        throw std::bad_alloc();
+    }
+
+    // The file lives until its mapping is released.
+    unlink(filePath.c_str());
+
+    void* pMapping = MAP_FAILED;
+    if (ftruncate(fd, static_cast<off_t>(mappingSize)) == 0)
+    {
+        pMapping = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+
+    close(fd);
+
+    if (pMapping == MAP_FAILED)
+    {
+        OBJLOG("Unable to map a temporary file of ", mappingSize, " bytes");
+        throw std::bad_alloc();
+    }
+
+    m_mappings.emplace(pMapping, mappingSize);
+    m_mappedBytes += mappingSize;
+    m_peakMappedBytes = std::max(m_peakMappedBytes, m_mappedBytes);
+
+    return pMapping;
+#else
+    (void)bytes;
+
+    throw std::bad_alloc();
+#endif
+}
+
+// =================================================================================================
+
+void ObjMappedMemoryResource::releaseResidentPagesLocked()
+{
+#ifdef OBJ_HAS_MMAP
+    // The mappings are shared: their dirty pages are kept by the page cache and written back.
+    for (const auto& [pMapping, mappingSize] : m_mappings)
+    {
+        madvise(pMapping, mappingSize, MADV_DONTNEED);
+    }
+#endif
+}
@@ -0,0 +1,116 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ObjMaterial.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "ObjMaterial.h"
+
+#include "ParallelUtils.h"
+
+#include <algorithm>
+
+ObjMaterial& ObjMaterialLibrary::insertMaterial(std::string_view name)
+{
+    if (const auto materialItr = m_materialsIndices.find(name);
+        materialItr != m_materialsIndices.cend())
+    {
+        return m_materials[materialItr->second];
+    }
+
+    // Intern the name: the material and the index map view the pooled string.
+    const std::string_view internedName = m_namesPool.emplace_back(name);
+
+    m_materialsIndices.emplace(internedName, m_materials.size());
+    return m_materials.emplace_back(internedName);
+}
+
+// =================================================================================================
+
+std::optional<std::reference_wrapper<const ObjMaterial>>
+ObjMaterialLibrary::findMaterial(std::string_view name) const
+{
+    if (const auto materialItr = m_materialsIndices.find(name);
+        materialItr != m_materialsIndices.cend())
+    {
+        return m_materials[materialItr->second];
+    }
+
+    return std::nullopt;
+}
+
+// =================================================================================================
+
+size_t ObjMaterialLibrary::insertTexture(std::string_view filePath)
+{
+    const auto [textureItr, inserted] = m_texturesIndices.try_emplace(std::string(filePath),
+                                                                      m_texturesFiles.size());
+    if (inserted == true)
+    {
+        m_texturesFiles.emplace_back(filePath);
+    }
+
+    return textureItr->second;
+}
+
+// =================================================================================================
+
+void ObjMaterialLibrary::resolveTextures()
+{
+    namespace fs = std::filesystem;
+
+    // The task only uses copies: the library may be moved while it runs.
+    auto resolve = [mtlDirectory = m_mtlFilePath.parent_path(), texturesFiles = m_texturesFiles]() {
+        std::vector<TextureReference> texturesReferences(texturesFiles.size());
+
+        ObjUtils::ParallelUtils::parallelFor(
+            texturesFiles.size(), 8, [&](const size_t first, const size_t last, size_t) {
+                for (size_t textureIdx = first; textureIdx < last; ++textureIdx)
+                {
+                    // Mtl files written on Windows use backslashes.
+                    std::string textureFile = texturesFiles[textureIdx];
+                    std::replace(textureFile.begin(), textureFile.end(), '\\', '/');
+
+                    // Absolute paths often point to the exporting machine: fall back to the
+                    // texture next to the Mtl file.
+                    std::error_code errorCode;
+                    fs::path texturePath = mtlDirectory / textureFile;
+                    if (fs::is_regular_file(texturePath, errorCode) == false)
+                    {
+                        texturePath = mtlDirectory / fs::path(textureFile).filename();
+                    }
+
+                    TextureReference& reference = texturesReferences[textureIdx];
+                    reference.m_exists = fs::is_regular_file(texturePath, errorCode);
+                    reference.m_canonicalPath = fs::weakly_canonical(texturePath, errorCode);
+                    if (reference.m_exists == true)
+                    {
+                        reference.m_fileSize = fs::file_size(texturePath, errorCode);
+                    }
+                }
+            });
+
+        return texturesReferences;
+    };
+
+    m_texturesReferences = std::async(std::launch::async, std::move(resolve)).share();
+}
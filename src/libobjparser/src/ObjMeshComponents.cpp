@@ -0,0 +1,394 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ObjMeshComponents.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "ObjMeshComponents.h"
+
+#include "ObjDatabase.h"
+#include "ParallelUtils.h"
+#include "Utils.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <unordered_map>
+
+namespace
+{
+/// Minimum count of faces processed by one worker.
+constexpr size_t minChunkSize = 1 << 14;
+
+/// \brief  Lock-free union-find over the geometric vertices. Roots are always the smallest index
+///         of their set, so concurrent unions converge to the same forest.
+class ConcurrentUnionFind
+{
+public:
+    explicit ConcurrentUnionFind(const size_t count) : m_parents(new std::atomic<uint32_t>[count])
+    {
+        for (size_t idx = 0; idx < count; ++idx)
+        {
+            m_parents[idx].store(static_cast<uint32_t>(idx), std::memory_order_relaxed);
+        }
+    }
+
+    /// \brief  Return the root of an element's set, halving the path on the way.
+    uint32_t find(uint32_t idx)
+    {
+        while (true)
+        {
+            uint32_t parentIdx = m_parents[idx].load(std::memory_order_relaxed);
+            if (parentIdx == idx)
+            {
+                return idx;
+            }
+
+            const uint32_t grandParentIdx = m_parents[parentIdx].load(std::memory_order_relaxed);
+            if (parentIdx != grandParentIdx)
+            {
+                m_parents[idx].compare_exchange_weak(parentIdx,
+                                                     grandParentIdx,
+                                                     std::memory_order_relaxed);
+            }
+
+            idx = grandParentIdx;
+        }
+    }
+
+    /// \brief  Merge the sets of two elements.
+    void unite(uint32_t idx, uint32_t otherIdx)
+    {
+        while (true)
+        {
+            idx = find(idx);
+            otherIdx = find(otherIdx);
+
+            if (idx == otherIdx)
+            {
+                return;
+            }
+
+            // Link the greatest root under the smallest one.
+            if (idx < otherIdx)
+            {
+                std::swap(idx, otherIdx);
+            }
+
+            uint32_t expectedRoot = idx;
+            if (m_parents[idx].compare_exchange_strong(expectedRoot,
+                                                       otherIdx,
+                                                       std::memory_order_relaxed) == true)
+            {
+                return;
+            }
+        }
+    }
+
+private:
+    std::unique_ptr<std::atomic<uint32_t>[]> m_parents;  ///< Parent of each element.
+};
+
+}  // namespace
+
+// =================================================================================================
+
+ObjMeshComponents::ObjMeshComponents(const ObjDatabase& objDB)
+{
+    const size_t facesCount = objDB.getFacesCount();
+    const size_t verticesCount = objDB.getVerticesCount();
+    const auto facesBegin = objDB.cbegin<ElementType::FACE>();
+
+    OBJASSERT(verticesCount < INVALID_COMPONENT, "Too many vertices for 32-bit indices");
+
+    // Geometric vertices indices are 1-based, anything outside [1, verticesCount] is invalid.
+    auto getFirstCorner = [&objDB, verticesCount](const ObjEntityFace& face) {
+        const auto [idxItr, idxEnd] = objDB.getVerticesIterators(face);
+        for (auto cornerItr = idxItr; cornerItr < idxEnd; cornerItr += face.getIndicesStride())
+        {
+            if ((*cornerItr < 1) || (*cornerItr > verticesCount))
+            {
+                return INVALID_COMPONENT;
+            }
+        }
+
+        return (idxItr < idxEnd) ? static_cast<uint32_t>(*idxItr - 1) : INVALID_COMPONENT;
+    };
+
+    // Unite the vertices of each face.
+    ConcurrentUnionFind vertexSets(verticesCount);
+    ObjUtils::ParallelUtils::parallelFor(
+        facesCount, minChunkSize, [&](const size_t faceBegin, const size_t faceEnd, size_t) {
+            for (size_t faceIdx = faceBegin; faceIdx < faceEnd; ++faceIdx)
+            {
+                const ObjEntityFace& face = facesBegin[faceIdx];
+                if (const uint32_t firstCorner = getFirstCorner(face);
+                    firstCorner != INVALID_COMPONENT)
+                {
+                    const auto [idxItr, idxEnd] = objDB.getVerticesIterators(face);
+                    for (auto cornerItr = idxItr + face.getIndicesStride(); cornerItr < idxEnd;
+                         cornerItr += face.getIndicesStride())
+                    {
+                        vertexSets.unite(firstCorner, static_cast<uint32_t>(*cornerItr - 1));
+                    }
+                }
+            }
+        });
+
+    // Resolve each face's root in parallel, then number the roots in faces order.
+    m_faceComponent.resize(facesCount);
+    ObjUtils::ParallelUtils::parallelFor(
+        facesCount, minChunkSize, [&](const size_t faceBegin, const size_t faceEnd, size_t) {
+            for (size_t faceIdx = faceBegin; faceIdx < faceEnd; ++faceIdx)
+            {
+                const uint32_t firstCorner = getFirstCorner(facesBegin[faceIdx]);
+                m_faceComponent[faceIdx] = (firstCorner != INVALID_COMPONENT) ?
+                                               vertexSets.find(firstCorner) :
+                                               INVALID_COMPONENT;
+            }
+        });
+
+    std::vector<uint32_t> rootComponent(verticesCount, INVALID_COMPONENT);
+    for (uint32_t& faceComponent : m_faceComponent)
+    {
+        if (faceComponent != INVALID_COMPONENT)
+        {
+            uint32_t& component = rootComponent[faceComponent];
+            if (component == INVALID_COMPONENT)
+            {
+                component = static_cast<uint32_t>(m_componentFacesCount.size());
+                m_componentFacesCount.push_back(0);
+            }
+
+            faceComponent = component;
+            ++m_componentFacesCount[component];
+        }
+    }
+}
+
+// =================================================================================================
+
+std::vector<size_t> ObjMeshComponents::createComponentsGroups(ObjDatabase& objDB,
+                                                              std::string_view namePrefix) const
+{
+    OBJASSERT(objDB.getFacesCount() == m_faceComponent.size(), "Components of another database");
+
+    std::vector<ObjEntityGroup> groups;
+    groups.reserve(getComponentsCount());
+
+    // Faces of one component adjacent in the entities table extend the same entities range, any
+    // other entity between two faces starts a new range.
+    std::vector<size_t> lastEntities(getComponentsCount(), 0);
+
+    size_t faceIdx = 0;
+    std::for_each(objDB.cbegin<ElementType::FACE>(),
+                  objDB.cend<ElementType::FACE>(),
+                  [&](const ObjEntityFace& face) {
+                      // A face's ID is its index in the entities table + 1.
+                      const size_t entityTableIdx = face.getID() - 1;
+
+                      if (const uint32_t component = m_faceComponent[faceIdx];
+                          component != INVALID_COMPONENT)
+                      {
+                          // Components are numbered in their first face's order.
+                          if (component == groups.size())
+                          {
+                              std::string grpName(namePrefix);
+                              grpName += std::to_string(component);
+
+                              groups.emplace_back(ElementType::GROUP_NAME,
+                                                  entityTableIdx,
+                                                  grpName);
+                          }
+                          else if (lastEntities[component] + 1 != entityTableIdx)
+                          {
+                              groups[component].startIncludedEntityRange(entityTableIdx);
+                          }
+
+                          groups[component].endIncludedEntityRange(entityTableIdx);
+                          lastEntities[component] = entityTableIdx;
+                      }
+
+                      ++faceIdx;
+                  });
+
+    std::vector<size_t> groupsIDs;
+    groupsIDs.reserve(groups.size());
+
+    for (ObjEntityGroup& grp : groups)
+    {
+        groupsIDs.push_back(objDB.insertEntity(std::move(grp)));
+    }
+
+    return groupsIDs;
+}
+
+// =================================================================================================
+
+std::vector<ObjDatabase> ObjMeshComponents::splitComponents(const ObjDatabase& objDB) const
+{
+    OBJASSERT(objDB.getFacesCount() == m_faceComponent.size(), "Components of another database");
+
+    // Structured bindings can't be captured by the workers' lambda.
+    const std::pair<std::vector<uint32_t>, std::vector<size_t>> facesByComponent =
+        getFacesByComponent();
+    const std::vector<uint32_t>& sortedFaces = facesByComponent.first;
+    const std::vector<size_t>& componentsOffsets = facesByComponent.second;
+    const auto facesBegin = objDB.cbegin<ElementType::FACE>();
+
+    // A geometric vertex belongs to only one component, so one shared remapping table is enough.
+    std::vector<size_t> positionsRemap(objDB.getVerticesCount(), 0);
+
+    std::vector<ObjDatabase> componentsDBs(getComponentsCount());
+
+    ObjUtils::ParallelUtils::parallelFor(
+        getComponentsCount(), 1, [&](const size_t compBegin, const size_t compEnd, size_t) {
+            for (size_t compIdx = compBegin; compIdx < compEnd; ++compIdx)
+            {
+                ObjDatabase& compDB = componentsDBs[compIdx];
+
+                const size_t defaultGrpID = compDB.insertEntity(
+                    ObjEntityGroup{ElementType::GROUP_NAME, 0, "default"});
+
+                // Same libraries and materials table, so the faces keep their material ID.
+                for (size_t libIdx = 0; libIdx < objDB.getMaterialLibraries().size(); ++libIdx)
+                {
+                    compDB.insertMaterialLibrary(objDB.getMaterialLibrariesRefs()[libIdx],
+                                                 objDB.getMaterialLibraries()[libIdx]);
+                }
+                for (size_t materialID = 0; materialID < objDB.getMaterialsCount(); ++materialID)
+                {
+                    compDB.insertMaterialName(
+                        objDB.getMaterialName(static_cast<MaterialID_t>(materialID)));
+                }
+                compDB.resolveMaterials();
+
+                // Texture vertices and normals may be shared between components.
+                std::unordered_map<size_t, size_t> texturesRemap;
+                std::unordered_map<size_t, size_t> normalsRemap;
+
+                // Return the new 1-based index of a vertex, inserting the vertex at first use.
+                auto remapVertex = [&compDB, &objDB](const ElementType type,
+                                                     const size_t vtxIdx,
+                                                     size_t& newVtxIdx) {
+                    if ((newVtxIdx == 0) && (vtxIdx >= 1) &&
+                        (vtxIdx <= objDB.getVerticesCount(type)))
+                    {
+                        const ObjEntityVertex vtx = *objDB.getVertex(type, vtxIdx - 1);
+                        compDB.insertEntity(ObjEntityVertex(vtx));
+                        newVtxIdx = compDB.getVerticesCount(type);
+                    }
+
+                    return newVtxIdx;
+                };
+
+                // Insert the vertices first, then the faces, like an Obj file would list them.
+                for (const bool insertFaces : {false, true})
+                {
+                    for (size_t sortedIdx = componentsOffsets[compIdx];
+                         sortedIdx < componentsOffsets[compIdx + 1];
+                         ++sortedIdx)
+                    {
+                        const ObjEntityFace& face = facesBegin[sortedFaces[sortedIdx]];
+                        const VerticesIdxOrganization vtxIdxOrg =
+                            face.getVerticesIndicesOrganization();
+                        const size_t stride = face.getIndicesStride();
+                        const auto [idxItr, idxEnd] = objDB.getVerticesIterators(face);
+
+                        const size_t firstIdx = compDB.getIndexBufferCount();
+
+                        for (auto partItr = idxItr; partItr < idxEnd; ++partItr)
+                        {
+                            const size_t partIdx = std::distance(idxItr, partItr) % stride;
+
+                            size_t newIdx = 0;
+                            if (partIdx == 0)
+                            {
+                                newIdx = remapVertex(ElementType::VERTEX,
+                                                     *partItr,
+                                                     positionsRemap[*partItr - 1]);
+                            }
+                            else if ((partIdx == 1) &&
+                                     ((vtxIdxOrg == VerticesIdxOrganization::VGEO_VTEXTURE) ||
+                                      (vtxIdxOrg ==
+                                       VerticesIdxOrganization::VGEO_VTEXTURE_VNORMAL)))
+                            {
+                                newIdx = remapVertex(ElementType::VERTEX_TEXTURE,
+                                                     *partItr,
+                                                     texturesRemap[*partItr]);
+                            }
+                            else
+                            {
+                                newIdx = remapVertex(ElementType::VERTEX_NORMAL,
+                                                     *partItr,
+                                                     normalsRemap[*partItr]);
+                            }
+
+                            if (insertFaces == true)
+                            {
+                                compDB.insertIndex(newIdx);
+                            }
+                        }
+
+                        if (insertFaces == true)
+                        {
+                            compDB.insertEntity(ObjEntityFace(firstIdx,
+                                                              compDB.getIndexBufferCount() - 1,
+                                                              vtxIdxOrg,
+                                                              face.getMaterialID()));
+                        }
+                    }
+                }
+
+                ObjEntityGroup& defaultGrp = *compDB.getGroup(defaultGrpID);
+                defaultGrp.endIncludedEntityRange(compDB.getEntitiesCount() - 1);
+            }
+        });
+
+    return componentsDBs;
+}
+
+// =================================================================================================
+
+std::pair<std::vector<uint32_t>, std::vector<size_t>> ObjMeshComponents::getFacesByComponent() const
+{
+    // Counting sort of the faces by component.
+    std::vector<size_t> componentsOffsets(getComponentsCount() + 1, 0);
+    std::partial_sum(m_componentFacesCount.cbegin(),
+                     m_componentFacesCount.cend(),
+                     componentsOffsets.begin() + 1);
+
+    std::vector<uint32_t> sortedFaces(componentsOffsets.back());
+    std::vector<size_t> nextSlots(componentsOffsets.cbegin(), componentsOffsets.cend() - 1);
+
+    for (uint32_t faceIdx = 0; faceIdx < m_faceComponent.size(); ++faceIdx)
+    {
+        if (const uint32_t component = m_faceComponent[faceIdx]; component != INVALID_COMPONENT)
+        {
+            sortedFaces[nextSlots[component]++] = faceIdx;
+        }
+    }
+
+    return std::make_pair(std::move(sortedFaces), std::move(componentsOffsets));
+}
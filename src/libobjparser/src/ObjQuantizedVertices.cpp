@@ -0,0 +1,354 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ObjQuantizedVertices.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "ObjQuantizedVertices.h"
+
+#include "ObjDatabase.h"
+#include "ParallelUtils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+/// Minimum count of vertices processed by one worker.
+constexpr size_t minChunkSize = 1 << 15;
+
+constexpr float unorm16Max = 65535.0f;
+constexpr float snorm16Max = 32767.0f;
+
+/// \brief  Quantize a value of [0, 1] to a 16-bit unsigned value.
+uint16_t toUnorm16(const float value)
+{
+    return static_cast<uint16_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * unorm16Max));
+}
+
+/// \brief  Quantize a value of [-1, 1] to a 16-bit signed value.
+int16_t toSnorm16(const float value)
+{
+    return static_cast<int16_t>(std::lround(std::clamp(value, -1.0f, 1.0f) * snorm16Max));
+}
+
+/// \brief  Return the quantization scale of a range: its extent / 65535, 0 for empty ranges.
+float getScale(const float minValue, const float maxValue)
+{
+    return (maxValue > minValue) ? ((maxValue - minValue) / unorm16Max) : 0.0f;
+}
+
+/// \brief  Decode one octahedral-encoded normal.
+void decodeOctahedral(const float x, const float y, float* pXYZ)
+{
+    float nx = x;
+    float ny = y;
+    const float nz = 1.0f - std::fabs(nx) - std::fabs(ny);
+
+    // Unfold the lower hemisphere.
+    const float t = std::max(-nz, 0.0f);
+    nx += (nx >= 0.0f) ? -t : t;
+    ny += (ny >= 0.0f) ? -t : t;
+
+    const float invLength = 1.0f / std::sqrt(nx * nx + ny * ny + nz * nz);
+    pXYZ[0] = nx * invLength;
+    pXYZ[1] = ny * invLength;
+    pXYZ[2] = nz * invLength;
+}
+
+}  // namespace
+
+// =================================================================================================
+
+ObjQuantizedVertices::ObjQuantizedVertices(const ObjDatabase& objDB)
+{
+    constexpr float floatMax = std::numeric_limits<float>::max();
+
+    const auto positionsBegin = objDB.cbegin<ElementType::VERTEX>();
+    const auto texCoordsBegin = objDB.cbegin<ElementType::VERTEX_TEXTURE>();
+    const auto normalsBegin = objDB.cbegin<ElementType::VERTEX_NORMAL>();
+
+    const size_t positionsCount = objDB.getVerticesCount(ElementType::VERTEX);
+    const size_t texCoordsCount = objDB.getVerticesCount(ElementType::VERTEX_TEXTURE);
+    const size_t normalsCount = objDB.getVerticesCount(ElementType::VERTEX_NORMAL);
+
+    // Bounding box of the geometric vertices and bounds of the texture vertices.
+    std::array<float, 3> positionsMin = {floatMax, floatMax, floatMax};
+    std::array<float, 3> positionsMax = {-floatMax, -floatMax, -floatMax};
+    std::for_each(positionsBegin, objDB.cend<ElementType::VERTEX>(), [&](const Vertex_t& vtx) {
+        const auto [x, y, z, w] = vtx;
+        positionsMin = {std::min(positionsMin[0], x),
+                        std::min(positionsMin[1], y),
+                        std::min(positionsMin[2], z)};
+        positionsMax = {std::max(positionsMax[0], x),
+                        std::max(positionsMax[1], y),
+                        std::max(positionsMax[2], z)};
+    });
+
+    std::array<float, 2> texCoordsMin = {floatMax, floatMax};
+    std::array<float, 2> texCoordsMax = {-floatMax, -floatMax};
+    std::for_each(texCoordsBegin,
+                  objDB.cend<ElementType::VERTEX_TEXTURE>(),
+                  [&](const Vertex_t& vtx) {
+                      texCoordsMin = {std::min(texCoordsMin[0], vtx.m_x),
+                                      std::min(texCoordsMin[1], vtx.m_y)};
+                      texCoordsMax = {std::max(texCoordsMax[0], vtx.m_x),
+                                      std::max(texCoordsMax[1], vtx.m_y)};
+                  });
+
+    for (size_t axis = 0; (positionsCount > 0) && (axis < 3); ++axis)
+    {
+        m_positionsOffset[axis] = positionsMin[axis];
+        m_positionsScale[axis] = getScale(positionsMin[axis], positionsMax[axis]);
+    }
+
+    for (size_t axis = 0; (texCoordsCount > 0) && (axis < 2); ++axis)
+    {
+        m_texCoordsOffset[axis] = texCoordsMin[axis];
+        m_texCoordsScale[axis] = getScale(texCoordsMin[axis], texCoordsMax[axis]);
+    }
+
+    // Encode the attributes.
+    m_positions.resize(positionsCount * 3);
+    ObjUtils::ParallelUtils::parallelFor(
+        positionsCount, minChunkSize, [&](const size_t vtxBegin, const size_t vtxEnd, size_t) {
+            for (size_t vtxIdx = vtxBegin; vtxIdx < vtxEnd; ++vtxIdx)
+            {
+                const auto [x, y, z, w] = positionsBegin[vtxIdx];
+                const std::array<float, 3> xyz = {x, y, z};
+
+                for (size_t axis = 0; axis < 3; ++axis)
+                {
+                    const float scale = m_positionsScale[axis];
+                    m_positions[vtxIdx * 3 + axis] =
+                        (scale > 0.0f) ? toUnorm16((xyz[axis] - m_positionsOffset[axis]) /
+                                                   (scale * unorm16Max)) :
+                                         0;
+                }
+            }
+        });
+
+    m_texCoords.resize(texCoordsCount * 2);
+    ObjUtils::ParallelUtils::parallelFor(
+        texCoordsCount, minChunkSize, [&](const size_t vtxBegin, const size_t vtxEnd, size_t) {
+            for (size_t vtxIdx = vtxBegin; vtxIdx < vtxEnd; ++vtxIdx)
+            {
+                const Vertex_t& vtx = texCoordsBegin[vtxIdx];
+                const std::array<float, 2> uv = {vtx.m_x, vtx.m_y};
+
+                for (size_t axis = 0; axis < 2; ++axis)
+                {
+                    const float scale = m_texCoordsScale[axis];
+                    m_texCoords[vtxIdx * 2 + axis] =
+                        (scale > 0.0f) ? toUnorm16((uv[axis] - m_texCoordsOffset[axis]) /
+                                                   (scale * unorm16Max)) :
+                                         0;
+                }
+            }
+        });
+
+    m_normals.resize(normalsCount * 2);
+    ObjUtils::ParallelUtils::parallelFor(
+        normalsCount, minChunkSize, [&](const size_t vtxBegin, const size_t vtxEnd, size_t) {
+            for (size_t vtxIdx = vtxBegin; vtxIdx < vtxEnd; ++vtxIdx)
+            {
+                const auto [x, y, z, w] = normalsBegin[vtxIdx];
+
+                // Project on the octahedron, then fold the lower hemisphere over the upper one.
+                const float l1Norm = std::fabs(x) + std::fabs(y) + std::fabs(z);
+                float octX = (l1Norm > 0.0f) ? (x / l1Norm) : 0.0f;
+                float octY = (l1Norm > 0.0f) ? (y / l1Norm) : 0.0f;
+
+                if (z < 0.0f)
+                {
+                    const float signX = (octX >= 0.0f) ? 1.0f : -1.0f;
+                    const float signY = (octY >= 0.0f) ? 1.0f : -1.0f;
+                    const float foldedX = (1.0f - std::fabs(octY)) * signX;
+                    const float foldedY = (1.0f - std::fabs(octX)) * signY;
+                    octX = foldedX;
+                    octY = foldedY;
+                }
+
+                m_normals[vtxIdx * 2] = toSnorm16(octX);
+                m_normals[vtxIdx * 2 + 1] = toSnorm16(octY);
+            }
+        });
+}
+
+// =================================================================================================
+
+void ObjQuantizedVertices::decodePositions(const size_t first,
+                                           const size_t count,
+                                           float* pXYZ) const
+{
+    const uint16_t* pEncoded = m_positions.data() + first * 3;
+    size_t vtxIdx = 0;
+
+#if defined(__SSE2__)
+    const __m128 scale = _mm_setr_ps(m_positionsScale[0],
+                                     m_positionsScale[1],
+                                     m_positionsScale[2],
+                                     0.0f);
+    const __m128 offset = _mm_setr_ps(m_positionsOffset[0],
+                                      m_positionsOffset[1],
+                                      m_positionsOffset[2],
+                                      0.0f);
+    const __m128i zero = _mm_setzero_si128();
+
+    // Each load reads the next vertex's first value and each store writes one float past the
+    // vertex, overwritten by the next vertex, so the last vertex is left to the scalar loop.
+    for (; (vtxIdx + 1) < count; ++vtxIdx)
+    {
+        const __m128i encoded = _mm_loadl_epi64(
+            reinterpret_cast<const __m128i*>(pEncoded + vtxIdx * 3));
+        const __m128 values = _mm_cvtepi32_ps(_mm_unpacklo_epi16(encoded, zero));
+
+        _mm_storeu_ps(pXYZ + vtxIdx * 3, _mm_add_ps(_mm_mul_ps(values, scale), offset));
+    }
+#endif
+
+    for (; vtxIdx < count; ++vtxIdx)
+    {
+        for (size_t axis = 0; axis < 3; ++axis)
+        {
+            pXYZ[vtxIdx * 3 + axis] = pEncoded[vtxIdx * 3 + axis] * m_positionsScale[axis] +
+                                      m_positionsOffset[axis];
+        }
+    }
+}
+
+// =================================================================================================
+
+void ObjQuantizedVertices::decodeTexCoords(const size_t first,
+                                           const size_t count,
+                                           float* pUV) const
+{
+    const uint16_t* pEncoded = m_texCoords.data() + first * 2;
+    size_t vtxIdx = 0;
+
+#if defined(__SSE2__)
+    const __m128 scale = _mm_setr_ps(m_texCoordsScale[0],
+                                     m_texCoordsScale[1],
+                                     m_texCoordsScale[0],
+                                     m_texCoordsScale[1]);
+    const __m128 offset = _mm_setr_ps(m_texCoordsOffset[0],
+                                      m_texCoordsOffset[1],
+                                      m_texCoordsOffset[0],
+                                      m_texCoordsOffset[1]);
+    const __m128i zero = _mm_setzero_si128();
+
+    // 2 texture vertices per iteration.
+    for (; (vtxIdx + 2) <= count; vtxIdx += 2)
+    {
+        const __m128i encoded = _mm_loadl_epi64(
+            reinterpret_cast<const __m128i*>(pEncoded + vtxIdx * 2));
+        const __m128 values = _mm_cvtepi32_ps(_mm_unpacklo_epi16(encoded, zero));
+
+        _mm_storeu_ps(pUV + vtxIdx * 2, _mm_add_ps(_mm_mul_ps(values, scale), offset));
+    }
+#endif
+
+    for (; vtxIdx < count; ++vtxIdx)
+    {
+        for (size_t axis = 0; axis < 2; ++axis)
+        {
+            pUV[vtxIdx * 2 + axis] = pEncoded[vtxIdx * 2 + axis] * m_texCoordsScale[axis] +
+                                     m_texCoordsOffset[axis];
+        }
+    }
+}
+
+// =================================================================================================
+
+void ObjQuantizedVertices::decodeNormals(const size_t first,
+                                         const size_t count,
+                                         float* pXYZ) const
+{
+    const int16_t* pEncoded = m_normals.data() + first * 2;
+    size_t vtxIdx = 0;
+
+#if defined(__SSE2__)
+    const __m128 invSnormMax = _mm_set1_ps(1.0f / snorm16Max);
+    const __m128 minusOne = _mm_set1_ps(-1.0f);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+
+    // 4 normals per iteration, decoded in SoA form.
+    for (; (vtxIdx + 4) <= count; vtxIdx += 4)
+    {
+        const __m128i encoded = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(pEncoded + vtxIdx * 2));
+
+        // Sign-extend the 16-bit values to 32-bit.
+        const __m128 lo = _mm_cvtepi32_ps(
+            _mm_srai_epi32(_mm_unpacklo_epi16(encoded, encoded), 16));
+        const __m128 hi = _mm_cvtepi32_ps(
+            _mm_srai_epi32(_mm_unpackhi_epi16(encoded, encoded), 16));
+
+        __m128 x = _mm_max_ps(_mm_mul_ps(_mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0)),
+                                         invSnormMax),
+                              minusOne);
+        __m128 y = _mm_max_ps(_mm_mul_ps(_mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1)),
+                                         invSnormMax),
+                              minusOne);
+        const __m128 z = _mm_sub_ps(_mm_sub_ps(one, _mm_andnot_ps(signMask, x)),
+                                    _mm_andnot_ps(signMask, y));
+
+        // Unfold the lower hemisphere: x -= copysign(t, x).
+        const __m128 t = _mm_max_ps(_mm_sub_ps(_mm_setzero_ps(), z), _mm_setzero_ps());
+        x = _mm_sub_ps(x, _mm_or_ps(t, _mm_and_ps(x, signMask)));
+        y = _mm_sub_ps(y, _mm_or_ps(t, _mm_and_ps(y, signMask)));
+
+        const __m128 invLength = _mm_div_ps(
+            one,
+            _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)),
+                                   _mm_mul_ps(z, z))));
+
+        alignas(16) float xs[4];
+        alignas(16) float ys[4];
+        alignas(16) float zs[4];
+        _mm_store_ps(xs, _mm_mul_ps(x, invLength));
+        _mm_store_ps(ys, _mm_mul_ps(y, invLength));
+        _mm_store_ps(zs, _mm_mul_ps(z, invLength));
+
+        for (size_t lane = 0; lane < 4; ++lane)
+        {
+            float* pNormal = pXYZ + (vtxIdx + lane) * 3;
+            pNormal[0] = xs[lane];
+            pNormal[1] = ys[lane];
+            pNormal[2] = zs[lane];
+        }
+    }
+#endif
+
+    for (; vtxIdx < count; ++vtxIdx)
+    {
+        decodeOctahedral(std::max(pEncoded[vtxIdx * 2] / snorm16Max, -1.0f),
+                         std::max(pEncoded[vtxIdx * 2 + 1] / snorm16Max, -1.0f),
+                         pXYZ + vtxIdx * 3);
+    }
+}
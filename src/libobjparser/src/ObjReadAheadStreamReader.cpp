@@ -0,0 +1,373 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ObjReadAheadStreamReader.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "ObjReadAheadStreamReader.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <vector>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define OBJ_HAS_IO_URING
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+#ifdef OBJ_HAS_IO_URING
+/// \brief io_uring instance reading the blocks of a file. Only the parser's thread uses it.
+struct ObjReadAheadStreamReader::IoUring
+{
+    /// \brief Block of the file, read in flight or waiting to be parsed.
+    struct Block
+    {
+        std::vector<char> m_data;   ///< Bytes of the block, its size is the capacity.
+        iovec m_iovec = {};         ///< Part of the block read by the read in flight.
+        off_t m_offset = 0;         ///< Offset of the block in the file.
+        size_t m_size = 0;          ///< Count of bytes of the file in the block.
+        size_t m_readSize = 0;      ///< Count of read bytes.
+        bool m_isInFlight = false;  ///< Is a read of the block in flight?
+    };
+
+    /// \brief  Destructor. Waits for the reads in flight before releasing their blocks.
+    ~IoUring()
+    {
+        for (Block& block : m_blocks)
+        {
+            while ((block.m_isInFlight == true) && (reapCompletion() == true))
+            {
+            }
+        }
+
+        if (m_pSqes != MAP_FAILED)
+        {
+            munmap(m_pSqes, m_sqesSize);
+        }
+        if ((m_pCqRing != MAP_FAILED) && (m_pCqRing != m_pSqRing))
+        {
+            munmap(m_pCqRing, m_cqRingSize);
+        }
+        if (m_pSqRing != MAP_FAILED)
+        {
+            munmap(m_pSqRing, m_sqRingSize);
+        }
+        if (m_ringFd >= 0)
+        {
+            close(m_ringFd);
+        }
+        if (m_fileFd >= 0)
+        {
+            close(m_fileFd);
+        }
+    }
+
+    /// \brief  Open a file, set up the rings and submit the reads of the first blocks.
+    ///
+    /// \return true on success, false if the file or io_uring are unavailable.
+    bool setUp(const std::filesystem::path& filePath, const size_t blockSize,
+               const size_t blocksCount)
+    {
+        m_fileFd = open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+        struct stat fileStat;
+        if ((m_fileFd < 0) || (fstat(m_fileFd, &fileStat) != 0))
+        {
+            return false;
+        }
+        m_endOffset = fileStat.st_size;
+
+        io_uring_params params;
+        std::memset(&params, 0, sizeof(params));
+        m_ringFd = static_cast<int>(syscall(__NR_io_uring_setup, blocksCount, &params));
+        if (m_ringFd < 0)
+        {
+            return false;
+        }
+
+        // Map the submission and completion rings, a single mapping on kernels 5.4 and later.
+        m_sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        m_cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0)
+        {
+            m_sqRingSize = m_cqRingSize = std::max(m_sqRingSize, m_cqRingSize);
+        }
+
+        m_pSqRing = mmap(nullptr, m_sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                         m_ringFd, IORING_OFF_SQ_RING);
+        m_pCqRing = ((params.features & IORING_FEAT_SINGLE_MMAP) != 0)
+                        ? m_pSqRing
+                        : mmap(nullptr, m_cqRingSize, PROT_READ | PROT_WRITE,
+                               MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_CQ_RING);
+        m_sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        m_pSqes = mmap(nullptr, m_sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                       m_ringFd, IORING_OFF_SQES);
+        if ((m_pSqRing == MAP_FAILED) || (m_pCqRing == MAP_FAILED) || (m_pSqes == MAP_FAILED))
+        {
+            return false;
+        }
+
+        char* const pSqRing = static_cast<char*>(m_pSqRing);
+        m_pSqTail = reinterpret_cast<unsigned*>(pSqRing + params.sq_off.tail);
+        m_pSqMask = reinterpret_cast<unsigned*>(pSqRing + params.sq_off.ring_mask);
+        m_pSqArray = reinterpret_cast<unsigned*>(pSqRing + params.sq_off.array);
+
+        char* const pCqRing = static_cast<char*>(m_pCqRing);
+        m_pCqHead = reinterpret_cast<unsigned*>(pCqRing + params.cq_off.head);
+        m_pCqTail = reinterpret_cast<unsigned*>(pCqRing + params.cq_off.tail);
+        m_pCqMask = reinterpret_cast<unsigned*>(pCqRing + params.cq_off.ring_mask);
+        m_pCqes = reinterpret_cast<io_uring_cqe*>(pCqRing + params.cq_off.cqes);
+
+        m_blocks.resize(blocksCount);
+        for (size_t blockIdx = 0; blockIdx < m_blocks.size(); ++blockIdx)
+        {
+            m_blocks[blockIdx].m_data.resize(blockSize);
+            startBlock(blockIdx);
+        }
+
+        return true;
+    }
+
+    /// \brief  Give a free block the next part of the file and submit its read.
+    void startBlock(const size_t blockIdx)
+    {
+        Block& block = m_blocks[blockIdx];
+        block.m_offset = std::min(m_nextOffset, m_endOffset);
+        block.m_size = std::min<size_t>(block.m_data.size(), m_endOffset - block.m_offset);
+        block.m_readSize = 0;
+        m_nextOffset = block.m_offset + block.m_size;
+
+        if (block.m_size > 0)
+        {
+            submitRead(blockIdx);
+        }
+    }
+
+    /// \brief  Submit the read of the part of a block left to read.
+    void submitRead(const size_t blockIdx)
+    {
+        Block& block = m_blocks[blockIdx];
+        block.m_iovec.iov_base = block.m_data.data() + block.m_readSize;
+        block.m_iovec.iov_len = block.m_size - block.m_readSize;
+
+        // At most one read per block is in flight, the submission ring is never full.
+        const unsigned sqTail = *m_pSqTail;
+        const unsigned sqeIdx = sqTail & *m_pSqMask;
+        io_uring_sqe& sqe = static_cast<io_uring_sqe*>(m_pSqes)[sqeIdx];
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = IORING_OP_READV;
+        sqe.fd = m_fileFd;
+        sqe.addr = reinterpret_cast<uintptr_t>(&block.m_iovec);
+        sqe.len = 1;
+        sqe.off = block.m_offset + block.m_readSize;
+        sqe.user_data = blockIdx;
+        m_pSqArray[sqeIdx] = sqeIdx;
+        __atomic_store_n(m_pSqTail, sqTail + 1, __ATOMIC_RELEASE);
+
+        block.m_isInFlight = true;
+        if (syscall(__NR_io_uring_enter, m_ringFd, 1, 0, 0, nullptr, 0) < 0)
+        {
+            // The block cannot be read: the file ends before it.
+            block.m_isInFlight = false;
+            m_hasFailed = true;
+            endFile(block);
+        }
+    }
+
+    /// \brief  Wait for one completed read and handle it.
+    ///
+    /// \return false if io_uring failed.
+    bool reapCompletion()
+    {
+        const unsigned cqHead = *m_pCqHead;
+        while (__atomic_load_n(m_pCqTail, __ATOMIC_ACQUIRE) == cqHead)
+        {
+            if ((syscall(__NR_io_uring_enter, m_ringFd, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0) <
+                 0) &&
+                (errno != EINTR))
+            {
+                m_hasFailed = true;
+                return false;
+            }
+        }
+
+        const io_uring_cqe cqe = m_pCqes[cqHead & *m_pCqMask];
+        __atomic_store_n(m_pCqHead, cqHead + 1, __ATOMIC_RELEASE);
+
+        const size_t blockIdx = static_cast<size_t>(cqe.user_data);
+        Block& block = m_blocks[blockIdx];
+        block.m_isInFlight = false;
+
+        if ((cqe.res == -EINTR) || (cqe.res == -EAGAIN))
+        {
+            submitRead(blockIdx);
+        }
+        else if (cqe.res <= 0)
+        {
+            // Read error, or the file shrank: it ends with this block.
+            m_hasFailed = (cqe.res < 0);
+            endFile(block);
+        }
+        else
+        {
+            // Short reads (network file systems) go on where they stopped.
+            block.m_readSize += cqe.res;
+            if (block.m_readSize < block.m_size)
+            {
+                submitRead(blockIdx);
+            }
+        }
+
+        return true;
+    }
+
+    /// \brief  End the file after the bytes read in a block.
+    void endFile(Block& block)
+    {
+        block.m_size = block.m_readSize;
+        m_endOffset = std::min<off_t>(m_endOffset, block.m_offset + block.m_readSize);
+    }
+
+    // Members =====================================================================================
+
+    int m_fileFd = -1;            ///< Read file.
+    int m_ringFd = -1;            ///< io_uring instance.
+    off_t m_endOffset = 0;        ///< End of the file.
+    off_t m_nextOffset = 0;       ///< Offset of the next block to read.
+    std::vector<Block> m_blocks;  ///< Blocks, read in turn.
+    size_t m_readBlockIdx = 0;    ///< Block read by the parser.
+    size_t m_readPos = 0;         ///< Position of the parser in its block.
+    bool m_hasFailed = false;     ///< Did a read fail?
+
+    void* m_pSqRing = MAP_FAILED;  ///< Mapping of the submission ring.
+    size_t m_sqRingSize = 0;       ///< Size of the submission ring's mapping.
+    void* m_pCqRing = MAP_FAILED;  ///< Mapping of the completion ring.
+    size_t m_cqRingSize = 0;       ///< Size of the completion ring's mapping.
+    void* m_pSqes = MAP_FAILED;    ///< Mapping of the submission entries.
+    size_t m_sqesSize = 0;         ///< Size of the submission entries' mapping.
+
+    unsigned* m_pSqTail = nullptr;    ///< Tail of the submission ring.
+    unsigned* m_pSqMask = nullptr;    ///< Mask of the submission ring's indices.
+    unsigned* m_pSqArray = nullptr;   ///< Entries indices of the submission ring.
+    unsigned* m_pCqHead = nullptr;    ///< Head of the completion ring.
+    unsigned* m_pCqTail = nullptr;    ///< Tail of the completion ring.
+    unsigned* m_pCqMask = nullptr;    ///< Mask of the completion ring's indices.
+    io_uring_cqe* m_pCqes = nullptr;  ///< Completion entries.
+};
+#else
+/// \brief io_uring is Linux only, the read thread is used elsewhere.
+struct ObjReadAheadStreamReader::IoUring
+{
+};
+#endif
+
+// =================================================================================================
+
+ObjReadAheadStreamReader::ObjReadAheadStreamReader(const std::filesystem::path& filePath,
+                                                   const size_t blockSize,
+                                                   const size_t blocksCount,
+                                                   const Backend backend)
+{
+    const size_t ringBlocksCount = std::max<size_t>(blocksCount, 2);
+    const size_t ringBlockSize = std::max<size_t>(blockSize, 1);
+
+#ifdef OBJ_HAS_IO_URING
+    if (backend == Backend::IO_URING)
+    {
+        m_pIoUring = std::make_unique<IoUring>();
+        if (m_pIoUring->setUp(filePath, ringBlockSize, ringBlocksCount) == false)
+        {
+            m_pIoUring.reset();
+        }
+    }
+#endif
+
+    if (m_pIoUring == nullptr)
+    {
+        m_pReadThread = std::make_unique<ObjCompressedStreamReader>(filePath,
+                                                                    ringBlockSize,
+                                                                    ringBlocksCount);
+    }
+}
+
+// =================================================================================================
+
+ObjReadAheadStreamReader::~ObjReadAheadStreamReader() = default;
+
+// =================================================================================================
+
+size_t ObjReadAheadStreamReader::read(char* pBuffer, const size_t size)
+{
+#ifdef OBJ_HAS_IO_URING
+    if (m_pIoUring != nullptr)
+    {
+        IoUring& ioUring = *m_pIoUring;
+        IoUring::Block& block = ioUring.m_blocks[ioUring.m_readBlockIdx];
+        while ((block.m_isInFlight == true) && (ioUring.reapCompletion() == true))
+        {
+        }
+
+        // Blocks after the end of the file are empty, and so are the unfinished ones.
+        if ((block.m_isInFlight == true) || (block.m_offset >= ioUring.m_endOffset) ||
+            (ioUring.m_readPos == block.m_readSize))
+        {
+            return 0;
+        }
+
+        const size_t readSize = std::min(size, block.m_readSize - ioUring.m_readPos);
+        std::memcpy(pBuffer, block.m_data.data() + ioUring.m_readPos, readSize);
+        ioUring.m_readPos += readSize;
+
+        // The parsed block goes back in flight with the next part of the file.
+        if (ioUring.m_readPos == block.m_readSize)
+        {
+            ioUring.m_readPos = 0;
+            ioUring.startBlock(ioUring.m_readBlockIdx);
+            ioUring.m_readBlockIdx = (ioUring.m_readBlockIdx + 1) % ioUring.m_blocks.size();
+        }
+
+        return readSize;
+    }
+#endif
+
+    return m_pReadThread->read(pBuffer, size);
+}
+
+// =================================================================================================
+
+bool ObjReadAheadStreamReader::hasFailed() const
+{
+#ifdef OBJ_HAS_IO_URING
+    if (m_pIoUring != nullptr)
+    {
+        return m_pIoUring->m_hasFailed;
+    }
+#endif
+
+    return m_pReadThread->hasFailed();
+}
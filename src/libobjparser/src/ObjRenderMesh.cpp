@@ -0,0 +1,294 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ObjRenderMesh.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "ObjRenderMesh.h"
+
+#include "ObjDatabase.h"
+#include "Utils.h"
+
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+
+namespace
+{
+/// Sub-mesh of the faces included in no named group.
+constexpr std::string_view defaultSubMeshName = "default";
+
+/// \brief  Vertex triplet referenced by a face's corner. 1-based indices, 0 if not referenced.
+struct CornerKey
+{
+    size_t m_vtxIdx = 0;      ///< Geometric vertex index.
+    size_t m_textureIdx = 0;  ///< Texture vertex index.
+    size_t m_normalIdx = 0;   ///< Vertex normal index.
+
+    bool operator==(const CornerKey& other) const
+    {
+        return (m_vtxIdx == other.m_vtxIdx) && (m_textureIdx == other.m_textureIdx) &&
+               (m_normalIdx == other.m_normalIdx);
+    }
+};
+
+/// \brief  Hash function of the corners' triplets.
+struct CornerKeyHash
+{
+    size_t operator()(const CornerKey& key) const
+    {
+        constexpr size_t goldenRatio = 0x9e3779b97f4a7c15;
+
+        size_t hash = std::hash<size_t>{}(key.m_vtxIdx);
+        hash ^= std::hash<size_t>{}(key.m_textureIdx) + goldenRatio + (hash << 6) + (hash >> 2);
+        hash ^= std::hash<size_t>{}(key.m_normalIdx) + goldenRatio + (hash << 6) + (hash >> 2);
+        return hash;
+    }
+};
+
+/// \brief  Return the positions of the texture and normal indices in a vertex triplet, or the
+///         triplet's stride if not referenced.
+std::pair<size_t, size_t> getTripletLayout(const VerticesIdxOrganization vtxIdxOrg)
+{
+    switch (vtxIdxOrg)
+    {
+    case VerticesIdxOrganization::VGEO_VTEXTURE: return std::make_pair(1, 2);
+    case VerticesIdxOrganization::VGEO_VNORMAL: return std::make_pair(2, 1);
+    case VerticesIdxOrganization::VGEO_VTEXTURE_VNORMAL: return std::make_pair(1, 2);
+
+    case VerticesIdxOrganization::VGEO:
+    default: return std::make_pair(1, 1);
+    }
+}
+
+}  // namespace
+
+// =================================================================================================
+
+ObjRenderMesh::ObjRenderMesh(const ObjDatabase& objDB)
+{
+    const auto facesBegin = objDB.cbegin<ElementType::FACE>();
+
+    // One sub-mesh per (material, group) batch of faces.
+    const ObjDatabase::FacesBatches facesBatches = objDB.getFacesBatches(true);
+
+    // Only keep the attributes referenced by at least one face.
+    bool hasTexCoords = false;
+    bool hasNormals = false;
+    std::for_each(facesBegin, objDB.cend<ElementType::FACE>(), [&](const ObjEntityFace& face) {
+        const auto [textureIdx, normalIdx] =
+            getTripletLayout(face.getVerticesIndicesOrganization());
+        hasTexCoords |= (textureIdx < face.getIndicesStride());
+        hasNormals |= (normalIdx < face.getIndicesStride());
+    });
+
+    const size_t verticesCount = objDB.getVerticesCount(ElementType::VERTEX);
+    const size_t texturesCount = objDB.getVerticesCount(ElementType::VERTEX_TEXTURE);
+    const size_t normalsCount = objDB.getVerticesCount(ElementType::VERTEX_NORMAL);
+
+    // The encoded attributes of a quantized database are welded as well, to be uploaded as is.
+    const ObjQuantizedVertices* pQuantized = objDB.getQuantizedVertices();
+    if (pQuantized != nullptr)
+    {
+        QuantizedAttributes& attributes = m_quantizedAttributes.emplace();
+        attributes.m_positionsScale = pQuantized->getPositionsScale();
+        attributes.m_positionsOffset = pQuantized->getPositionsOffset();
+        attributes.m_texCoordsScale = pQuantized->getTexCoordsScale();
+        attributes.m_texCoordsOffset = pQuantized->getTexCoordsOffset();
+    }
+
+    auto appendQuantizedAttributes = [&](const CornerKey& key) {
+        QuantizedAttributes& attributes = *m_quantizedAttributes;
+
+        const auto positionItr = pQuantized->getEncodedPositions().cbegin() +
+                                 (key.m_vtxIdx - 1) * 3;
+        attributes.m_positions.insert(attributes.m_positions.end(), positionItr, positionItr + 3);
+
+        // Attributes not referenced by the corner are encoded zeros.
+        if (hasTexCoords == true)
+        {
+            std::array<uint16_t, 2> texture = {0, 0};
+            if (key.m_textureIdx > 0)
+            {
+                const auto textureItr = pQuantized->getEncodedTexCoords().cbegin() +
+                                        (key.m_textureIdx - 1) * 2;
+                std::copy(textureItr, textureItr + 2, texture.begin());
+            }
+            attributes.m_texCoords.insert(attributes.m_texCoords.end(),
+                                          texture.cbegin(),
+                                          texture.cend());
+        }
+
+        if (hasNormals == true)
+        {
+            std::array<int16_t, 2> normal = {0, 0};
+            if (key.m_normalIdx > 0)
+            {
+                const auto normalItr = pQuantized->getEncodedNormals().cbegin() +
+                                       (key.m_normalIdx - 1) * 2;
+                std::copy(normalItr, normalItr + 2, normal.begin());
+            }
+            attributes.m_normals.insert(attributes.m_normals.end(), normal.cbegin(), normal.cend());
+        }
+    };
+
+    // Weld the corners sharing the same triplet into one render vertex.
+    std::unordered_map<CornerKey, uint32_t, CornerKeyHash> renderVertices;
+    renderVertices.reserve(verticesCount);
+
+    auto getRenderVertex = [&](const CornerKey& key) {
+        auto [vtxItr, inserted] = renderVertices.try_emplace(key, getVerticesCount());
+        if (inserted == true)
+        {
+            if (pQuantized != nullptr)
+            {
+                appendQuantizedAttributes(key);
+            }
+
+            const Vertex_t vtx = *objDB.getVertex(ElementType::VERTEX, key.m_vtxIdx - 1);
+            m_positions.insert(m_positions.end(), {vtx.m_x, vtx.m_y, vtx.m_z});
+
+            // Attributes not referenced by the corner default to zeros.
+            if (hasTexCoords == true)
+            {
+                std::array<float, 2> texture = {0.0f, 0.0f};
+                if (key.m_textureIdx > 0)
+                {
+                    const Vertex_t vtxTexture =
+                        *objDB.getVertex(ElementType::VERTEX_TEXTURE, key.m_textureIdx - 1);
+                    texture = {vtxTexture.m_x, vtxTexture.m_y};
+                }
+                m_texCoords.insert(m_texCoords.end(), texture.cbegin(), texture.cend());
+            }
+
+            if (hasNormals == true)
+            {
+                std::array<float, 3> normal = {0.0f, 0.0f, 0.0f};
+                if (key.m_normalIdx > 0)
+                {
+                    const Vertex_t vtxNormal =
+                        *objDB.getVertex(ElementType::VERTEX_NORMAL, key.m_normalIdx - 1);
+                    normal = {vtxNormal.m_x, vtxNormal.m_y, vtxNormal.m_z};
+                }
+                m_normals.insert(m_normals.end(), normal.cbegin(), normal.cend());
+            }
+        }
+
+        return vtxItr->second;
+    };
+
+    std::vector<uint32_t> faceCorners;
+    for (const ObjDatabase::FacesBatch& batch : facesBatches.m_batches)
+    {
+        SubMesh& subMesh = m_subMeshes.emplace_back();
+        subMesh.m_name = (batch.m_groupName.empty() == false) ? batch.m_groupName
+                                                              : defaultSubMeshName;
+        subMesh.m_materialID = batch.m_materialID;
+        subMesh.m_firstIndex = m_indices.size();
+
+        for (size_t sortedIdx = batch.m_firstFace;
+             sortedIdx < batch.m_firstFace + batch.m_facesCount;
+             ++sortedIdx)
+        {
+            const ObjEntityFace& face = facesBegin[facesBatches.m_sortedFaces[sortedIdx]];
+            const size_t stride = face.getIndicesStride();
+            const auto [textureIdx, normalIdx] = getTripletLayout(
+                face.getVerticesIndicesOrganization());
+            const auto [idxItr, idxEnd] = objDB.getVerticesIterators(face);
+
+            // Skip the faces referencing unknown geometric vertices.
+            faceCorners.clear();
+            for (auto tripletItr = idxItr; tripletItr < idxEnd; tripletItr += stride)
+            {
+                CornerKey key;
+                key.m_vtxIdx = tripletItr[0];
+                if ((key.m_vtxIdx < 1) || (key.m_vtxIdx > verticesCount))
+                {
+                    faceCorners.clear();
+                    break;
+                }
+
+                if ((textureIdx < stride) && (tripletItr[textureIdx] <= texturesCount))
+                {
+                    key.m_textureIdx = tripletItr[textureIdx];
+                }
+                if ((normalIdx < stride) && (tripletItr[normalIdx] <= normalsCount))
+                {
+                    key.m_normalIdx = tripletItr[normalIdx];
+                }
+
+                faceCorners.push_back(getRenderVertex(key));
+            }
+
+            // Triangulate as a fan around the first corner.
+            for (size_t cornerIdx = 2; cornerIdx < faceCorners.size(); ++cornerIdx)
+            {
+                m_indices.insert(
+                    m_indices.end(),
+                    {faceCorners[0], faceCorners[cornerIdx - 1], faceCorners[cornerIdx]});
+            }
+        }
+
+        subMesh.m_indicesCount = m_indices.size() - subMesh.m_firstIndex;
+    }
+
+    OBJASSERT(getVerticesCount() < std::numeric_limits<uint32_t>::max(), "Too many vertices");
+
+    // Drop the groups left without triangles.
+    m_subMeshes.erase(std::remove_if(m_subMeshes.begin(),
+                                     m_subMeshes.end(),
+                                     [](const SubMesh& subMesh) {
+                                         return (subMesh.m_indicesCount == 0);
+                                     }),
+                      m_subMeshes.end());
+
+    // The sub-meshes of a material are consecutive.
+    for (size_t subMeshIdx = 0; subMeshIdx < m_subMeshes.size(); ++subMeshIdx)
+    {
+        const SubMesh& subMesh = m_subMeshes[subMeshIdx];
+        if ((m_materialsRanges.empty() == true) ||
+            (m_materialsRanges.back().m_materialID != subMesh.m_materialID))
+        {
+            m_materialsRanges.push_back(MaterialRange{subMesh.m_materialID,
+                                                      std::string(objDB.getMaterialName(
+                                                          subMesh.m_materialID)),
+                                                      subMesh.m_firstIndex,
+                                                      0,
+                                                      subMeshIdx,
+                                                      0});
+        }
+
+        m_materialsRanges.back().m_indicesCount += subMesh.m_indicesCount;
+        ++m_materialsRanges.back().m_subMeshesCount;
+    }
+
+    // Bounding box of the positions.
+    for (size_t vtxIdx = 0; vtxIdx < getVerticesCount(); ++vtxIdx)
+    {
+        for (size_t axis = 0; axis < 3; ++axis)
+        {
+            const float value = m_positions[vtxIdx * 3 + axis];
+            m_boundsMin[axis] = (vtxIdx == 0) ? value : std::min(m_boundsMin[axis], value);
+            m_boundsMax[axis] = (vtxIdx == 0) ? value : std::max(m_boundsMax[axis], value);
+        }
+    }
+}
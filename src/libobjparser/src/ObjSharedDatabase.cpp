@@ -0,0 +1,427 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ObjSharedDatabase.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "ObjSharedDatabase.h"
+
+#include "ObjDatabase.h"
+#include "Utils.h"
+
+#include <algorithm>
+#include <atomic>
+#include <new>
+
+#if __has_include(<sys/mman.h>)
+#define OBJ_HAS_SHM
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+constexpr uint64_t SEGMENT_MAGIC = 0x3142445348534A4F;  ///< "OJSHSDB1".
+constexpr uint32_t SEGMENT_VERSION = 1;
+constexpr size_t SECTION_ALIGNMENT = 64;  ///< Sections start on their own cache line.
+
+/// \brief Sections of the segment, in the segment's order.
+enum SectionID : uint8_t
+{
+    VERTICES_SECTION = 0,  ///< v, vt, vn and vp: 4 sections.
+    INDICES_SECTION = 4,
+    FACES_SECTION,
+    GROUPS_SECTION,
+    ENTITIES_RANGES_SECTION,
+    ENTITIES_SECTION,
+    MATERIALS_NAMES_SECTION,
+    MATERIAL_LIBRARIES_REFS_SECTION,
+    CHARS_SECTION,
+    SECTIONS_COUNT
+};
+
+/// \brief Records of one type, located by their offset from the start of the segment.
+struct Section
+{
+    uint64_t m_offset;      ///< Offset of the first record.
+    uint64_t m_count;       ///< Count of records.
+    uint64_t m_recordSize;  ///< Size of one record, checks the layouts of the processes.
+};
+
+/// \brief Header, at the start of the segment.
+struct SegmentHeader
+{
+    uint64_t m_magic;                                ///< SEGMENT_MAGIC once complete.
+    uint32_t m_version;                              ///< SEGMENT_VERSION.
+    uint32_t m_headerSize;                           ///< Size of the header.
+    uint64_t m_segmentSize;                          ///< Size of the segment.
+    std::array<Section, SECTIONS_COUNT> m_sections;  ///< Sections, in SectionID order.
+};
+
+/// \brief Size of the records of each section.
+constexpr std::array<size_t, SECTIONS_COUNT> RECORDS_SIZES = {
+    sizeof(ObjSharedDatabase::Vertex),         sizeof(ObjSharedDatabase::Vertex),
+    sizeof(ObjSharedDatabase::Vertex),         sizeof(ObjSharedDatabase::Vertex),
+    sizeof(uint64_t),                          sizeof(ObjSharedDatabase::Face),
+    sizeof(ObjSharedDatabase::Group),          sizeof(ObjSharedDatabase::EntitiesRange),
+    sizeof(ObjSharedDatabase::EntityLocation), sizeof(ObjSharedDatabase::String),
+    sizeof(ObjSharedDatabase::String),         sizeof(char)};
+
+/// \brief  Return the name of a segment as given to shm_open.
+std::string getSegmentPath(const std::string& segmentName)
+{
+    return ((segmentName.empty() == false) && (segmentName.front() == '/')) ? segmentName
+                                                                            : '/' + segmentName;
+}
+
+/// \brief  Return the first record of a section.
+template<typename T>
+T* getRecords(std::byte* const pSegment, const Section& section)
+{
+    return reinterpret_cast<T*>(pSegment + section.m_offset);
+}
+
+/// \brief  Copy the vertices of one type to their section.
+template<const ElementType type>
+void writeVertices(const ObjDatabase& objDB, ObjSharedDatabase::Vertex* pVertex)
+{
+    objDB.forEachVertex(type, [&pVertex](const ObjEntityVertex& vtx) {
+        const auto [x, y, z, w] = vtx;
+        new (pVertex++) ObjSharedDatabase::Vertex{x, y, z, w};
+    });
+}
+
+}  // namespace
+
+// =================================================================================================
+
+bool ObjSharedDatabase::publish(const ObjDatabase& objDB, const std::string& segmentName)
+{
+#ifdef OBJ_HAS_SHM
+    SegmentHeader header = {};
+    header.m_version = SEGMENT_VERSION;
+    header.m_headerSize = sizeof(SegmentHeader);
+
+    size_t rangesCount = 0;
+    size_t charsCount = 0;
+    std::for_each(objDB.cbegin<ElementType::GROUP_NAME>(),
+                  objDB.cend<ElementType::GROUP_NAME>(),
+                  [&rangesCount, &charsCount](const ObjEntityGroup& group) {
+                      rangesCount += group.getIncludedEntityRangesCount();
+                      if (const auto name = group.getGroupName(); name.has_value() == true)
+                      {
+                          charsCount += name->get().size();
+                      }
+                  });
+    for (size_t materialID = 0; materialID < objDB.getMaterialsCount(); ++materialID)
+    {
+        charsCount += objDB.getMaterialName(static_cast<MaterialID_t>(materialID)).size();
+    }
+    for (const std::string& libraryRef : objDB.getMaterialLibrariesRefs())
+    {
+        charsCount += libraryRef.size();
+    }
+
+    const std::array<size_t, SECTIONS_COUNT> counts = {
+        objDB.getVerticesCount(ElementType::VERTEX),
+        objDB.getVerticesCount(ElementType::VERTEX_TEXTURE),
+        objDB.getVerticesCount(ElementType::VERTEX_NORMAL),
+        objDB.getVerticesCount(ElementType::VERTEX_PARAM_SPACE),
+        objDB.getIndexBufferCount(),
+        objDB.getFacesCount(),
+        objDB.getGroupsCount(),
+        rangesCount,
+        objDB.getEntitiesCount(),
+        objDB.getMaterialsCount(),
+        objDB.getMaterialLibrariesRefs().size(),
+        charsCount};
+
+    size_t segmentSize = sizeof(SegmentHeader);
+    for (size_t sectionIdx = 0; sectionIdx < SECTIONS_COUNT; ++sectionIdx)
+    {
+        segmentSize =
+            ((segmentSize + SECTION_ALIGNMENT - 1) / SECTION_ALIGNMENT) * SECTION_ALIGNMENT;
+        header.m_sections[sectionIdx] = {
+            segmentSize, counts[sectionIdx], RECORDS_SIZES[sectionIdx]};
+        segmentSize += counts[sectionIdx] * RECORDS_SIZES[sectionIdx];
+    }
+    header.m_segmentSize = segmentSize;
+
+    // The attached processes keep the replaced segment.
+    const std::string segmentPath = getSegmentPath(segmentName);
+    shm_unlink(segmentPath.c_str());
+
+    const int fd = shm_open(segmentPath.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd == -1)
+    {
+        OBJLOG("Unable to create the shared memory segment : ", segmentPath);
+        return false;
+    }
+
+    void* pMapping = MAP_FAILED;
+    if (ftruncate(fd, static_cast<off_t>(segmentSize)) == 0)
+    {
+        pMapping = mmap(nullptr, segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+
+    close(fd);
+
+    if (pMapping == MAP_FAILED)
+    {
+        OBJLOG("Unable to map the shared memory segment : ", segmentPath);
+        shm_unlink(segmentPath.c_str());
+        return false;
+    }
+
+    std::byte* const pSegment = static_cast<std::byte*>(pMapping);
+    const auto& sections = header.m_sections;
+
+    writeVertices<ElementType::VERTEX>(objDB, getRecords<Vertex>(pSegment, sections[0]));
+    writeVertices<ElementType::VERTEX_TEXTURE>(objDB, getRecords<Vertex>(pSegment, sections[1]));
+    writeVertices<ElementType::VERTEX_NORMAL>(objDB, getRecords<Vertex>(pSegment, sections[2]));
+    writeVertices<ElementType::VERTEX_PARAM_SPACE>(objDB,
+                                                   getRecords<Vertex>(pSegment, sections[3]));
+
+    std::copy(objDB.getIndexBuffer().cbegin(),
+              objDB.getIndexBuffer().cend(),
+              getRecords<uint64_t>(pSegment, sections[INDICES_SECTION]));
+
+    Face* pFace = getRecords<Face>(pSegment, sections[FACES_SECTION]);
+    std::for_each(objDB.cbegin<ElementType::FACE>(),
+                  objDB.cend<ElementType::FACE>(),
+                  [&pFace](const ObjEntityFace& face) {
+                      new (pFace++) Face{face.getFirstVertexIndex(),
+                                         face.getLastVertexIndex(),
+                                         face.getMaterialID(),
+                                         face.getVerticesIndicesOrganization(),
+                                         face.isTriangle()};
+                  });
+
+    char* const pChars = getRecords<char>(pSegment, sections[CHARS_SECTION]);
+    uint64_t charsOffset = 0;
+    const auto writeString = [pChars, &charsOffset](std::string_view str) {
+        std::copy(str.cbegin(), str.cend(), pChars + charsOffset);
+        charsOffset += str.size();
+
+        return String{charsOffset - str.size(), str.size()};
+    };
+
+    Group* pGroup = getRecords<Group>(pSegment, sections[GROUPS_SECTION]);
+    EntitiesRange* const pRanges =
+        getRecords<EntitiesRange>(pSegment, sections[ENTITIES_RANGES_SECTION]);
+    uint64_t rangeIdx = 0;
+    std::for_each(objDB.cbegin<ElementType::GROUP_NAME>(),
+                  objDB.cend<ElementType::GROUP_NAME>(),
+                  [&pGroup, pRanges, &rangeIdx, &writeString](const ObjEntityGroup& group) {
+                      const auto name = group.getGroupName();
+                      const String groupName = writeString(
+                          name.has_value() ? std::string_view(name->get()) : std::string_view());
+                      new (pGroup++) Group{group.getID(),
+                                           group.getGroupNumber().value_or(0),
+                                           groupName,
+                                           rangeIdx,
+                                           group.getIncludedEntityRangesCount(),
+                                           group.getResolution().value_or(0),
+                                           group.getType()};
+
+                      for (const auto& [first, last] : group.getEntitiesIndicesRange())
+                      {
+                          new (pRanges + rangeIdx++) EntitiesRange{first, last};
+                      }
+                  });
+
+    EntityLocation* pLocation = getRecords<EntityLocation>(pSegment, sections[ENTITIES_SECTION]);
+    for (const auto& [entityType, bufferIdx] : objDB.getEntitiesTable())
+    {
+        new (pLocation++) EntityLocation{bufferIdx, entityType};
+    }
+
+    String* pString = getRecords<String>(pSegment, sections[MATERIALS_NAMES_SECTION]);
+    for (size_t materialID = 0; materialID < objDB.getMaterialsCount(); ++materialID)
+    {
+        new (pString++) String{
+            writeString(objDB.getMaterialName(static_cast<MaterialID_t>(materialID)))};
+    }
+
+    pString = getRecords<String>(pSegment, sections[MATERIAL_LIBRARIES_REFS_SECTION]);
+    for (const std::string& libraryRef : objDB.getMaterialLibrariesRefs())
+    {
+        new (pString++) String{writeString(libraryRef)};
+    }
+
+    // The segment is complete once its magic is visible.
+    SegmentHeader* const pHeader = new (pSegment) SegmentHeader(header);
+    std::atomic_thread_fence(std::memory_order_release);
+    pHeader->m_magic = SEGMENT_MAGIC;
+
+    munmap(pMapping, segmentSize);
+
+    return true;
+#else
+    (void)objDB;
+    (void)segmentName;
+
+    return false;
+#endif
+}
+
+// =================================================================================================
+
+std::optional<ObjSharedDatabase> ObjSharedDatabase::attach(const std::string& segmentName)
+{
+#ifdef OBJ_HAS_SHM
+    const int fd = shm_open(getSegmentPath(segmentName).c_str(), O_RDONLY, 0);
+    if (fd == -1)
+    {
+        return std::nullopt;
+    }
+
+    struct stat segmentStat = {};
+    const bool isSizeValid = (fstat(fd, &segmentStat) == 0) &&
+                             (static_cast<size_t>(segmentStat.st_size) >= sizeof(SegmentHeader));
+    const size_t segmentSize = isSizeValid ? static_cast<size_t>(segmentStat.st_size) : 0;
+
+    void* const pMapping =
+        isSizeValid ? mmap(nullptr, segmentSize, PROT_READ, MAP_SHARED, fd, 0) : MAP_FAILED;
+
+    close(fd);
+
+    if (pMapping == MAP_FAILED)
+    {
+        return std::nullopt;
+    }
+
+    std::shared_ptr<const std::byte> spSegment(
+        static_cast<const std::byte*>(pMapping), [segmentSize](const std::byte* pSegment) {
+            munmap(const_cast<std::byte*>(pSegment), segmentSize);
+        });
+
+    const SegmentHeader& header = *reinterpret_cast<const SegmentHeader*>(spSegment.get());
+    if ((header.m_magic != SEGMENT_MAGIC) || (header.m_version != SEGMENT_VERSION) ||
+        (header.m_headerSize != sizeof(SegmentHeader)) || (header.m_segmentSize != segmentSize))
+    {
+        return std::nullopt;
+    }
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    for (size_t sectionIdx = 0; sectionIdx < SECTIONS_COUNT; ++sectionIdx)
+    {
+        const Section& section = header.m_sections[sectionIdx];
+        if ((section.m_recordSize != RECORDS_SIZES[sectionIdx]) ||
+            ((section.m_offset % SECTION_ALIGNMENT) != 0) || (section.m_offset > segmentSize) ||
+            (section.m_count > ((segmentSize - section.m_offset) / section.m_recordSize)))
+        {
+            OBJLOG("Invalid shared memory segment : ", segmentName);
+            return std::nullopt;
+        }
+    }
+
+    return ObjSharedDatabase(std::move(spSegment), segmentSize);
+#else
+    (void)segmentName;
+
+    return std::nullopt;
+#endif
+}
+
+// =================================================================================================
+
+bool ObjSharedDatabase::unpublish(const std::string& segmentName)
+{
+#ifdef OBJ_HAS_SHM
+    return (shm_unlink(getSegmentPath(segmentName).c_str()) == 0);
+#else
+    (void)segmentName;
+
+    return false;
+#endif
+}
+
+// =================================================================================================
+
+ObjSharedDatabase::ObjSharedDatabase(std::shared_ptr<const std::byte> spSegment,
+                                     const size_t segmentSize)
+    : m_spSegment(std::move(spSegment)), m_segmentSize(segmentSize)
+{
+    const auto& sections = reinterpret_cast<const SegmentHeader*>(m_spSegment.get())->m_sections;
+    const auto setArray = [this, &sections](auto& records, const size_t sectionIdx) {
+        records.m_pData = reinterpret_cast<decltype(records.m_pData)>(
+            m_spSegment.get() + sections[sectionIdx].m_offset);
+        records.m_count = sections[sectionIdx].m_count;
+    };
+
+    for (uint8_t vBufferIdx = 0; vBufferIdx < m_vertices.size(); ++vBufferIdx)
+    {
+        setArray(m_vertices[vBufferIdx], VERTICES_SECTION + vBufferIdx);
+    }
+    setArray(m_indices, INDICES_SECTION);
+    setArray(m_faces, FACES_SECTION);
+    setArray(m_groups, GROUPS_SECTION);
+    setArray(m_entitiesRanges, ENTITIES_RANGES_SECTION);
+    setArray(m_entities, ENTITIES_SECTION);
+    setArray(m_materialsNames, MATERIALS_NAMES_SECTION);
+    setArray(m_materialLibrariesRefs, MATERIAL_LIBRARIES_REFS_SECTION);
+    setArray(m_chars, CHARS_SECTION);
+}
+
+// =================================================================================================
+
+std::optional<std::reference_wrapper<const ObjSharedDatabase::Vertex>>
+ObjSharedDatabase::getVertex(const ElementType type, const size_t idx) const
+{
+    const size_t vBufferIdx = static_cast<size_t>(type) - static_cast<size_t>(ElementType::VERTEX);
+    if ((vBufferIdx < m_vertices.size()) && (idx < m_vertices[vBufferIdx].m_count))
+    {
+        return m_vertices[vBufferIdx][idx];
+    }
+
+    return std::nullopt;
+}
+
+// =================================================================================================
+
+size_t ObjSharedDatabase::getVerticesCount(const ElementType type) const
+{
+    switch (type)
+    {
+    case ElementType::VERTEX_TEXTURE: return m_vertices[1].m_count;
+    case ElementType::VERTEX_NORMAL: return m_vertices[2].m_count;
+    case ElementType::VERTEX_PARAM_SPACE: return m_vertices[3].m_count;
+
+    default: return m_vertices[0].m_count;
+    }
+}
+
+// =================================================================================================
+
+std::string_view ObjSharedDatabase::getString(const String& str) const
+{
+    if ((str.m_offset > m_chars.m_count) || (str.m_size > (m_chars.m_count - str.m_offset)))
+    {
+        return {};
+    }
+
+    return std::string_view(m_chars.m_pData + str.m_offset, str.m_size);
+}
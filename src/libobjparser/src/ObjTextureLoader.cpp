@@ -0,0 +1,151 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ObjTextureLoader.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "ObjTextureLoader.h"
+
+#include "Utils.h"
+
+#include <cstdio>
+
+ObjTextureLoader::~ObjTextureLoader()
+{
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        m_isStopping = true;
+    }
+    m_wakeUp.notify_all();
+
+    for (std::thread& worker : m_workers)
+    {
+        worker.join();
+    }
+
+    for (LoadRequest& request : m_requests)
+    {
+        request.m_promise.set_value(nullptr);
+    }
+}
+
+// =================================================================================================
+
+std::shared_future<ObjTextureLoader::TextureData_t>
+ObjTextureLoader::requestTexture(const ObjMaterialLibrary::TextureReference& texture)
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    const std::string filePath = texture.m_canonicalPath.string();
+    if (const auto textureItr = m_textures.find(filePath); textureItr != m_textures.cend())
+    {
+        return textureItr->second;
+    }
+
+    LoadRequest request{filePath, {}};
+    std::shared_future<TextureData_t> textureData = request.m_promise.get_future().share();
+    m_textures.emplace(filePath, textureData);
+
+    // Missing textures need no loading.
+    if (texture.m_exists == false)
+    {
+        request.m_promise.set_value(nullptr);
+        return textureData;
+    }
+
+    m_requests.push_back(std::move(request));
+
+    // Start one more worker when the idle ones can't take all the pending requests.
+    if ((m_workers.size() < m_maxWorkersCount) &&
+        (m_requests.size() > m_workers.size() - m_busyWorkersCount))
+    {
+        m_workers.emplace_back(&ObjTextureLoader::runWorker, this);
+    }
+    m_wakeUp.notify_one();
+
+    return textureData;
+}
+
+// =================================================================================================
+
+void ObjTextureLoader::runWorker()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (true)
+    {
+        m_wakeUp.wait(lock, [this]() {
+            return (m_isStopping == true) || (m_requests.empty() == false);
+        });
+
+        if (m_isStopping == true)
+        {
+            return;
+        }
+
+        LoadRequest request = std::move(m_requests.front());
+        m_requests.pop_front();
+
+        // Read without holding the lock, new requests can be queued meanwhile.
+        ++m_busyWorkersCount;
+        lock.unlock();
+        request.m_promise.set_value(readTexture(request.m_filePath));
+        lock.lock();
+        --m_busyWorkersCount;
+    }
+}
+
+// =================================================================================================
+
+ObjTextureLoader::TextureData_t ObjTextureLoader::readTexture(const std::string& filePath)
+{
+    const std::unique_ptr<std::FILE, decltype(&fclose)> smtTextureFile(fopen(filePath.c_str(),
+                                                                             "rb"),
+                                                                       &fclose);
+    if (smtTextureFile == nullptr)
+    {
+        OBJLOG("Could not open the texture file : ", filePath);
+        return nullptr;
+    }
+
+    auto pData = std::make_shared<std::vector<uint8_t>>();
+
+    constexpr size_t readSize = 1 << 20;
+    size_t readBytes = 0;
+    do
+    {
+        pData->resize(pData->size() + readSize);
+        readBytes = fread(pData->data() + pData->size() - readSize,
+                          1,
+                          readSize,
+                          smtTextureFile.get());
+        pData->resize(pData->size() - readSize + readBytes);
+    } while (readBytes == readSize);
+
+    if (ferror(smtTextureFile.get()) != 0)
+    {
+        OBJLOG("Could not read the texture file : ", filePath);
+        return nullptr;
+    }
+
+    return pData;
+}
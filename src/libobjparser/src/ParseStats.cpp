@@ -0,0 +1,66 @@
+/// Copyright (c) 2017 - present    Othmane AIT EL CADI <dartzon@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+/// \file      ParseStats.cpp
+///
+/// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
+/// \date      18-10-2026
+
+#include "ParseStats.h"
+
+#include <atomic>
+
+namespace
+{
+thread_local size_t threadAllocationsCount = 0;  ///< Allocations of the thread.
+thread_local size_t threadAllocatedBytes = 0;    ///< Allocated bytes of the thread.
+
+/// True once the program counted an allocation.
+std::atomic<bool> allocationsCounted = false;
+
+}  // namespace
+
+// =================================================================================================
+
+void ParseStats::countAllocation(const size_t size) noexcept
+{
+    ++threadAllocationsCount;
+    threadAllocatedBytes += size;
+
+    // Read first: the flag's cache line stays shared once set.
+    if (allocationsCounted.load(std::memory_order_relaxed) == false)
+    {
+        allocationsCounted.store(true, std::memory_order_relaxed);
+    }
+}
+
+// =================================================================================================
+
+bool ParseStats::isCountingAllocations()
+{
+    return allocationsCounted.load(std::memory_order_relaxed);
+}
+
+// =================================================================================================
+
+std::pair<size_t, size_t> ParseStats::getThreadAllocations()
+{
+    return std::make_pair(threadAllocationsCount, threadAllocatedBytes);
+}
@@ -27,6 +27,8 @@
 #include "Types.h"
 
 #include <algorithm>
+#include <charconv>
+#include <cstdint>
 #include <functional>
 
 namespace ObjUtils
@@ -143,4 +145,33 @@ StringUtils::splitString(std::string_view str, const std::initializer_list<const
     return subStrings;
 }
 
+// =================================================================================================
+
+template<typename NumberT>
+std::optional<NumberT> StringUtils::parseNumber(std::string_view& str)
+{
+    const char* pFirst = std::find_if_not(str.data(), str.data() + str.size(), &isblank);
+    const char* const pLast = str.data() + str.size();
+
+    // std::from_chars doesn't accept the plus sign strtof and strtol skip.
+    if ((pFirst != pLast) && (*pFirst == '+'))
+    {
+        ++pFirst;
+    }
+
+    NumberT number{};
+    const std::from_chars_result result = std::from_chars(pFirst, pLast, number);
+    if (result.ec != std::errc())
+    {
+        return std::nullopt;
+    }
+
+    str.remove_prefix(result.ptr - str.data());
+
+    return number;
+}
+
+template std::optional<float> StringUtils::parseNumber<float>(std::string_view& str);
+template std::optional<int64_t> StringUtils::parseNumber<int64_t>(std::string_view& str);
+
 } /* namespace ObjUtils */
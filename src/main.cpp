@@ -23,31 +23,150 @@
 /// \author    Othmane AIT EL CADI - <dartzon@gmail.com>
 /// \date      04-11-2017
 
-#include "Utils.h"
-#include "Types.h"
-#include "ObjEntityGroup.h"
-#include "ObjEntity.h"
-#include "ObjEntityFace.h"
+#include "ObjBatchLoader.h"
+#include "ObjCacheDaemon.h"
 #include "ObjDatabase.h"
 #include "ObjFileParser.h"
+#include "ObjRenderMesh.h"
+#include "TextBuffer.h"
 
+#include <atomic>
+#include <csignal>
 #include <cstdio>
 
-#include <algorithm>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
 
-#include <cstdio>
+namespace
+{
+/// \brief  Write a buffer as a raw typed array file.
+template<typename T>
+bool writeTypedArray(const std::filesystem::path& filePath, const std::vector<T>& values)
+{
+    const std::unique_ptr<std::FILE, decltype(&fclose)> smtBinFile(fopen(filePath.c_str(), "wb"),
+                                                                   &fclose);
+    if (smtBinFile == nullptr)
+    {
+        return false;
+    }
+
+    return (fwrite(values.data(), sizeof(T), values.size(), smtBinFile.get()) == values.size());
+}
+
+// =================================================================================================
+
+/// \brief  Parse a batch of Obj files and report the throughput.
+///
+/// \param  patterns Files, directories or glob patterns.
+/// \return Exit status.
+int runBatch(const std::vector<std::string>& patterns)
+{
+    const std::vector<std::filesystem::path> objFilesPaths = ObjBatchLoader::expandPaths(patterns);
+    if (objFilesPaths.empty() == true)
+    {
+        fprintf(stderr, "No Obj file found\n");
+        return 1;
+    }
+
+    ObjBatchLoader batchLoader;
+
+    std::atomic<size_t> emptyFilesCount = 0;
+    const ObjBatchLoader::BatchStats stats = batchLoader.loadFiles(
+        objFilesPaths, [&emptyFilesCount](const size_t, ObjDatabase&& objDB) {
+            if (objDB.isEmpty() == true)
+            {
+                ++emptyFilesCount;
+            }
+        });
+
+    printf("%zu files, %.2f MB parsed in %.3f s by %zu workers: %.2f MB/s, %.1f files/s\n",
+           stats.m_filesCount,
+           stats.m_bytesCount / 1.0e6,
+           stats.m_elapsedSeconds,
+           batchLoader.getWorkersCount(),
+           stats.getMegaBytesPerSecond(),
+           stats.getFilesPerSecond());
+
+    if (emptyFilesCount > 0)
+    {
+        fprintf(stderr, "%zu files without entities\n", emptyFilesCount.load());
+    }
+    if (stats.m_failedFilesCount > 0)
+    {
+        fprintf(stderr, "%zu files could not be parsed\n", stats.m_failedFilesCount);
+        return 1;
+    }
+
+    return 0;
+}
+
+// =================================================================================================
+
+ObjCacheDaemon* pRunningDaemon = nullptr;  ///< Daemon stopped by SIGINT and SIGTERM.
+
+/// \brief  Serve parsed Obj files to the local processes until SIGINT or SIGTERM.
+///
+/// \param  socketPath Path to the daemon's socket.
+/// \param  memoryBudgetMB Total size of the cached files in MB.
+/// \return Exit status.
+int runDaemon(const std::filesystem::path& socketPath, const size_t memoryBudgetMB)
+{
+    ObjCacheDaemon cacheDaemon(socketPath, memoryBudgetMB * 1024 * 1024);
+
+    pRunningDaemon = &cacheDaemon;
+    const auto stopDaemon = [](int) { pRunningDaemon->requestStop(); };
+    std::signal(SIGINT, stopDaemon);
+    std::signal(SIGTERM, stopDaemon);
+
+    const bool isServed = cacheDaemon.run();
+
+    std::signal(SIGINT, SIG_DFL);
+    std::signal(SIGTERM, SIG_DFL);
+    pRunningDaemon = nullptr;
+
+    if (isServed == false)
+    {
+        fprintf(stderr, "Could not listen on %s\n", socketPath.c_str());
+        return 1;
+    }
+
+    return 0;
+}
+
+}  // namespace
 
 int main(int argc, char* argv[])
 {
     namespace fs = std::filesystem;
-    fs::path objFilePath(
-        "/home/dartzon/Dev-Workspace/DotObj/tests/models/Aircraft_Carrier/Liaoning.obj");
 
-    if (argc > 1)
+    // objparser --batch <file|directory|glob>...
+    if ((argc > 1) && (std::string_view(argv[1]) == "--batch"))
     {
-        objFilePath = argv[1];
+        return runBatch(std::vector<std::string>(argv + 2, argv + argc));
     }
 
+    // objparser --daemon <socket> [memory budget in MB]
+    if ((argc > 2) && (std::string_view(argv[1]) == "--daemon"))
+    {
+        return runDaemon(argv[2], (argc > 3) ? std::stoul(argv[3]) : 1024);
+    }
+
+    // objparser <obj file> [scale] [output directory]
+    if (argc < 2)
+    {
+        fprintf(stderr,
+                "Usage: %s <obj file> [scale] [output directory]\n"
+                "       %s --batch <file|directory|glob>...\n"
+                "       %s --daemon <socket> [memory budget in MB]\n",
+                argv[0],
+                argv[0],
+                argv[0]);
+        return 1;
+    }
+
+    fs::path objFilePath(argv[1]);
     const std::string fileName = objFilePath;
 
     float scale = 1.0f;
@@ -56,196 +175,123 @@ int main(int argc, char* argv[])
         scale = std::stof(argv[2]);
     }
 
+    const fs::path outDataDir((argc > 3) ? argv[3] : "out3d/data");
+
     ObjFileParser fp(objFilePath);
     const ObjDatabase objDB = fp.parseFile();
     if (objDB.isEmpty() == true)
     {
+        fprintf(stderr, "No Obj entity parsed from %s\n", fileName.c_str());
         return 1;
     }
 
-    const char* pOutJSFile = "out3d/js/renderObjFile.js";
-    const std::unique_ptr<std::FILE, decltype(&fclose)> smtObjFile(fopen(pOutJSFile, "w"), &fclose);
-
-    fprintf(smtObjFile.get(),
-            "// Obj file: %s\n\n"
-            "function renderObjFile()\n{\n"
-            "var material = new THREE.MeshStandardMaterial( { color : 0x00cc00 } );\n"
-            "var color_triangle = new THREE.Color( 0xffaa00 );\n"
-            "var color_quad = new THREE.Color( 0xe21aee );\n"
-            "\nvar materialIndex = 0;\n"
-            "\nvar geometry = new THREE.Geometry();\n"
-            "geometry.vertices = [\n",
-            fileName.c_str());
-
-    // =================================================================================================
-    // Create Vertices buffers.
-    // =================================================================================================
-
-    std::string vertexBuffer;
-    vertexBuffer.reserve(objDB.getVerticesCount() * (30 + 7));
-    std::for_each(cbegin<ElementType::VERTEX>(objDB),
-                  cend<ElementType::VERTEX>(objDB),
-                  [scale, &vertexBuffer](const Vertex_t& vtx) {
-                      vertexBuffer += "\tnew THREE.Vector3(";
-                      vertexBuffer += std::to_string(vtx.m_x * scale);
-                      vertexBuffer += ',';
-                      vertexBuffer += std::to_string(vtx.m_y * scale);
-                      vertexBuffer += ',';
-                      vertexBuffer += std::to_string(vtx.m_z * scale);
-                      vertexBuffer += "),\n";
-                  });
-
-    vertexBuffer[vertexBuffer.size() - 2] = '\n';
-    vertexBuffer.back() = ']';
-    fprintf(smtObjFile.get(), "%s;\n", vertexBuffer.c_str());
-
-    // =================================================================================================
-    // Create Faces.
-    // =================================================================================================
-
-    std::string faceBuffer("geometry.faces = [\n");
-
-    auto cycleVerticesType = [](const VerticesIdxOrganization vtxIdxOrg, ElementType& vtxType) {
-        switch (vtxIdxOrg)
-        {
-        case VerticesIdxOrganization::VGEO_VNORMAL:
-            vtxType = (vtxType == ElementType::VERTEX) ? ElementType::VERTEX_NORMAL :
-                                                         ElementType::VERTEX;
-            break;
-
-        case VerticesIdxOrganization::VGEO_VTEXTURE:
-            vtxType = (vtxType == ElementType::VERTEX) ? ElementType::VERTEX_TEXTURE :
-                                                         ElementType::VERTEX;
-            break;
-
-        case VerticesIdxOrganization::VGEO_VTEXTURE_VNORMAL:
-            if (vtxType == ElementType::VERTEX)
-            {
-                vtxType = ElementType::VERTEX_TEXTURE;
-            }
-            else if (vtxType == ElementType::VERTEX_TEXTURE)
-            {
-                vtxType = ElementType::VERTEX_NORMAL;
-            }
-            else
-            {
-                vtxType = ElementType::VERTEX;
-            }
-            break;
-
-        case VerticesIdxOrganization::VGEO:
-        default: break;
-        }
-
-        return vtxType;
-    };
-
-    std::vector<size_t> vtxBuffer;
-    std::vector<size_t> normalBuffer;
-
-    std::for_each(
-        cbegin<ElementType::FACE>(objDB),
-        cend<ElementType::FACE>(objDB),
-        [&objDB, &faceBuffer, &vtxBuffer, &normalBuffer, &cycleVerticesType](
-            const ObjEntityFace& face) {
-            IndexBufferRangeIterators_t idxBufRefR = objDB.getVerticesIterators(face);
-            ElementType vertexType = ElementType::VERTEX;
+    // =============================================================================================
+    // Write the render buffers as typed arrays for the viewer (out3d/js/setup-scene.js).
+    // =============================================================================================
 
-            std::for_each(idxBufRefR.first,
-                          idxBufRefR.second,
-                          [&face, &vtxBuffer, &normalBuffer, &vertexType, &cycleVerticesType](
-                              const size_t idx) {
-                              switch (vertexType)
-                              {
-                              case ElementType::VERTEX: vtxBuffer.push_back(idx - 1); break;
+    const ObjRenderMesh renderMesh(objDB);
 
-                              case ElementType::VERTEX_TEXTURE: break;
+    std::error_code errCode;
+    fs::create_directories(outDataDir, errCode);
+    if (errCode.value() != 0)
+    {
+        fprintf(stderr,
+                "Could not create the output directory %s: %s\n",
+                outDataDir.c_str(),
+                errCode.message().c_str());
+        return 1;
+    }
 
-                              case ElementType::VERTEX_NORMAL:
-                                  normalBuffer.push_back(idx - 1);
-                                  break;
+    bool written = writeTypedArray(outDataDir / "positions.bin", renderMesh.getPositions()) &&
+                   writeTypedArray(outDataDir / "indices.bin", renderMesh.getIndices());
+    if (renderMesh.hasNormals() == true)
+    {
+        written = written && writeTypedArray(outDataDir / "normals.bin", renderMesh.getNormals());
+    }
+    if (renderMesh.hasTexCoords() == true)
+    {
+        written = written && writeTypedArray(outDataDir / "uvs.bin", renderMesh.getTexCoords());
+    }
 
-                              default: break;
-                              }
+    if (written == false)
+    {
+        fprintf(stderr, "Could not write the render buffers to %s\n", outDataDir.c_str());
+        return 1;
+    }
 
-                              vertexType = cycleVerticesType(face.getVerticesIndicesOrganization(),
-                                                             vertexType);
-                          });
+    // The manifest describes the typed arrays and the groups' ranges of the indices.
+    const std::unique_ptr<std::FILE, decltype(&fclose)> smtManifestFile(
+        fopen((outDataDir / "model.json").c_str(), "w"), &fclose);
+    if (smtManifestFile == nullptr)
+    {
+        return 1;
+    }
 
-            for (size_t vtxIdx = 0; vtxIdx < vtxBuffer.size() - 2; ++vtxIdx)
+    const auto& boundsMin = renderMesh.getBoundsMin();
+    const auto& boundsMax = renderMesh.getBoundsMax();
+
+    ObjUtils::TextBuffer manifest(4 * 1024);
+    manifest.append("{\n  \"source\": ").appendJsonString(fileName);
+    manifest.append(",\n  \"scale\": ").append(scale);
+    manifest.append(",\n  \"verticesCount\": ").append(renderMesh.getVerticesCount());
+    manifest.append(",\n  \"indicesCount\": ").append(renderMesh.getIndices().size());
+    manifest.append(",\n  \"hasNormals\": ").append(renderMesh.hasNormals() ? "true" : "false");
+    manifest.append(",\n  \"hasTexCoords\": ");
+    manifest.append(renderMesh.hasTexCoords() ? "true" : "false");
+    manifest.append(",\n  \"boundsMin\": [").append(boundsMin[0]).append(", ");
+    manifest.append(boundsMin[1]).append(", ").append(boundsMin[2]);
+    manifest.append("],\n  \"boundsMax\": [").append(boundsMax[0]).append(", ");
+    manifest.append(boundsMax[1]).append(", ").append(boundsMax[2]);
+    manifest.append("],\n  \"groups\": [");
+
+    // The groups are the draw commands, sorted by material.
+    const auto& subMeshes = renderMesh.getSubMeshes();
+    const auto& materialsRanges = renderMesh.getMaterialsRanges();
+    for (size_t rangeIdx = 0; rangeIdx < materialsRanges.size(); ++rangeIdx)
+    {
+        const ObjRenderMesh::MaterialRange& range = materialsRanges[rangeIdx];
+        for (size_t subMeshIdx = range.m_firstSubMesh;
+             subMeshIdx < range.m_firstSubMesh + range.m_subMeshesCount;
+             ++subMeshIdx)
+        {
+            manifest.append((subMeshIdx == 0) ? "\n    { \"name\": " : ",\n    { \"name\": ");
+            manifest.appendJsonString(subMeshes[subMeshIdx].m_name);
+            manifest.append(", \"start\": ").append(subMeshes[subMeshIdx].m_firstIndex);
+            manifest.append(", \"count\": ").append(subMeshes[subMeshIdx].m_indicesCount);
+            manifest.append(", \"material\": ").append(rangeIdx).append(" }");
+            if (manifest.getSize() >= 64 * 1024)
             {
-                faceBuffer += "\tnew THREE.Face3(";
-                faceBuffer += std::to_string(vtxBuffer[0]);
-                faceBuffer += ',';
-                faceBuffer += std::to_string(vtxBuffer[vtxIdx + 1]);
-                faceBuffer += ',';
-                faceBuffer += std::to_string(vtxBuffer[vtxIdx + 2]);
-                faceBuffer += ',';
-
-                if (normalBuffer.empty() == true)
-                {
-                    faceBuffer += " null, ";
-                }
-                else
-                {
-                    auto vtxNormal1 = objDB.getVertex(ElementType::VERTEX_NORMAL, normalBuffer[0]);
-                    auto vtxNormal2 = objDB.getVertex(ElementType::VERTEX_NORMAL,
-                                                      normalBuffer[vtxIdx + 1]);
-                    auto vtxNormal3 = objDB.getVertex(ElementType::VERTEX_NORMAL,
-                                                      normalBuffer[vtxIdx + 2]);
-
-                    faceBuffer += "[\n";
-
-                    {
-                        auto [x, y, z, w] = (*vtxNormal1).get();
-                        faceBuffer += " new THREE.Vector3(";
-                        faceBuffer += std::to_string(x);
-                        faceBuffer += ',';
-                        faceBuffer += std::to_string(y);
-                        faceBuffer += ',';
-                        faceBuffer += std::to_string(z);
-                        faceBuffer += ')';
-                        faceBuffer += ',';
-                    }
-
-                    {
-                        auto [x, y, z, w] = (*vtxNormal2).get();
-                        faceBuffer += " new THREE.Vector3(";
-                        faceBuffer += std::to_string(x);
-                        faceBuffer += ',';
-                        faceBuffer += std::to_string(y);
-                        faceBuffer += ',';
-                        faceBuffer += std::to_string(z);
-                        faceBuffer += ')';
-                        faceBuffer += ',';
-                    }
-
-                    {
-                        auto [x, y, z, w] = (*vtxNormal3).get();
-                        faceBuffer += " new THREE.Vector3(";
-                        faceBuffer += std::to_string(x);
-                        faceBuffer += ',';
-                        faceBuffer += std::to_string(y);
-                        faceBuffer += ',';
-                        faceBuffer += std::to_string(z);
-                        faceBuffer += ')';
-                    }
-
-                    faceBuffer += ']';
-                    faceBuffer += ',';
-                }
-
-                faceBuffer += " color_triangle, materialIndex),\n";
+                manifest.flush(smtManifestFile.get());
             }
+        }
+    }
 
-            vtxBuffer.clear();
-            normalBuffer.clear();
-        });
+    // Diffuse color of the materials, null for the faces without material.
+    manifest.append("\n  ],\n  \"materials\": [");
+    for (size_t rangeIdx = 0; rangeIdx < materialsRanges.size(); ++rangeIdx)
+    {
+        const MaterialID_t materialID = materialsRanges[rangeIdx].m_materialID;
 
-    faceBuffer[faceBuffer.size() - 2] = '\n';
-    faceBuffer.back() = ']';
-    fprintf(smtObjFile.get(), "%s;\n/* geometry.computeFaceNormals(); */\n", faceBuffer.c_str());
-    fprintf(smtObjFile.get(), "\n\nreturn geometry;\n}\n");
+        manifest.append((rangeIdx == 0) ? "\n    { \"name\": " : ",\n    { \"name\": ");
+        manifest.appendJsonString(materialsRanges[rangeIdx].m_materialName);
+        manifest.append(", \"diffuse\": ");
+        if (const auto material = objDB.getMaterial(materialID); material.has_value() == true)
+        {
+            const RGB& diffuse = material->get().getColors().m_diffuse;
+            manifest.append('[').append(diffuse.m_r).append(", ").append(diffuse.m_g);
+            manifest.append(", ").append(diffuse.m_b).append("] }");
+        }
+        else
+        {
+            manifest.append("null }");
+        }
+    }
+
+    manifest.append("\n  ]\n}\n");
+    if (manifest.flush(smtManifestFile.get()) == false)
+    {
+        return 1;
+    }
 
     return 0;
 }
@@ -0,0 +1,163 @@
+// =============================================================================
+// Copyright (c) 2017 Othmane AIT EL CADI
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+
+/*
+ * \file      BatchLoaderTests.cpp
+ *
+ * \author    Othmane AIT EL CADI - dartzon@gmail.com
+ * \date      18-10-2026
+ */
+
+#include "ObjBatchLoader.h"
+#include "ObjFileParser.h"
+
+#include "catch.h"
+
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+
+TEST_CASE("Loading a batch of Obj files", "[batch]")
+{
+    const std::vector<std::filesystem::path> objFilesPaths =
+        ObjBatchLoader::expandPaths({"tests/models", "tests/models/*.obj"});
+
+    SECTION("directories and glob patterns should list each Obj file once")
+    {
+        REQUIRE(objFilesPaths.size() == 3);
+    }
+    SECTION("every file should be parsed once, by any worker")
+    {
+        ObjBatchLoader batchLoader(4);
+
+        std::mutex resultsMutex;
+        std::vector<size_t> facesCounts(objFilesPaths.size(), 0);
+        const ObjBatchLoader::BatchStats stats = batchLoader.loadFiles(
+            objFilesPaths, [&](const size_t fileIdx, ObjDatabase&& objDB) {
+                const std::lock_guard<std::mutex> lock(resultsMutex);
+                facesCounts[fileIdx] = objDB.getFacesCount();
+            });
+
+        REQUIRE(stats.m_filesCount == objFilesPaths.size());
+        REQUIRE(stats.m_bytesCount > 0);
+        REQUIRE(stats.getFilesPerSecond() > 0.0);
+
+        for (size_t fileIdx = 0; fileIdx < objFilesPaths.size(); ++fileIdx)
+        {
+            ObjFileParser fp(objFilesPaths[fileIdx].string());
+            REQUIRE(facesCounts[fileIdx] == fp.parseFile().getFacesCount());
+        }
+    }
+    SECTION("asynchronous batches should return one future per file")
+    {
+        ObjBatchLoader batchLoader(2);
+
+        std::vector<std::future<ObjDatabase>> objDBs = batchLoader.loadFilesAsync(objFilesPaths);
+        REQUIRE(objDBs.size() == objFilesPaths.size());
+
+        for (std::future<ObjDatabase>& objDB : objDBs)
+        {
+            REQUIRE(objDB.get().isEmpty() == false);
+        }
+    }
+}
+
+TEST_CASE("Loading a batch with a malformed Obj file", "[batch]")
+{
+    // The vertex's coordinates aren't numbers.
+    const char* pMalformedFilePath = "malformed_tests.obj";
+    std::ofstream(pMalformedFilePath) << "v 1.0 2.0 3.0\nv one two three\nf 1 2 1\n";
+
+    const std::vector<std::filesystem::path> objFilesPaths = {
+        "tests/models/cube.obj", pMalformedFilePath, "tests/models/ducky.obj"};
+
+    SECTION("only the malformed file should fail")
+    {
+        ObjBatchLoader batchLoader(2);
+
+        std::mutex resultsMutex;
+        std::vector<bool> parsedFiles(objFilesPaths.size(), false);
+        std::vector<bool> failedFiles(objFilesPaths.size(), false);
+        const ObjBatchLoader::BatchStats stats = batchLoader.loadFiles(
+            objFilesPaths,
+            [&](const size_t fileIdx, ObjDatabase&&) {
+                const std::lock_guard<std::mutex> lock(resultsMutex);
+                parsedFiles[fileIdx] = true;
+            },
+            [&](const size_t fileIdx, std::exception_ptr) {
+                const std::lock_guard<std::mutex> lock(resultsMutex);
+                failedFiles[fileIdx] = true;
+            });
+
+        REQUIRE(stats.m_filesCount == 2);
+        REQUIRE(stats.m_failedFilesCount == 1);
+        REQUIRE(parsedFiles == std::vector<bool>{true, false, true});
+        REQUIRE(failedFiles == std::vector<bool>{false, true, false});
+    }
+    SECTION("empty or throwing callbacks should not terminate the process")
+    {
+        ObjBatchLoader batchLoader(2);
+
+        const ObjBatchLoader::BatchStats droppedStats = batchLoader.loadFiles(objFilesPaths,
+                                                                              nullptr);
+        REQUIRE(droppedStats.m_filesCount == 2);
+        REQUIRE(droppedStats.m_failedFilesCount == 1);
+
+        // The completion callback's exception fails its file, the failure callback's is dropped.
+        std::mutex resultsMutex;
+        std::vector<std::exception_ptr> errors(objFilesPaths.size());
+        const ObjBatchLoader::BatchStats stats = batchLoader.loadFiles(
+            objFilesPaths,
+            [](const size_t fileIdx, ObjDatabase&&) {
+                if (fileIdx == 0)
+                {
+                    throw std::runtime_error("Rejected database");
+                }
+            },
+            [&](const size_t fileIdx, std::exception_ptr pError) {
+                {
+                    const std::lock_guard<std::mutex> lock(resultsMutex);
+                    errors[fileIdx] = pError;
+                }
+                throw std::logic_error("Failure callback error");
+            });
+
+        REQUIRE(stats.m_filesCount == 1);
+        REQUIRE(stats.m_failedFilesCount == 2);
+        REQUIRE_THROWS_AS(std::rethrow_exception(errors[0]), std::runtime_error);
+        REQUIRE_THROWS_AS(std::rethrow_exception(errors[1]), std::invalid_argument);
+        REQUIRE(errors[2] == nullptr);
+    }
+    SECTION("the malformed file's future should rethrow its parsing exception")
+    {
+        ObjBatchLoader batchLoader(2);
+
+        std::vector<std::future<ObjDatabase>> objDBs = batchLoader.loadFilesAsync(objFilesPaths);
+        REQUIRE(objDBs[0].get().isEmpty() == false);
+        REQUIRE_THROWS_AS(objDBs[1].get(), std::invalid_argument);
+        REQUIRE(objDBs[2].get().isEmpty() == false);
+    }
+
+    std::remove(pMalformedFilePath);
+}
@@ -0,0 +1,91 @@
+// =============================================================================
+// Copyright (c) 2017 Othmane AIT EL CADI
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+
+
+/*
+ * \file      BinaryExportersTests.cpp
+ *
+ * \author    Othmane AIT EL CADI - dartzon@gmail.com
+ * \date      18-10-2026
+ */
+
+#include "ObjBinaryExporters.h"
+#include "ObjDatabase.h"
+#include "ObjFileParser.h"
+#include "ObjRenderMesh.h"
+
+#include "catch.h"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+TEST_CASE("Exporting binary buffers", "[binary]")
+{
+    namespace fs = std::filesystem;
+
+    ObjFileParser fp(std::string("tests/models/cube.obj"));
+    const ObjDatabase objDB = fp.parseFile();
+    const ObjRenderMesh renderMesh(objDB);
+
+    SECTION("raw buffers should hold the vertices and the triangles")
+    {
+        REQUIRE(ObjRawBuffersExporter(objDB).exportFiles("cube_tests") == true);
+        REQUIRE(fs::file_size("cube_tests.positions.f32") == 8 * 3 * sizeof(float));
+        REQUIRE(fs::file_size("cube_tests.indices.u32") == 12 * 3 * sizeof(uint32_t));
+
+        REQUIRE(ObjRawBuffersExporter(renderMesh).exportFiles("cube_tests") == true);
+        REQUIRE(fs::file_size("cube_tests.positions.f32") == 24 * 3 * sizeof(float));
+        REQUIRE(fs::file_size("cube_tests.normals.f32") == 24 * 3 * sizeof(float));
+        REQUIRE(fs::file_size("cube_tests.texcoords.f32") == 24 * 2 * sizeof(float));
+        REQUIRE(fs::file_size("cube_tests.indices.u32") == 12 * 3 * sizeof(uint32_t));
+
+        for (const char* pSuffix :
+             {".positions.f32", ".normals.f32", ".texcoords.f32", ".indices.u32"})
+        {
+            fs::remove(std::string("cube_tests") + pSuffix);
+        }
+    }
+    SECTION("the PLY file should declare the vertices and the faces")
+    {
+        REQUIRE(ObjPlyExporter(objDB).exportFile("cube_tests.ply") == true);
+
+        std::ifstream plyFile("cube_tests.ply", std::ios::binary);
+        std::string header;
+        for (std::string line; (std::getline(plyFile, line)) && (line != "end_header");)
+        {
+            header += line + '\n';
+        }
+        plyFile.close();
+
+        REQUIRE(header.find("format binary_little_endian 1.0\n") != std::string::npos);
+        REQUIRE(header.find("element vertex 8\n") != std::string::npos);
+        REQUIRE(header.find("element face 12\n") != std::string::npos);
+
+        // Header, then 3 floats per vertex, then 1 count and 3 indices per triangle.
+        const size_t bodySize = 8 * 3 * sizeof(float) + 12 * (1 + 3 * sizeof(uint32_t));
+        REQUIRE(fs::file_size("cube_tests.ply") == header.size() + 11 + bodySize);
+
+        fs::remove("cube_tests.ply");
+    }
+}
@@ -0,0 +1,185 @@
+// =============================================================================
+// Copyright (c) 2017 Othmane AIT EL CADI
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+
+/*
+ * \file      CacheDaemonTests.cpp
+ *
+ * \author    Othmane AIT EL CADI - dartzon@gmail.com
+ * \date      18-10-2026
+ */
+
+#include "ObjCacheDaemon.h"
+#include "ObjFileParser.h"
+
+#include "catch.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+/// \brief  Return the counters of a daemon: files, bytes, hits and misses.
+std::array<size_t, 4> getStats(const fs::path& socketPath)
+{
+    const std::optional<std::string> answer = ObjCacheDaemon::sendRequest(socketPath, "STATS");
+    REQUIRE(answer.has_value() == true);
+
+    std::array<size_t, 4> stats = {};
+    std::istringstream(answer->substr(3)) >> stats[0] >> stats[1] >> stats[2] >> stats[3];
+
+    return stats;
+}
+
+}  // namespace
+
+TEST_CASE("Obj files cached by a daemon", "[daemon]")
+{
+    const fs::path tempDirectory = fs::temp_directory_path() /
+                                   ("objparser-daemon-tests-" + std::to_string(getpid()));
+    fs::create_directories(tempDirectory);
+
+    const fs::path socketPath = tempDirectory / "daemon.sock";
+    const fs::path cubePath = tempDirectory / "cube.obj";
+    const fs::path duckyPath = tempDirectory / "ducky.obj";
+    fs::copy_file("tests/models/cube.obj", cubePath);
+    fs::copy_file("tests/models/ducky.obj", duckyPath);
+
+    const size_t cubeFacesCount =
+        ObjFileParser("tests/models/cube.obj").parseFile().getFacesCount();
+
+    SECTION("files should be parsed once and shared until they change")
+    {
+        ObjCacheDaemon cacheDaemon(socketPath);
+        bool isServed = false;
+        std::thread daemonThread([&cacheDaemon, &isServed]() { isServed = cacheDaemon.run(); });
+        while (ObjCacheDaemon::sendRequest(socketPath, "STATS").has_value() == false)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        const auto cubeDB = ObjCacheDaemon::fetch(socketPath, cubePath);
+        REQUIRE(cubeDB.has_value() == true);
+        REQUIRE(cubeDB->getFacesCount() == cubeFacesCount);
+        REQUIRE(ObjCacheDaemon::fetch(socketPath, cubePath).has_value() == true);
+
+        auto stats = getStats(socketPath);
+        REQUIRE(stats[0] == 1);
+        REQUIRE(stats[1] == cubeDB->getSegmentSize());
+        REQUIRE(stats[2] == 1);
+        REQUIRE(stats[3] == 1);
+
+        // A changed file is parsed again.
+        std::ofstream(cubePath, std::ios::app) << "f 1 2 3\n";
+        const auto changedCubeDB = ObjCacheDaemon::fetch(socketPath, cubePath);
+        REQUIRE(changedCubeDB.has_value() == true);
+        REQUIRE(changedCubeDB->getFacesCount() == cubeFacesCount + 1);
+        REQUIRE(getStats(socketPath)[3] == 2);
+
+        // The previous database stays readable.
+        REQUIRE(cubeDB->getFacesCount() == cubeFacesCount);
+
+        const fs::path missingPath = tempDirectory / "none.obj";
+        REQUIRE(ObjCacheDaemon::sendRequest(socketPath, "GET " + missingPath.string())
+                    ->compare(0, 4, "ERR ") == 0);
+        REQUIRE(ObjCacheDaemon::sendRequest(socketPath, "PUT") == "ERR unknown request");
+
+        cacheDaemon.requestStop();
+        daemonThread.join();
+        REQUIRE(isServed == true);
+        REQUIRE(fs::exists(socketPath) == false);
+    }
+    SECTION("malformed files should be answered an error, the daemon serving on")
+    {
+        const fs::path malformedPath = tempDirectory / "malformed.obj";
+        std::ofstream(malformedPath) << "v one two three\n";
+
+        ObjCacheDaemon cacheDaemon(socketPath);
+        bool isServed = false;
+        std::thread daemonThread([&cacheDaemon, &isServed]() { isServed = cacheDaemon.run(); });
+        while (ObjCacheDaemon::sendRequest(socketPath, "STATS").has_value() == false)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        REQUIRE(ObjCacheDaemon::sendRequest(socketPath, "GET " + malformedPath.string()) ==
+                "ERR unable to parse " + fs::weakly_canonical(malformedPath).string());
+        REQUIRE(ObjCacheDaemon::fetch(socketPath, malformedPath).has_value() == false);
+
+        // Requests are served one at a time: the next ones are answered after the failed parse.
+        std::vector<std::thread> clientThreads;
+        std::array<bool, 4> areFetched = {};
+        for (size_t clientIdx = 0; clientIdx < areFetched.size(); ++clientIdx)
+        {
+            clientThreads.emplace_back([&socketPath, &cubePath, &areFetched, clientIdx]() {
+                areFetched[clientIdx] = ObjCacheDaemon::fetch(socketPath, cubePath).has_value();
+            });
+        }
+        std::for_each(clientThreads.begin(), clientThreads.end(), [](std::thread& clientThread) {
+            clientThread.join();
+        });
+        REQUIRE(std::all_of(areFetched.begin(), areFetched.end(), [](const bool isFetched) {
+            return isFetched;
+        }));
+
+        const auto stats = getStats(socketPath);
+        REQUIRE(stats[0] == 1);
+        REQUIRE(stats[2] + stats[3] == areFetched.size() + 2);
+        REQUIRE(stats[3] == 3);
+
+        cacheDaemon.requestStop();
+        daemonThread.join();
+        REQUIRE(isServed == true);
+    }
+    SECTION("the least recently used files should be dropped beyond the memory budget")
+    {
+        ObjCacheDaemon cacheDaemon(socketPath, 1);
+        bool isServed = false;
+        std::thread daemonThread([&cacheDaemon, &isServed]() { isServed = cacheDaemon.run(); });
+        while (ObjCacheDaemon::sendRequest(socketPath, "STATS").has_value() == false)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        REQUIRE(ObjCacheDaemon::fetch(socketPath, cubePath).has_value() == true);
+        REQUIRE(ObjCacheDaemon::fetch(socketPath, duckyPath).has_value() == true);
+        REQUIRE(getStats(socketPath)[0] == 1);
+
+        REQUIRE(ObjCacheDaemon::fetch(socketPath, cubePath).has_value() == true);
+        REQUIRE(getStats(socketPath)[3] == 3);
+
+        cacheDaemon.requestStop();
+        daemonThread.join();
+        REQUIRE(isServed == true);
+    }
+
+    fs::remove_all(tempDirectory);
+}
@@ -0,0 +1,129 @@
+// =============================================================================
+// Copyright (c) 2017 Othmane AIT EL CADI
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+
+/*
+ * \file      CompressedInputTests.cpp
+ *
+ * \author    Othmane AIT EL CADI - dartzon@gmail.com
+ * \date      18-10-2026
+ */
+
+#include "ObjCompressedStreamReader.h"
+#include "ObjFileParser.h"
+
+#include "catch.h"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+using Compression = ObjCompressedStreamReader::Compression;
+
+TEST_CASE("Compressed Obj files", "[compressed]")
+{
+    const std::string objFilePath = "tests/models/cube.obj";
+    const std::string gzObjFilePath = "tests/models/cube.obj.gz";
+
+    std::ostringstream objText;
+    objText << std::ifstream(objFilePath).rdbuf();
+
+    SECTION("compressions should be identified by their magic number")
+    {
+        REQUIRE(ObjCompressedStreamReader::detectCompression(gzObjFilePath) == Compression::GZIP);
+        REQUIRE(ObjCompressedStreamReader::detectCompression(objFilePath) == Compression::NONE);
+        REQUIRE(ObjCompressedStreamReader::detectCompression("tests/models/none.obj") ==
+                Compression::NONE);
+    }
+    SECTION("uncompressed files should be read as is through the ring of blocks")
+    {
+        ObjCompressedStreamReader reader(objFilePath, 16, 2);
+
+        std::string text;
+        std::array<char, 5> buffer;
+        for (size_t readSize = reader.read(buffer.data(), buffer.size()); readSize > 0;
+             readSize = reader.read(buffer.data(), buffer.size()))
+        {
+            text.append(buffer.data(), readSize);
+        }
+
+        REQUIRE(text == objText.str());
+        REQUIRE(reader.hasFailed() == false);
+    }
+    SECTION("missing files should fail without any text")
+    {
+        ObjCompressedStreamReader reader("tests/models/none.obj.gz");
+
+        std::array<char, 16> buffer;
+        REQUIRE(reader.read(buffer.data(), buffer.size()) == 0);
+        REQUIRE(reader.hasFailed() == true);
+    }
+    SECTION("readers destroyed before the end of the file should stop their decompression")
+    {
+        ObjCompressedStreamReader reader(objFilePath, 4, 2);
+
+        std::array<char, 4> buffer;
+        REQUIRE(reader.read(buffer.data(), buffer.size()) == buffer.size());
+    }
+
+    if (ObjCompressedStreamReader::isCompressionAvailable(Compression::GZIP) == true)
+    {
+        SECTION("gzip files should give the same text and database as their Obj file")
+        {
+            ObjCompressedStreamReader reader(gzObjFilePath, 64, 3);
+
+            std::string text;
+            std::array<char, 100> buffer;
+            for (size_t readSize = reader.read(buffer.data(), buffer.size()); readSize > 0;
+                 readSize = reader.read(buffer.data(), buffer.size()))
+            {
+                text.append(buffer.data(), readSize);
+            }
+            REQUIRE(text == objText.str());
+
+            ObjFileParser fp(objFilePath);
+            const ObjDatabase objDB = fp.parseFile();
+            ObjFileParser gzFp(gzObjFilePath);
+            const ObjDatabase gzObjDB = gzFp.parseFile();
+
+            REQUIRE(gzObjDB.getVerticesCount() == objDB.getVerticesCount());
+            REQUIRE(gzObjDB.getFacesCount() == objDB.getFacesCount());
+            REQUIRE(gzObjDB.getMaterialLibraries().front() != nullptr);
+        }
+        SECTION("truncated gzip files should fail their parsing")
+        {
+            namespace fs = std::filesystem;
+
+            std::ostringstream gzText;
+            gzText << std::ifstream(gzObjFilePath, std::ios::binary).rdbuf();
+
+            const fs::path truncatedFilePath = fs::temp_directory_path() / "truncated_tests.obj.gz";
+            std::ofstream(truncatedFilePath, std::ios::binary)
+                << gzText.str().substr(0, gzText.str().size() / 2);
+
+            ObjFileParser truncatedFp(truncatedFilePath.string());
+            REQUIRE_THROWS_AS(truncatedFp.parseFile(), std::runtime_error);
+            fs::remove(truncatedFilePath);
+        }
+    }
+}
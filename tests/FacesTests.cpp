@@ -36,15 +36,10 @@
 TEST_CASE("Loading Faces", "[face]")
 {
     const char* pFilePath = "tests/models/cube.obj";
-    ObjDatabase objDB;
-    ObjFileParser fp(pFilePath, objDB);
+    ObjFileParser fp(pFilePath);
 
-    const bool opened = fp.parseFile();
+    const ObjDatabase objDB = fp.parseFile();
 
-    SECTION("reading and parsing the Obj file")
-    {
-        REQUIRE(opened == true);
-    }
     SECTION("successful reading changes the count of objects in the Obj database")
     {
         const size_t entCount = objDB.getEntitiesCount();
@@ -53,51 +48,30 @@ TEST_CASE("Loading Faces", "[face]")
     }
     SECTION("there should be exactly 12 Faces in the Obj database")
     {
-        size_t faceCount = 0;
-
-        ObjEntity* pEnt = nullptr;
-        while((pEnt = objDB.getNextEntity()) != nullptr)
-        {
-            if(pEnt->getType() == ElementType::FACE)
-            {
-                ++faceCount;
-            }
-        }
-
-        REQUIRE(faceCount == 12);
+        REQUIRE(objDB.getFacesCount() == 12);
     }
     SECTION("all the Faces are triangles")
     {
-        ObjEntity* pEnt = nullptr;
-        while((pEnt = objDB.getNextEntity()) != nullptr)
+        for (auto faceItr = objDB.cbegin<ElementType::FACE>();
+             faceItr != objDB.cend<ElementType::FACE>();
+             ++faceItr)
         {
-            if(pEnt->getType() == ElementType::FACE)
-            {
-                ObjEntityFace& fc = *static_cast<ObjEntityFace*>(pEnt);
-
-                const size_t countIdx = fc.getIndicesCount();
-                const VerticesIdxOrganization vtxIdxOrg = fc.getVerticesIndicesOrganization();
+            const auto [firstIdx, lastIdx] = faceItr->getVerticesIndicesRange();
 
-                REQUIRE(vtxIdxOrg == VerticesIdxOrganization::VGEO_VTEXTURE_VNORMAL);
-                REQUIRE(countIdx == 9);
-                REQUIRE(fc.isTriangle() == true);
-            }
+            REQUIRE(lastIdx - firstIdx + 1 == 9);
+            REQUIRE(faceItr->getCornersCount() == 3);
+            REQUIRE(faceItr->isTriangle() == true);
         }
     }
     SECTION("all the Faces have a full triplet indices")
     {
-        ObjEntity* pEnt = nullptr;
-        while((pEnt = objDB.getNextEntity()) != nullptr)
+        for (auto faceItr = objDB.cbegin<ElementType::FACE>();
+             faceItr != objDB.cend<ElementType::FACE>();
+             ++faceItr)
         {
-            if(pEnt->getType() == ElementType::FACE)
-            {
-                ObjEntityFace& fc = *static_cast<ObjEntityFace*>(pEnt);
+            const VerticesIdxOrganization vtxIdxOrg = faceItr->getVerticesIndicesOrganization();
 
-                const VerticesIdxOrganization vtxIdxOrg = fc.getVerticesIndicesOrganization();
-
-                REQUIRE(vtxIdxOrg == VerticesIdxOrganization::VGEO_VTEXTURE_VNORMAL);
-            }
+            REQUIRE(vtxIdxOrg == VerticesIdxOrganization::VGEO_VTEXTURE_VNORMAL);
         }
     }
 }
-
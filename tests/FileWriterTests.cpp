@@ -0,0 +1,148 @@
+// =============================================================================
+// Copyright (c) 2017 Othmane AIT EL CADI
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+
+
+/*
+ * \file      FileWriterTests.cpp
+ *
+ * \author    Othmane AIT EL CADI - dartzon@gmail.com
+ * \date      18-10-2026
+ */
+
+#include "ObjDatabase.h"
+#include "ObjFileParser.h"
+#include "ObjFileWriter.h"
+
+#include "catch.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+TEST_CASE("Writing an Obj file", "[writer]")
+{
+    ObjFileParser fp(std::string("tests/models/cube.obj"));
+    const ObjDatabase objDB = fp.parseFile();
+
+    const char* pObjFilePath = "cube_tests.obj";
+    REQUIRE(ObjFileWriter(objDB).writeFile(pObjFilePath) == true);
+
+    ObjFileParser rtFp(std::string{pObjFilePath});
+    const ObjDatabase rtObjDB = rtFp.parseFile();
+    std::remove(pObjFilePath);
+
+    SECTION("the written file should parse back to the same entities")
+    {
+        REQUIRE(rtObjDB.getEntitiesCount() == objDB.getEntitiesCount());
+        REQUIRE(rtObjDB.getVerticesCount() == objDB.getVerticesCount());
+        REQUIRE(rtObjDB.getFacesCount() == objDB.getFacesCount());
+        REQUIRE(rtObjDB.getGroupsCount() == objDB.getGroupsCount());
+
+        for (size_t entityIdx = 0; entityIdx < objDB.getEntitiesCount(); ++entityIdx)
+        {
+            REQUIRE(rtObjDB.getEntity(entityIdx).getType() ==
+                    objDB.getEntity(entityIdx).getType());
+        }
+    }
+    SECTION("vertices and faces indices should be exact")
+    {
+        REQUIRE(std::equal(cbegin<ElementType::VERTEX>(objDB),
+                           cend<ElementType::VERTEX>(objDB),
+                           cbegin<ElementType::VERTEX>(rtObjDB),
+                           [](const Vertex_t& vtx, const Vertex_t& rtVtx) {
+                               return (vtx.m_x == rtVtx.m_x) && (vtx.m_y == rtVtx.m_y) &&
+                                      (vtx.m_z == rtVtx.m_z) && (vtx.m_w == rtVtx.m_w);
+                           }));
+
+        auto rtFaceItr = cbegin<ElementType::FACE>(rtObjDB);
+        std::for_each(cbegin<ElementType::FACE>(objDB),
+                      cend<ElementType::FACE>(objDB),
+                      [&](const ObjEntityFace& face) {
+                          const auto [idxItr, idxEnd] = objDB.getVerticesIterators(face);
+                          const auto [rtIdxItr, rtIdxEnd] = rtObjDB.getVerticesIterators(
+                              *rtFaceItr++);
+                          REQUIRE(std::equal(idxItr, idxEnd, rtIdxItr, rtIdxEnd) == true);
+                      });
+    }
+    SECTION("groups should keep their ranges")
+    {
+        auto rtGrpItr = cbegin<ElementType::GROUP_NAME>(rtObjDB);
+        std::for_each(cbegin<ElementType::GROUP_NAME>(objDB),
+                      cend<ElementType::GROUP_NAME>(objDB),
+                      [&](const ObjEntityGroup& grp) {
+                          REQUIRE(grp == *rtGrpItr);
+                          REQUIRE(grp.getEntitiesIndicesRange() ==
+                                  rtGrpItr->getEntitiesIndicesRange());
+                          ++rtGrpItr;
+                      });
+    }
+}
+
+TEST_CASE("Writing an Obj file with several workers", "[writer]")
+{
+    // A strip of triangles with enough entities to be formatted by several workers.
+    const char* pSourceFilePath = "strip_tests.obj";
+    {
+        std::ofstream sourceFile(pSourceFilePath);
+        constexpr size_t verticesCount = 20000;
+        for (size_t vtxIdx = 0; vtxIdx < verticesCount; ++vtxIdx)
+        {
+            sourceFile << "v " << vtxIdx << ' ' << (vtxIdx % 2) << " 0.5\n";
+        }
+        for (size_t faceIdx = 0; faceIdx + 2 < verticesCount; ++faceIdx)
+        {
+            if ((faceIdx % 1000) == 0)
+            {
+                sourceFile << "g part" << faceIdx / 1000 << "\ns " << (faceIdx / 1000) % 3 << '\n';
+            }
+            sourceFile << "f " << faceIdx + 1 << ' ' << faceIdx + 2 << ' ' << faceIdx + 3 << '\n';
+        }
+    }
+
+    ObjFileParser fp(std::string{pSourceFilePath});
+    const ObjDatabase objDB = fp.parseFile();
+    std::remove(pSourceFilePath);
+    REQUIRE(objDB.getFacesCount() == 19998);
+
+    const char* pSingleFilePath = "strip_single_tests.obj";
+    const char* pMultiFilePath = "strip_multi_tests.obj";
+    REQUIRE(ObjFileWriter(objDB, 1).writeFile(pSingleFilePath) == true);
+    REQUIRE(ObjFileWriter(objDB, 4).writeFile(pMultiFilePath) == true);
+
+    auto readFile = [](const char* pFilePath) {
+        std::ifstream file(pFilePath, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    };
+    const std::string singleText = readFile(pSingleFilePath);
+    const std::string multiText = readFile(pMultiFilePath);
+    std::remove(pSingleFilePath);
+    std::remove(pMultiFilePath);
+
+    SECTION("the file should be identical to the one written by a single worker")
+    {
+        REQUIRE(singleText.empty() == false);
+        REQUIRE(multiText == singleText);
+    }
+}
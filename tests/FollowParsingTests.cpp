@@ -0,0 +1,146 @@
+// =============================================================================
+// Copyright (c) 2017 Othmane AIT EL CADI
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+
+/*
+ * \file      FollowParsingTests.cpp
+ *
+ * \author    Othmane AIT EL CADI - dartzon@gmail.com
+ * \date      18-10-2026
+ */
+
+#include "ObjFileParser.h"
+
+#include "catch.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace
+{
+/// \brief  Return whether two databases hold the same faces, groups and indices.
+bool areDatabasesEqual(const ObjDatabase& objDB, const ObjDatabase& expectedDB)
+{
+    auto areGroupsEqual = [](const ObjEntityGroup& grp, const ObjEntityGroup& expectedGrp) {
+        return (grp == expectedGrp) &&
+               (grp.getAllIncludedEntitiesRanges() == expectedGrp.getAllIncludedEntitiesRanges());
+    };
+
+    return (objDB.getVerticesCount() == expectedDB.getVerticesCount()) &&
+           (objDB.getFacesCount() == expectedDB.getFacesCount()) &&
+           (objDB.getIndexBuffer() == expectedDB.getIndexBuffer()) &&
+           (objDB.getEntitiesTable() == expectedDB.getEntitiesTable()) &&
+           std::equal(objDB.cbegin<ElementType::GROUP_NAME>(),
+                      objDB.cend<ElementType::GROUP_NAME>(),
+                      expectedDB.cbegin<ElementType::GROUP_NAME>(),
+                      expectedDB.cend<ElementType::GROUP_NAME>(),
+                      areGroupsEqual);
+}
+
+/// \brief  Append a text to a file.
+void appendText(const std::filesystem::path& filePath, const std::string& objText)
+{
+    std::ofstream objFile(filePath, std::ios::binary | std::ios::app);
+    objFile << objText;
+}
+
+}  // namespace
+
+TEST_CASE("Obj files followed while written", "[follow]")
+{
+    const std::filesystem::path objFilePath = "tests/follow_tmp.obj";
+    std::filesystem::remove(objFilePath);
+
+    const std::string objText = "g first\n"
+                                "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\n"
+                                "f -4 -3 -2\n"
+                                "g second\n"
+                                "s 1\n"
+                                "f 1 2 \\\n 4\n"
+                                "v 2 2 2\n"
+                                "f -1 -2 -3\n"
+                                "g third\n"
+                                "f 1 3 4\n";
+
+    ObjFileParser fp(objFilePath.string());
+
+    SECTION("only the complete lines should be parsed")
+    {
+        const size_t partialLineEnd = objText.find("f 1 2") + 3;
+        appendText(objFilePath, objText.substr(0, partialLineEnd));
+
+        REQUIRE(fp.followFile() == objText.find("f 1 2"));
+        REQUIRE(fp.getDatabase().getFacesCount() == 1);
+
+        // A continued line waits for the line continuing it.
+        const size_t continuedLineEnd = objText.find(" 4\n");
+        appendText(objFilePath, objText.substr(partialLineEnd, continuedLineEnd - partialLineEnd));
+
+        REQUIRE(fp.followFile() == 0);
+        REQUIRE(fp.getDatabase().getFacesCount() == 1);
+
+        appendText(objFilePath, objText.substr(continuedLineEnd));
+
+        REQUIRE(fp.followFile() == objText.size() - objText.find("f 1 2"));
+        REQUIRE(fp.followFile() == 0);
+        REQUIRE(areDatabasesEqual(fp.getDatabase(), ObjFileParser().parseBuffer(objText)) == true);
+    }
+    SECTION("the groups should go on across the appended texts")
+    {
+        for (size_t textPos = 0; textPos < objText.size(); textPos += 7)
+        {
+            appendText(objFilePath, objText.substr(textPos, 7));
+            fp.followFile();
+
+            // The parsed part of the text is a complete database, unless its last line is
+            // continued.
+            const std::string parsedText = objText.substr(
+                0, objText.rfind('\n', std::min(textPos + 7, objText.size()) - 1) + 1);
+            const bool isLastLineContinued = (parsedText.size() >= 2) &&
+                                             (parsedText.substr(parsedText.size() - 2) == "\\\n");
+            if (isLastLineContinued == false)
+            {
+                REQUIRE(
+                    areDatabasesEqual(fp.getDatabase(), ObjFileParser().parseBuffer(parsedText)) ==
+                    true);
+            }
+        }
+
+        REQUIRE(areDatabasesEqual(fp.getDatabase(), ObjFileParser().parseBuffer(objText)) == true);
+    }
+    SECTION("rewritten files should be parsed again")
+    {
+        appendText(objFilePath, objText);
+        REQUIRE(fp.followFile() == objText.size());
+
+        std::filesystem::remove(objFilePath);
+        appendText(objFilePath, "v 0 0 0\nf 1 1 1\n");
+
+        REQUIRE(fp.followFile() == 16);
+        REQUIRE(areDatabasesEqual(fp.getDatabase(),
+                                  ObjFileParser().parseBuffer("v 0 0 0\nf 1 1 1\n")) == true);
+    }
+
+    std::filesystem::remove(objFilePath);
+}
@@ -0,0 +1,104 @@
+// =============================================================================
+// Copyright (c) 2017 Othmane AIT EL CADI
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+
+/*
+ * \file      GroupViewsTests.cpp
+ *
+ * \author    Othmane AIT EL CADI - dartzon@gmail.com
+ * \date      18-10-2026
+ */
+
+#include "ObjDatabase.h"
+#include "ObjFileParser.h"
+#include "ObjEntityFace.h"
+
+#include "catch.h"
+
+TEST_CASE("Viewing Groups' entities", "[group][view]")
+{
+    ObjFileParser fp(std::string("tests/models/cube.obj"));
+    const ObjDatabase objDB = fp.parseFile();
+
+    // Collect the smoothing groups (s) of the cube.
+    std::vector<std::reference_wrapper<const ObjEntityGroup>> smoothingGroups;
+    for (size_t grpID = 1; grpID <= objDB.getEntitiesCount(); ++grpID)
+    {
+        if (const auto grpOpt = objDB.getGroup(grpID);
+            (grpOpt.has_value() == true) && (grpOpt->get().getType() == ElementType::SMOOTHING_GROUP))
+        {
+            smoothingGroups.push_back(*grpOpt);
+        }
+    }
+
+    SECTION("there should be exactly 6 smoothing groups in the Obj database")
+    {
+        REQUIRE(smoothingGroups.size() == 6);
+    }
+    SECTION("each smoothing group includes 2 triangles")
+    {
+        for (const ObjEntityGroup& grp : smoothingGroups)
+        {
+            const ObjGroupFacesView facesView = objDB.getFacesInGroup(grp);
+
+            REQUIRE(facesView.size() == 2);
+            REQUIRE(std::distance(facesView.begin(), facesView.end()) == 2);
+
+            for (const ObjEntityFace& face : facesView)
+            {
+                REQUIRE(face.isTriangle() == true);
+            }
+        }
+    }
+    SECTION("the entities view yields the group itself followed by its faces")
+    {
+        for (const ObjEntityGroup& grp : smoothingGroups)
+        {
+            const ObjGroupEntitiesView entitiesView = objDB.getEntitiesInGroup(grp);
+            const ObjGroupFacesView facesView = objDB.getFacesInGroup(grp);
+
+            auto entityItr = entitiesView.begin();
+            REQUIRE(entityItr->getType() == ElementType::SMOOTHING_GROUP);
+            REQUIRE(*entityItr == grp);
+
+            for (const ObjEntityFace& face : facesView)
+            {
+                ++entityItr;
+                REQUIRE(entityItr->getType() == ElementType::FACE);
+                REQUIRE(&*entityItr == &face);
+            }
+
+            REQUIRE(++entityItr == entitiesView.end());
+        }
+    }
+    SECTION("the faces of all the smoothing groups are the faces of the Obj database")
+    {
+        size_t faceCount = 0;
+
+        for (const ObjEntityGroup& grp : smoothingGroups)
+        {
+            faceCount += objDB.getFacesInGroup(grp).size();
+        }
+
+        REQUIRE(faceCount == objDB.getFacesCount());
+    }
+}
@@ -38,43 +38,28 @@
 TEST_CASE("Loading Groups", "[group]")
 {
     const char* pFilePath = "tests/models/ducky.obj";
-    ObjDatabase objDB;
-    ObjFileParser fp(pFilePath, objDB);
+    ObjFileParser fp(pFilePath);
 
-    const bool opened = fp.parseFile();
+    const ObjDatabase objDB = fp.parseFile();
 
-    SECTION("reading and parsing the Obj file")
-    {
-        REQUIRE(opened == true);
-    }
     SECTION("successful reading changes the count of objects in the Obj database")
     {
         const size_t grpCount = objDB.getGroupsCount();
 
         REQUIRE(grpCount > 0);
     }
-    SECTION("there should be exactly 4 Groups in the Obj database")
+    SECTION("there should be the default group and one group per name of the 4 g statements")
     {
-        size_t grpCount = 0;
-
-        while(objDB.getNextGroup() != nullptr)
-        {
-            ++grpCount;
-        }
-
-        REQUIRE(grpCount == 4);
+        REQUIRE(objDB.getGroupsCount() == 11);
     }
     SECTION("all the groups are of type group name (g)")
     {
-        bool isGrpName = true;
-
-        ObjGroup* pGrp = nullptr;
-        while((pGrp = objDB.getNextGroup()) != nullptr)
-        {
-            isGrpName &= (pGrp->getType() == ElementType::GROUP);
-        }
+        const bool isGrpName = std::all_of(objDB.cbegin<ElementType::GROUP_NAME>(),
+                                           objDB.cend<ElementType::GROUP_NAME>(),
+                                           [](const ObjEntityGroup& grp) {
+                                               return grp.getType() == ElementType::GROUP_NAME;
+                                           });
 
         REQUIRE(isGrpName == true);
     }
 }
-
@@ -0,0 +1,75 @@
+// =============================================================================
+// Copyright (c) 2017 Othmane AIT EL CADI
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+
+/*
+ * \file      HalfEdgeTests.cpp
+ *
+ * \author    Othmane AIT EL CADI - dartzon@gmail.com
+ * \date      18-10-2026
+ */
+
+#include "ObjDatabase.h"
+#include "ObjFileParser.h"
+#include "ObjHalfEdgeMesh.h"
+
+#include "catch.h"
+
+TEST_CASE("Building faces adjacency", "[halfedge]")
+{
+    ObjFileParser fp(std::string("tests/models/cube.obj"));
+    const ObjDatabase objDB = fp.parseFile();
+    const ObjHalfEdgeMesh heMesh(objDB);
+
+    SECTION("there should be exactly 3 half-edges per triangle")
+    {
+        REQUIRE(heMesh.getFacesCount() == 12);
+        REQUIRE(heMesh.getHalfEdgesCount() == 36);
+        REQUIRE(heMesh.getSkippedFacesCount() == 0);
+    }
+    SECTION("the cube is a closed manifold")
+    {
+        REQUIRE(heMesh.isManifold() == true);
+        REQUIRE(heMesh.isClosed() == true);
+        REQUIRE(heMesh.getBoundaryEdgesCount() == 0);
+    }
+    SECTION("twin half-edges are opposite")
+    {
+        for (uint32_t heIdx = 0; heIdx < heMesh.getHalfEdgesCount(); ++heIdx)
+        {
+            const uint32_t twinIdx = heMesh.getTwin(heIdx);
+
+            REQUIRE(twinIdx != ObjHalfEdgeMesh::INVALID_INDEX);
+            REQUIRE(heMesh.getTwin(twinIdx) == heIdx);
+            REQUIRE(heMesh.getOrigin(twinIdx) == heMesh.getTarget(heIdx));
+            REQUIRE(heMesh.getTarget(twinIdx) == heMesh.getOrigin(heIdx));
+            REQUIRE(heMesh.getNext(heMesh.getPrev(heIdx)) == heIdx);
+        }
+    }
+    SECTION("each triangle has 3 neighbor faces")
+    {
+        for (uint32_t faceIdx = 0; faceIdx < heMesh.getFacesCount(); ++faceIdx)
+        {
+            REQUIRE(heMesh.getNeighborFaces(faceIdx).size() == 3);
+        }
+    }
+}
@@ -0,0 +1,212 @@
+// =============================================================================
+// Copyright (c) 2017 Othmane AIT EL CADI
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+
+/*
+ * \file      IncrementalParsingTests.cpp
+ *
+ * \author    Othmane AIT EL CADI - dartzon@gmail.com
+ * \date      18-10-2026
+ */
+
+#include "ObjFileParser.h"
+
+#include "catch.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace
+{
+/// \brief  Return whether two databases hold the same entities.
+bool areDatabasesEqual(const ObjDatabase& objDB, const ObjDatabase& expectedDB)
+{
+    auto areVerticesEqual = [](const ObjEntityVertex& vtx, const ObjEntityVertex& expectedVtx) {
+        const auto [x, y, z, w] = vtx;
+        const auto [expectedX, expectedY, expectedZ, expectedW] = expectedVtx;
+        return (x == expectedX) && (y == expectedY) && (z == expectedZ) && (w == expectedW);
+    };
+
+    auto areFacesEqual = [](const ObjEntityFace& face, const ObjEntityFace& expectedFace) {
+        return (face.getVerticesIndicesRange() == expectedFace.getVerticesIndicesRange()) &&
+               (face.getMaterialID() == expectedFace.getMaterialID());
+    };
+
+    auto areGroupsEqual = [](const ObjEntityGroup& grp, const ObjEntityGroup& expectedGrp) {
+        return (grp == expectedGrp) && (grp.getID() == expectedGrp.getID()) &&
+               (grp.getAllIncludedEntitiesRanges() == expectedGrp.getAllIncludedEntitiesRanges());
+    };
+
+    return (objDB.getEntitiesCount() == expectedDB.getEntitiesCount()) &&
+           (objDB.getVerticesCount(ElementType::VERTEX_NORMAL) ==
+            expectedDB.getVerticesCount(ElementType::VERTEX_NORMAL)) &&
+           std::equal(objDB.cbegin<ElementType::VERTEX>(),
+                      objDB.cend<ElementType::VERTEX>(),
+                      expectedDB.cbegin<ElementType::VERTEX>(),
+                      expectedDB.cend<ElementType::VERTEX>(),
+                      areVerticesEqual) &&
+           std::equal(objDB.cbegin<ElementType::FACE>(),
+                      objDB.cend<ElementType::FACE>(),
+                      expectedDB.cbegin<ElementType::FACE>(),
+                      expectedDB.cend<ElementType::FACE>(),
+                      areFacesEqual) &&
+           std::equal(objDB.cbegin<ElementType::GROUP_NAME>(),
+                      objDB.cend<ElementType::GROUP_NAME>(),
+                      expectedDB.cbegin<ElementType::GROUP_NAME>(),
+                      expectedDB.cend<ElementType::GROUP_NAME>(),
+                      areGroupsEqual) &&
+           (objDB.getIndexBuffer() == expectedDB.getIndexBuffer()) &&
+           (objDB.getMaterialsCount() == expectedDB.getMaterialsCount()) &&
+           (objDB.getEntitiesTable() == expectedDB.getEntitiesTable());
+}
+
+/// \brief  Return an Obj text of cubes, each one in its own groups and material.
+std::string makeCubesText(const size_t cubesCount)
+{
+    std::string objText;
+    for (size_t cubeIdx = 0; cubeIdx < cubesCount; ++cubeIdx)
+    {
+        const std::string offset = std::to_string(cubeIdx * 2);
+        objText += "g cube" + std::to_string(cubeIdx) + " side\n";
+        objText += "s " + std::to_string(cubeIdx % 3) + "\n";
+        objText += "usemtl material" + std::to_string(cubeIdx % 4) + "\n";
+        for (const char* pCorner : {"0 0 0", "1 0 0", "1 1 0", "0 1 0", "0 0 1", "1 0 1"})
+        {
+            objText += "v " + offset + " " + pCorner + "\n";
+        }
+        objText += "vn 0 0 1\n";
+        objText += "f -6//-1 -5//-1 -4//-1 \\\n   -3//-1\n";
+        objText += "f -2//1 -1//1 -4//1\n";
+    }
+
+    return objText;
+}
+
+/// \brief  Write an Obj text to a file.
+void writeText(const std::filesystem::path& filePath, const std::string& objText)
+{
+    std::ofstream objFile(filePath, std::ios::binary | std::ios::trunc);
+    objFile << objText;
+}
+
+}  // namespace
+
+TEST_CASE("Obj files reparsed incrementally", "[incremental]")
+{
+    const std::filesystem::path objFilePath = "tests/incremental_tmp.obj";
+    constexpr size_t chunkSize = 256;
+
+    std::string objText = makeCubesText(60);
+    writeText(objFilePath, objText);
+
+    ObjFileParser fp(objFilePath.string());
+    REQUIRE(areDatabasesEqual(fp.parseFileIncrementally(chunkSize),
+                              ObjFileParser().parseBuffer(objText)) == true);
+
+    SECTION("unchanged files should not be reparsed")
+    {
+        REQUIRE(fp.reparseChanges() == 0);
+        REQUIRE(areDatabasesEqual(fp.getDatabase(), ObjFileParser().parseBuffer(objText)) == true);
+    }
+    SECTION("changes near the end should only reparse the last chunks")
+    {
+        objText.replace(objText.rfind("v 118 1 1 0"), 11, "v 118 1 5 0");
+        writeText(objFilePath, objText);
+
+        const uint64_t reparsedBytesCount = fp.reparseChanges();
+        REQUIRE(reparsedBytesCount > 0);
+        REQUIRE(reparsedBytesCount < 3 * chunkSize);
+        REQUIRE(areDatabasesEqual(fp.getDatabase(), ObjFileParser().parseBuffer(objText)) == true);
+    }
+    SECTION("changes in the middle should reparse the file from the changed chunk")
+    {
+        const size_t changePos = objText.find("g cube30");
+        objText.insert(changePos, "g inserted\nusemtl added\nv 5 5 5\nf -1 -1 -1\ng extra\n");
+        writeText(objFilePath, objText);
+
+        const uint64_t reparsedBytesCount = fp.reparseChanges();
+        REQUIRE(reparsedBytesCount >= objText.size() - changePos);
+        REQUIRE(reparsedBytesCount < objText.size() - changePos + chunkSize * 2);
+        REQUIRE(areDatabasesEqual(fp.getDatabase(), ObjFileParser().parseBuffer(objText)) == true);
+    }
+    SECTION("changes at the start should only reparse the first chunks")
+    {
+        objText.insert(0, "mtllib missing.mtl\n");
+        objText.replace(objText.find("v 0 1 0 0"), 9, "v 0 1 7 0");
+        writeText(objFilePath, objText);
+
+        const uint64_t reparsedBytesCount = fp.reparseChanges();
+        REQUIRE(reparsedBytesCount > 0);
+        REQUIRE(reparsedBytesCount < 3 * chunkSize);
+        REQUIRE(areDatabasesEqual(fp.getDatabase(), ObjFileParser().parseBuffer(objText)) == true);
+    }
+    SECTION("changes of the vertices counts should move the negative indices after them")
+    {
+        // Only negative indices, the entities after the inserted ones are moved.
+        for (size_t idxPos = objText.find("//1"); idxPos != std::string::npos;
+             idxPos = objText.find("//1", idxPos))
+        {
+            objText.replace(idxPos, 3, "//-1");
+        }
+        writeText(objFilePath, objText);
+        fp.parseFileIncrementally(chunkSize);
+
+        objText.insert(objText.find("g cube1"),
+                       "g extra\nv 9 9 9\nvn 1 0 0\nf -1//-1 -2//-1 -3//-1\n");
+        objText.erase(objText.find("vn 0 0 1\n"), 9);
+        writeText(objFilePath, objText);
+
+        const uint64_t reparsedBytesCount = fp.reparseChanges();
+        REQUIRE(reparsedBytesCount > 0);
+        REQUIRE(reparsedBytesCount < 3 * chunkSize);
+        REQUIRE(areDatabasesEqual(fp.getDatabase(), ObjFileParser().parseBuffer(objText)) == true);
+
+        // Mixed with positive indices, the chunks after the changed vertices are reparsed.
+        objText.replace(objText.rfind("f -2//-1"), 8, "f 2//-1");
+        writeText(objFilePath, objText);
+        fp.reparseChanges();
+
+        objText.erase(objText.find("v 9 9 9\n"), 8);
+        writeText(objFilePath, objText);
+
+        REQUIRE(fp.reparseChanges() > objText.size() - 3 * chunkSize);
+        REQUIRE(areDatabasesEqual(fp.getDatabase(), ObjFileParser().parseBuffer(objText)) == true);
+    }
+    SECTION("appended and truncated files should keep their unchanged chunks")
+    {
+        objText += makeCubesText(3);
+        writeText(objFilePath, objText);
+
+        REQUIRE(fp.reparseChanges() < objText.size() / 2);
+        REQUIRE(areDatabasesEqual(fp.getDatabase(), ObjFileParser().parseBuffer(objText)) == true);
+
+        objText.resize(objText.find("g cube40"));
+        writeText(objFilePath, objText);
+
+        REQUIRE(fp.reparseChanges() < objText.size() / 2);
+        REQUIRE(areDatabasesEqual(fp.getDatabase(), ObjFileParser().parseBuffer(objText)) == true);
+    }
+
+    std::filesystem::remove(objFilePath);
+}
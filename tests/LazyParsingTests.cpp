@@ -0,0 +1,179 @@
+// =============================================================================
+// Copyright (c) 2017 Othmane AIT EL CADI
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+
+/*
+ * \file      LazyParsingTests.cpp
+ *
+ * \author    Othmane AIT EL CADI - dartzon@gmail.com
+ * \date      18-10-2026
+ */
+
+#include "ObjLazyParser.h"
+
+#include "catch.h"
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
+
+TEST_CASE("Obj texts parsed lazily by batches", "[lazy]")
+{
+    SECTION("batches should hold the whole file's elements, with its indices")
+    {
+        const std::string objFilePath = "tests/models/ducky.obj";
+        const ObjDatabase objDB = ObjFileParser(objFilePath).parseFile();
+
+        ObjLazyParser lazyParser(objFilePath, 1000);
+
+        size_t batchesCount = 0, verticesCount = 0, facesCount = 0;
+        bool areVerticesEqual = true;
+        std::vector<size_t> indices;
+        for (const ObjDatabase& batch : lazyParser)
+        {
+            ++batchesCount;
+            REQUIRE(lazyParser.getFirstVertexIndex() == verticesCount);
+            REQUIRE(lazyParser.getFirstFaceIndex() == facesCount);
+
+            for (auto vtxItr = batch.cbegin<ElementType::VERTEX>();
+                 vtxItr != batch.cend<ElementType::VERTEX>();
+                 ++vtxItr, ++verticesCount)
+            {
+                const auto [x, y, z, w] = *vtxItr;
+                const auto [expectedX, expectedY, expectedZ, expectedW] =
+                    *objDB.getVertex(ElementType::VERTEX, verticesCount);
+                areVerticesEqual = areVerticesEqual && (x == expectedX) && (y == expectedY) &&
+                                   (z == expectedZ);
+            }
+
+            for (auto faceItr = batch.cbegin<ElementType::FACE>();
+                 faceItr != batch.cend<ElementType::FACE>();
+                 ++faceItr, ++facesCount)
+            {
+                const auto [first, last] = batch.getVerticesIterators(*faceItr);
+                indices.insert(indices.end(), first, last);
+            }
+        }
+
+        REQUIRE(batchesCount > 2);
+        REQUIRE(verticesCount == objDB.getVerticesCount());
+        REQUIRE(facesCount == objDB.getFacesCount());
+        REQUIRE(areVerticesEqual == true);
+        REQUIRE(std::equal(indices.cbegin(),
+                           indices.cend(),
+                           objDB.getIndexBuffer().cbegin(),
+                           objDB.getIndexBuffer().cend()));
+    }
+    SECTION("groups and negative indices should go on across the batches")
+    {
+        std::string objText = "mtllib missing.mtl\ng cube side\nusemtl paint\n";
+        for (size_t vtxIdx = 0; vtxIdx < 40; ++vtxIdx)
+        {
+            objText += "v " + std::to_string(vtxIdx) + " 0 0\nf -1 -1 -1\n";
+        }
+        objText += "s 2\nf 1 2 3\n";
+
+        ObjMemoryStreamReader memoryReader(objText);
+        ObjLazyParser lazyParser(memoryReader, 16);
+
+        size_t batchesCount = 0, groupedFacesCount = 0;
+        std::vector<size_t> firstIndices;
+        while (lazyParser.parseNextBatch() == true)
+        {
+            const ObjDatabase& batch = lazyParser.getBatch();
+            ++batchesCount;
+
+            REQUIRE(batch.getEntitiesCount() <= 16 + 3);
+            REQUIRE(batch.getMaterialName(0) == "paint");
+
+            for (auto faceItr = batch.cbegin<ElementType::FACE>();
+                 faceItr != batch.cend<ElementType::FACE>();
+                 ++faceItr)
+            {
+                firstIndices.push_back(*batch.getVerticesIterators(*faceItr).first);
+            }
+
+            for (auto grpItr = batch.cbegin<ElementType::GROUP_NAME>();
+                 grpItr != batch.cend<ElementType::GROUP_NAME>();
+                 ++grpItr)
+            {
+                if ((grpItr->getGroupName().has_value() == true) &&
+                    (grpItr->getGroupName()->get() == "side"))
+                {
+                    groupedFacesCount += batch.getFacesInGroup(*grpItr).size();
+                }
+            }
+        }
+
+        // Each face references the vertex before it, even in a previous batch.
+        std::vector<size_t> expectedIndices(40);
+        std::iota(expectedIndices.begin(), expectedIndices.end(), 1);
+        expectedIndices.push_back(1);
+
+        REQUIRE(batchesCount > 2);
+        REQUIRE(firstIndices == expectedIndices);
+        REQUIRE(groupedFacesCount == 41);
+        REQUIRE(lazyParser.parseNextBatch() == false);
+    }
+    SECTION("batches smaller than the active groups should still parse the text")
+    {
+        const std::string objText = "g a b\ns 1\nv 0 0 0\nv 1 0 0\nv 1 1 0\nf 1 2 3\nf 3 2 1\n";
+        ObjMemoryStreamReader memoryReader(objText);
+        ObjLazyParser lazyParser(memoryReader, 1);
+
+        size_t batchesCount = 0, verticesCount = 0, facesCount = 0;
+        while ((lazyParser.parseNextBatch() == true) && (batchesCount < 100))
+        {
+            ++batchesCount;
+            verticesCount += lazyParser.getBatch().getVerticesCount();
+            facesCount += lazyParser.getBatch().getFacesCount();
+        }
+
+        REQUIRE(batchesCount < 100);
+        REQUIRE(verticesCount == 3);
+        REQUIRE(facesCount == 2);
+    }
+    SECTION("iterating again should resume the parsing")
+    {
+        const std::string objText = "v 0 0 0\nv 1 0 0\nv 1 1 0\nf 1 2 3\nf 3 2 1\nf 1 3 2\n";
+        ObjMemoryStreamReader memoryReader(objText);
+        ObjLazyParser lazyParser(memoryReader, 2);
+
+        size_t verticesCount = 0;
+        for (const ObjDatabase& batch : lazyParser)
+        {
+            verticesCount += batch.getVerticesCount();
+            break;
+        }
+
+        size_t facesCount = 0;
+        for (const ObjDatabase& batch : lazyParser)
+        {
+            verticesCount += batch.getVerticesCount();
+            facesCount += batch.getFacesCount();
+        }
+
+        REQUIRE(verticesCount == 3);
+        REQUIRE(facesCount == 3);
+    }
+}
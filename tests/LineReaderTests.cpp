@@ -0,0 +1,188 @@
+// =============================================================================
+// Copyright (c) 2017 Othmane AIT EL CADI
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+
+/*
+ * \file      LineReaderTests.cpp
+ *
+ * \author    Othmane AIT EL CADI - dartzon@gmail.com
+ * \date      18-10-2026
+ */
+
+#include "LineReader.h"
+#include "MtlFileParser.h"
+#include "ObjFileParser.h"
+
+#include "catch.h"
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+/// \brief  Read all the lines of a text with a given block size.
+std::vector<std::string> readLines(const std::string& text, const size_t blockSize)
+{
+    const std::unique_ptr<std::FILE, decltype(&fclose)> smtFile(std::tmpfile(), &fclose);
+    std::fwrite(text.data(), 1, text.size(), smtFile.get());
+    std::rewind(smtFile.get());
+
+    std::vector<std::string> lines;
+    ObjFileStreamReader fileReader(smtFile.get());
+    ObjUtils::LineReader lineReader(fileReader, blockSize);
+    for (std::optional<std::string_view> oneLine = lineReader.readLine();
+         oneLine.has_value() == true; oneLine = lineReader.readLine())
+    {
+        lines.emplace_back(*oneLine);
+    }
+
+    REQUIRE(lineReader.getReadBytesCount() == text.size());
+
+    return lines;
+}
+
+/// \brief  Return a text filling one block of the line reader, starting with digits: the reader's
+///         buffer still holds them after the lines of the next block.
+std::string getFirstBlock(const std::string& lines, const size_t blockSize = 64 * 1024)
+{
+    const std::string header = "# 0123456789\n" + lines;
+
+    return header + '#' + std::string(blockSize - header.size() - 2, ' ') + '\n';
+}
+
+}  // namespace
+
+TEST_CASE("Reading logical lines", "[linereader]")
+{
+    SECTION("lines should be split on their end of line, blank lines included")
+    {
+        const std::vector<std::string> lines = readLines("v 1 2 3\n\nf 1 2 3\r\nlast", 4);
+
+        REQUIRE(lines == std::vector<std::string>{"v 1 2 3", "", "f 1 2 3\r", "last"});
+    }
+    SECTION("lines longer than the blocks should be read whole")
+    {
+        const std::string longLine(10'000, 'x');
+        const std::vector<std::string> lines = readLines("a\n" + longLine + "\nb\n", 16);
+
+        REQUIRE(lines == std::vector<std::string>{"a", longLine, "b"});
+    }
+    SECTION("continued lines should be joined, other backslashes kept")
+    {
+        const std::vector<std::string> lines =
+            readLines("f 1 \\\n2 \\ \r\n3\nmtllib dir\\a.mtl\nend \\", 8);
+
+        REQUIRE(lines == std::vector<std::string>{"f 1   2     3", "mtllib dir\\a.mtl", "end  "});
+    }
+}
+
+TEST_CASE("Parsing long Obj lines", "[linereader]")
+{
+    namespace fs = std::filesystem;
+
+    const size_t polygonSize = 5000;
+    const fs::path objFilePath = fs::temp_directory_path() / "long_lines_tests.obj";
+    {
+        std::ofstream objFile(objFilePath);
+        for (size_t vtxIdx = 0; vtxIdx < polygonSize; ++vtxIdx)
+        {
+            objFile << "v " << vtxIdx << " 0.5 " << vtxIdx % 7 << '\n';
+        }
+
+        // One polygon on a single line, then the same one continued after each vertex.
+        objFile << 'f';
+        for (size_t vtxIdx = 1; vtxIdx <= polygonSize; ++vtxIdx)
+        {
+            objFile << ' ' << vtxIdx;
+        }
+        objFile << "\nf";
+        for (size_t vtxIdx = 1; vtxIdx <= polygonSize; ++vtxIdx)
+        {
+            objFile << ' ' << vtxIdx << " \\\n";
+        }
+        objFile << '\n';
+    }
+
+    ObjFileParser fp(objFilePath.string());
+    const ObjDatabase objDB = fp.parseFile();
+    fs::remove(objFilePath);
+
+    REQUIRE(objDB.getVerticesCount() == polygonSize);
+    REQUIRE(objDB.getFacesCount() == 2);
+    std::for_each(cbegin<ElementType::FACE>(objDB),
+                  cend<ElementType::FACE>(objDB),
+                  [&objDB, polygonSize](const ObjEntityFace& face) {
+                      const auto [idxItr, idxEnd] = objDB.getVerticesIterators(face);
+                      REQUIRE(static_cast<size_t>(std::distance(idxItr, idxEnd)) == polygonSize);
+                  });
+}
+
+TEST_CASE("Parsing numbers ending at a block boundary", "[linereader]")
+{
+    // The last line starts a block and isn't terminated: the previous block's digits follow it in
+    // the reader's buffer.
+    SECTION("vertices' coordinates should end with their line")
+    {
+        const ObjDatabase objDB = ObjFileParser().parseBuffer(getFirstBlock("") + "v 4 5 6");
+
+        REQUIRE(objDB.getVerticesCount() == 1);
+        const Vertex_t& vtx = *cbegin<ElementType::VERTEX>(objDB);
+        REQUIRE(vtx.m_x == 4.0f);
+        REQUIRE(vtx.m_y == 5.0f);
+        REQUIRE(vtx.m_z == 6.0f);
+    }
+    SECTION("faces' indices should end with their line")
+    {
+        const ObjDatabase objDB = ObjFileParser().parseBuffer(getFirstBlock("v 1 2 3\n") +
+                                                              "f 1 1 1");
+
+        REQUIRE(objDB.getFacesCount() == 1);
+        const auto [idxItr, idxEnd] = objDB.getVerticesIterators(*cbegin<ElementType::FACE>(objDB));
+        REQUIRE(std::all_of(idxItr, idxEnd, [](const auto vtxIdx) { return (vtxIdx == 1); }));
+    }
+    SECTION("a line ending the reader's buffer should be read up to its end only")
+    {
+        std::string text = getFirstBlock("");
+        text.resize(text.size() - 8);
+        text += "\nv 4 5 6";
+
+        const ObjDatabase objDB = ObjFileParser().parseBuffer(text);
+
+        REQUIRE(objDB.getVerticesCount() == 1);
+        REQUIRE(cbegin<ElementType::VERTEX>(objDB)->m_z == 6.0f);
+    }
+    SECTION("materials' numbers should end with their line")
+    {
+        namespace fs = std::filesystem;
+
+        const fs::path mtlFilePath = fs::temp_directory_path() / "block_boundary_tests.mtl";
+        std::ofstream(mtlFilePath) << getFirstBlock("newmtl boundary\n") << "Ns 5";
+
+        const ObjMaterialLibrary mtlLibrary = MtlFileParser(mtlFilePath.string()).parseFile();
+        fs::remove(mtlFilePath);
+
+        REQUIRE(mtlLibrary.getMaterialsCount() == 1);
+        REQUIRE(mtlLibrary.getMaterial(0).getColors().m_specularExponent == 5.0f);
+    }
+}
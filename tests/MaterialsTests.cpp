@@ -0,0 +1,309 @@
+// =============================================================================
+// Copyright (c) 2017 Othmane AIT EL CADI
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+
+/*
+ * \file      MaterialsTests.cpp
+ *
+ * \author    Othmane AIT EL CADI - dartzon@gmail.com
+ * \date      18-10-2026
+ */
+
+#include "MtlFileParser.h"
+#include "MtlLibraryCache.h"
+#include "ObjDatabase.h"
+#include "ObjFileParser.h"
+#include "ObjFileWriter.h"
+#include "ObjRenderMesh.h"
+#include "ObjTextureLoader.h"
+
+#include "catch.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <future>
+#include <memory>
+
+TEST_CASE("Parsing a Mtl file", "[materials]")
+{
+    const ObjMaterialLibrary mtlLibrary = MtlFileParser("tests/models/vp.mtl").parseFile();
+
+    SECTION("every newmtl statement should create one material")
+    {
+        REQUIRE(mtlLibrary.isEmpty() == false);
+        REQUIRE(mtlLibrary.getMaterial(0).getName() == "white");
+        REQUIRE(mtlLibrary.getMaterial(1).getName() == "red");
+        REQUIRE(mtlLibrary.findMaterial("blue_pure").has_value() == true);
+        REQUIRE(mtlLibrary.findMaterial("no_such_material").has_value() == false);
+    }
+    SECTION("colors and illumination should be read")
+    {
+        const ObjMaterial::ColorAndIllumination& colors =
+            mtlLibrary.findMaterial("red")->get().getColors();
+
+        REQUIRE(colors.m_diffuse.m_r == Approx(0.7714f));
+        REQUIRE(colors.m_diffuse.m_g == 0.0f);
+        REQUIRE(colors.m_ambient.m_r == Approx(0.4449f));
+        REQUIRE(colors.m_specularExponent == Approx(136.43f));
+        REQUIRE(colors.m_illuminationModel == 2);
+    }
+}
+
+TEST_CASE("Texture maps", "[materials]")
+{
+    const ObjMaterialLibrary mtlLibrary = MtlFileParser("tests/models/cube.mtl").parseFile();
+    REQUIRE(mtlLibrary.getMaterialsCount() == 1);
+
+    const ObjMaterial& material = mtlLibrary.getMaterial(0);
+
+    SECTION("the options should be separated from the texture file")
+    {
+        const auto diffuseMap = material.getTextureMap(ObjMaterial::TextureMapType::DIFFUSE);
+        REQUIRE(diffuseMap.has_value() == true);
+        REQUIRE(diffuseMap->get().m_filePath == "cube.png");
+        REQUIRE(diffuseMap->get().m_options == "-s 1 1 1 -bm 0.5");
+    }
+    SECTION("missing texture maps should not be returned")
+    {
+        REQUIRE(material.getTextureMap(ObjMaterial::TextureMapType::BUMP).has_value() == false);
+    }
+}
+
+TEST_CASE("Faces materials", "[materials]")
+{
+    SECTION("usemtl should bind the faces to the materials of the mtllib files")
+    {
+        ObjFileParser fp(std::string("tests/models/cube.obj"));
+        const ObjDatabase objDB = fp.parseFile();
+
+        REQUIRE(objDB.getMaterialLibrariesRefs().size() == 1);
+        REQUIRE(objDB.getMaterialLibraries().front() != nullptr);
+        REQUIRE(objDB.getMaterialsCount() == 1);
+        REQUIRE(std::all_of(cbegin<ElementType::FACE>(objDB),
+                            cend<ElementType::FACE>(objDB),
+                            [&objDB](const ObjEntityFace& face) {
+                                const auto material = objDB.getFaceMaterial(face);
+                                return (face.getMaterialID() == 0) &&
+                                       (material.has_value() == true) &&
+                                       (material->get().getName() == "cube");
+                            }));
+    }
+    SECTION("materials without library should only have a name")
+    {
+        ObjFileParser fp(std::string("tests/models/ducky.obj"));
+        const ObjDatabase objDB = fp.parseFile();
+
+        REQUIRE(objDB.getMaterialLibraries().empty() == true);
+        REQUIRE(objDB.getMaterialsCount() == 4);
+        REQUIRE(objDB.getMaterialName(1) == "DBill");
+        REQUIRE(objDB.getMaterial(1).has_value() == false);
+        REQUIRE(objDB.getMaterialName(NO_MATERIAL_ID).empty() == true);
+    }
+    SECTION("the Obj file writer should write the mtllib and usemtl statements")
+    {
+        ObjFileParser fp(std::string("tests/models/ducky.obj"));
+        const ObjDatabase objDB = fp.parseFile();
+
+        const char* pObjFilePath = "ducky_materials_tests.obj";
+        REQUIRE(ObjFileWriter(objDB).writeFile(pObjFilePath) == true);
+
+        ObjFileParser rtFp(std::string{pObjFilePath});
+        const ObjDatabase rtObjDB = rtFp.parseFile();
+        std::remove(pObjFilePath);
+
+        REQUIRE(rtObjDB.getMaterialsCount() == objDB.getMaterialsCount());
+        REQUIRE(std::equal(cbegin<ElementType::FACE>(objDB),
+                           cend<ElementType::FACE>(objDB),
+                           cbegin<ElementType::FACE>(rtObjDB),
+                           cend<ElementType::FACE>(rtObjDB),
+                           [](const ObjEntityFace& face, const ObjEntityFace& rtFace) {
+                               return (face.getMaterialID() == rtFace.getMaterialID());
+                           }));
+    }
+}
+
+TEST_CASE("Faces batches by material", "[materials]")
+{
+    const char* pObjFilePath = "batches_tests.obj";
+    {
+        const std::unique_ptr<std::FILE, decltype(&fclose)> smtObjFile(fopen(pObjFilePath, "w"),
+                                                                       &fclose);
+        REQUIRE(smtObjFile != nullptr);
+        fputs("v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\n"
+              "g a\nusemtl m1\nf 1 2 3\nusemtl m2\nf 1 3 4\n"
+              "g b\nusemtl m1\nf 1 2 4\nusemtl\nf 2 3 4\n",
+              smtObjFile.get());
+    }
+
+    ObjFileParser fp(std::string{pObjFilePath});
+    const ObjDatabase objDB = fp.parseFile();
+    std::remove(pObjFilePath);
+
+    SECTION("each material should be one contiguous range of faces")
+    {
+        const ObjDatabase::FacesBatches facesBatches = objDB.getFacesBatches();
+
+        REQUIRE(facesBatches.m_sortedFaces == std::vector<uint32_t>{0, 2, 1, 3});
+        REQUIRE(facesBatches.m_batches.size() == 3);
+        REQUIRE(objDB.getMaterialName(facesBatches.m_batches[0].m_materialID) == "m1");
+        REQUIRE(facesBatches.m_batches[0].m_facesCount == 2);
+        REQUIRE(objDB.getMaterialName(facesBatches.m_batches[1].m_materialID) == "m2");
+        REQUIRE(facesBatches.m_batches[2].m_materialID == NO_MATERIAL_ID);
+        REQUIRE(facesBatches.m_batches[2].m_firstFace == 3);
+    }
+    SECTION("sorting by group should split the materials' ranges")
+    {
+        const ObjDatabase::FacesBatches facesBatches = objDB.getFacesBatches(true);
+
+        REQUIRE(facesBatches.m_sortedFaces == std::vector<uint32_t>{0, 2, 1, 3});
+        REQUIRE(facesBatches.m_batches.size() == 4);
+        REQUIRE(facesBatches.m_batches[0].m_groupName == "a");
+        REQUIRE(facesBatches.m_batches[1].m_groupName == "b");
+        REQUIRE(facesBatches.m_batches[1].m_materialID == facesBatches.m_batches[0].m_materialID);
+        REQUIRE(facesBatches.m_batches[2].m_groupName == "a");
+        REQUIRE(facesBatches.m_batches[3].m_groupName == "b");
+    }
+    SECTION("the render mesh should have one sub-mesh per batch")
+    {
+        const ObjRenderMesh renderMesh(objDB);
+
+        REQUIRE(renderMesh.getSubMeshes().size() == 4);
+        REQUIRE(renderMesh.getMaterialsRanges().size() == 3);
+        REQUIRE(renderMesh.getMaterialsRanges()[0].m_materialName == "m1");
+        REQUIRE(renderMesh.getMaterialsRanges()[0].m_indicesCount == 6);
+        REQUIRE(renderMesh.getMaterialsRanges()[0].m_subMeshesCount == 2);
+        REQUIRE(renderMesh.getMaterialsRanges()[2].m_firstIndex == 9);
+    }
+}
+
+TEST_CASE("Material libraries cache", "[materials]")
+{
+    namespace fs = std::filesystem;
+
+    MtlLibraryCache& cache = MtlLibraryCache::getInstance();
+
+    SECTION("Obj files referencing the same library should share it")
+    {
+        ObjFileParser fp(std::string("tests/models/cube.obj"));
+        const ObjDatabase objDB = fp.parseFile();
+        ObjFileParser otherFp(std::string("tests/models/cube.obj"));
+        const ObjDatabase otherObjDB = otherFp.parseFile();
+
+        REQUIRE(objDB.getMaterialLibraries().front() != nullptr);
+        REQUIRE(objDB.getMaterialLibraries().front() == otherObjDB.getMaterialLibraries().front());
+    }
+    SECTION("concurrent loads should parse the library once")
+    {
+        cache.clear();
+
+        std::vector<std::future<std::shared_ptr<const ObjMaterialLibrary>>> loads;
+        for (size_t loadIdx = 0; loadIdx < 4; ++loadIdx)
+        {
+            loads.push_back(std::async(std::launch::async, [&cache]() {
+                return cache.getLibrary("tests/models/vp.mtl");
+            }));
+        }
+
+        const std::shared_ptr<const ObjMaterialLibrary> pLibrary = loads.front().get();
+        REQUIRE(pLibrary != nullptr);
+        for (size_t loadIdx = 1; loadIdx < loads.size(); ++loadIdx)
+        {
+            REQUIRE(loads[loadIdx].get() == pLibrary);
+        }
+        REQUIRE(cache.getLibrariesCount() == 1);
+    }
+    SECTION("a modified library should be parsed again")
+    {
+        const fs::path mtlFilePath = fs::temp_directory_path() / "cache_tests.mtl";
+        fs::copy_file("tests/models/cube.mtl", mtlFilePath, fs::copy_options::overwrite_existing);
+
+        const std::shared_ptr<const ObjMaterialLibrary> pLibrary = cache.getLibrary(mtlFilePath);
+        REQUIRE(cache.getLibrary(mtlFilePath) == pLibrary);
+
+        fs::last_write_time(mtlFilePath, fs::last_write_time(mtlFilePath) + std::chrono::hours(1));
+        const std::shared_ptr<const ObjMaterialLibrary> pNewLibrary = cache.getLibrary(mtlFilePath);
+        fs::remove(mtlFilePath);
+
+        REQUIRE(pNewLibrary != pLibrary);
+        REQUIRE(pNewLibrary->getMaterialsCount() == pLibrary->getMaterialsCount());
+    }
+    SECTION("missing libraries should not be cached")
+    {
+        REQUIRE(cache.getLibrary("tests/models/no_such_library.mtl") == nullptr);
+    }
+}
+
+TEST_CASE("Textures references", "[materials]")
+{
+    namespace fs = std::filesystem;
+
+    SECTION("textures should be resolved from the Mtl file's directory")
+    {
+        const ObjMaterialLibrary mtlLibrary =
+            MtlFileParser("tests/models/LCAC/LCAC-27.mtl").parseFile();
+        REQUIRE(mtlLibrary.getTexturesCount() > 0);
+
+        for (size_t textureIdx = 0; textureIdx < mtlLibrary.getTexturesCount(); ++textureIdx)
+        {
+            const ObjMaterialLibrary::TextureReference& texture =
+                mtlLibrary.getTextureReference(textureIdx);
+
+            REQUIRE(texture.m_exists == true);
+            REQUIRE(texture.m_canonicalPath.is_absolute() == true);
+            REQUIRE(texture.m_fileSize == fs::file_size(texture.m_canonicalPath));
+        }
+    }
+    SECTION("absolute Windows paths should fall back to the Mtl file's directory")
+    {
+        const ObjMaterialLibrary mtlLibrary =
+            MtlFileParser("tests/models/Bell407/bell407-1.mtl").parseFile();
+
+        const auto textureItr = std::find_if(
+            mtlLibrary.cbegin(), mtlLibrary.cend(), [](const ObjMaterial& material) {
+                return material.getTextureMap(ObjMaterial::TextureMapType::DIFFUSE).has_value();
+            });
+        REQUIRE(textureItr != mtlLibrary.cend());
+
+        const ObjMaterial::TextureMap& textureMap =
+            textureItr->getTextureMap(ObjMaterial::TextureMapType::DIFFUSE)->get();
+        REQUIRE(textureMap.m_filePath.find('\\') != std::string::npos);
+
+        const ObjMaterialLibrary::TextureReference& texture =
+            mtlLibrary.getTextureReference(textureMap.m_textureIdx);
+        REQUIRE(texture.m_exists == true);
+        REQUIRE(texture.m_canonicalPath.parent_path() == fs::canonical("tests/models/Bell407"));
+    }
+    SECTION("textures should be loaded once, on demand")
+    {
+        const ObjMaterialLibrary mtlLibrary = MtlFileParser("tests/models/cube.mtl").parseFile();
+        const ObjMaterialLibrary::TextureReference& texture = mtlLibrary.getTextureReference(0);
+
+        ObjTextureLoader textureLoader;
+        const auto textureData = textureLoader.requestTexture(texture);
+        REQUIRE(textureLoader.requestTexture(texture).get() == textureData.get());
+        REQUIRE(textureData.get() != nullptr);
+        REQUIRE(textureData.get()->size() == texture.m_fileSize);
+
+        const ObjMaterialLibrary::TextureReference missingTexture;
+        REQUIRE(textureLoader.requestTexture(missingTexture).get() == nullptr);
+    }
+}
@@ -0,0 +1,130 @@
+// =============================================================================
+// Copyright (c) 2017 Othmane AIT EL CADI
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+
+/*
+ * \file      MemoryParsingTests.cpp
+ *
+ * \author    Othmane AIT EL CADI - dartzon@gmail.com
+ * \date      18-10-2026
+ */
+
+#include "ObjFileParser.h"
+
+#include "catch.h"
+
+#include <fstream>
+#include <sstream>
+
+namespace
+{
+/// \brief  Reader handing the text out by small chunks, as a network stream would.
+class ChunksReader final : public ObjStreamReader
+{
+public:
+    ChunksReader(std::string_view text, const size_t chunkSize) :
+        m_text(text), m_chunkSize(chunkSize)
+    {
+    }
+
+    size_t read(char* pBuffer, const size_t size) override
+    {
+        const size_t readSize = std::min({size, m_chunkSize, m_text.size()});
+        std::copy_n(m_text.data(), readSize, pBuffer);
+        m_text.remove_prefix(readSize);
+
+        return readSize;
+    }
+
+private:
+    std::string_view m_text;
+    const size_t m_chunkSize;
+};
+
+/// \brief  Return true if two databases have the same faces indices and materials.
+bool haveSameFaces(const ObjDatabase& objDB, const ObjDatabase& otherObjDB)
+{
+    return std::equal(cbegin<ElementType::FACE>(objDB),
+                      cend<ElementType::FACE>(objDB),
+                      cbegin<ElementType::FACE>(otherObjDB),
+                      cend<ElementType::FACE>(otherObjDB),
+                      [&](const ObjEntityFace& face, const ObjEntityFace& otherFace) {
+                          const auto [idxItr, idxEnd] = objDB.getVerticesIterators(face);
+                          const auto [otherIdxItr, otherIdxEnd] =
+                              otherObjDB.getVerticesIterators(otherFace);
+                          return std::equal(idxItr, idxEnd, otherIdxItr, otherIdxEnd) &&
+                                 (face.getMaterialID() == otherFace.getMaterialID());
+                      });
+}
+
+}  // namespace
+
+TEST_CASE("Parsing in-memory Obj texts", "[memory]")
+{
+    const std::string objFilePath = "tests/models/cube.obj";
+
+    std::ostringstream objText;
+    objText << std::ifstream(objFilePath).rdbuf();
+    const std::string text = objText.str();
+
+    ObjFileParser fileFp(objFilePath);
+    const ObjDatabase fileObjDB = fileFp.parseFile();
+
+    SECTION("a text buffer should give the same database as its file")
+    {
+        ObjFileParser fp(objFilePath);
+        const ObjDatabase objDB = fp.parseBuffer(text);
+
+        REQUIRE(objDB.getVerticesCount() == fileObjDB.getVerticesCount());
+        REQUIRE(haveSameFaces(objDB, fileObjDB) == true);
+        REQUIRE(objDB.getMaterialLibraries().front() != nullptr);
+    }
+    SECTION("a bytes buffer should give the same database as its file")
+    {
+        ObjFileParser fp(objFilePath);
+        const ObjDatabase objDB =
+            fp.parseBuffer(reinterpret_cast<const std::byte*>(text.data()), text.size());
+
+        REQUIRE(haveSameFaces(objDB, fileObjDB) == true);
+    }
+    SECTION("a stream read by small chunks should give the same database as its file")
+    {
+        ChunksReader reader(text, 7);
+        ParseStats stats;
+
+        ObjFileParser fp(objFilePath);
+        const ObjDatabase objDB = fp.parseStream(reader, stats);
+
+        REQUIRE(haveSameFaces(objDB, fileObjDB) == true);
+        REQUIRE(stats.m_bytesCount == text.size());
+    }
+    SECTION("texts without Obj file should find their material libraries from the current "
+            "directory")
+    {
+        ObjFileParser fp;
+        const ObjDatabase objDB = fp.parseBuffer(text);
+
+        REQUIRE(haveSameFaces(objDB, fileObjDB) == true);
+        REQUIRE(objDB.getMaterialsCount() == 1);
+        REQUIRE(objDB.getMaterialLibraries().front() == nullptr);
+    }
+}
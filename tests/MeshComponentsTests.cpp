@@ -0,0 +1,122 @@
+// =============================================================================
+// Copyright (c) 2017 Othmane AIT EL CADI
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+
+/*
+ * \file      MeshComponentsTests.cpp
+ *
+ * \author    Othmane AIT EL CADI - dartzon@gmail.com
+ * \date      18-10-2026
+ */
+
+#include "ObjFileParser.h"
+#include "ObjMeshComponents.h"
+
+#include "catch.h"
+
+#include <string_view>
+#include <vector>
+
+namespace
+{
+/// \brief  Return the types of the entities included in a group, in their order.
+std::vector<ElementType> getGroupEntitiesTypes(const ObjDatabase& objDB, const size_t grpID)
+{
+    std::vector<ElementType> types;
+    for (const ObjEntity& entity : objDB.getEntitiesInGroup(objDB.getGroup(grpID)->get()))
+    {
+        types.push_back(entity.getType());
+    }
+
+    return types;
+}
+
+}  // namespace
+
+TEST_CASE("Connected components of the faces", "[components]")
+{
+    SECTION("disjoint components should get their own groups and databases")
+    {
+        ObjDatabase objDB = ObjFileParser().parseBuffer("v 0 0 0\nv 1 0 0\nv 0 1 0\n"
+                                                        "v 5 5 5\nv 6 5 5\nv 5 6 5\n"
+                                                        "f 1 2 3\nf 4 5 6\nf 3 2 1\n");
+
+        const ObjMeshComponents components(objDB);
+        REQUIRE(components.getComponentsCount() == 2);
+        REQUIRE(components.getFacesComponents() == std::vector<uint32_t>{0, 1, 0});
+        REQUIRE(components.getComponentFacesCount(0) == 2);
+        REQUIRE(components.getComponentFacesCount(1) == 1);
+
+        const std::vector<size_t> groupsIDs = components.createComponentsGroups(objDB);
+        REQUIRE(groupsIDs.size() == 2);
+
+        // The first component's faces are split by the second one's.
+        REQUIRE(objDB.getGroup(groupsIDs[0])->get().getIncludedEntityRangesCount() == 2);
+        REQUIRE(getGroupEntitiesTypes(objDB, groupsIDs[0]) ==
+                std::vector<ElementType>{ElementType::FACE, ElementType::FACE});
+        REQUIRE(getGroupEntitiesTypes(objDB, groupsIDs[1]) ==
+                std::vector<ElementType>{ElementType::FACE});
+
+        const std::vector<ObjDatabase> componentsDBs = components.splitComponents(objDB);
+        REQUIRE(componentsDBs.size() == 2);
+        REQUIRE(componentsDBs[0].getFacesCount() == 2);
+        REQUIRE(componentsDBs[0].getVerticesCount() == 3);
+        REQUIRE(componentsDBs[1].getFacesCount() == 1);
+        REQUIRE(componentsDBs[1].getVerticesCount() == 3);
+    }
+    SECTION("faces split by other entities should be in ranges of faces only")
+    {
+        ObjDatabase objDB = ObjFileParser().parseBuffer("v 0 0 0\nv 1 0 0\nv 0 1 0\nv 1 1 0\n"
+                                                        "f 1 2 3\n"
+                                                        "v 9 9 9\n"
+                                                        "g other\n"
+                                                        "f 2 4 3\n");
+
+        const ObjMeshComponents components(objDB);
+        REQUIRE(components.getComponentsCount() == 1);
+
+        const std::vector<size_t> groupsIDs = components.createComponentsGroups(objDB);
+        REQUIRE(groupsIDs.size() == 1);
+        REQUIRE(objDB.getGroup(groupsIDs[0])->get().getIncludedEntityRangesCount() == 2);
+        REQUIRE(getGroupEntitiesTypes(objDB, groupsIDs[0]) ==
+                std::vector<ElementType>{ElementType::FACE, ElementType::FACE});
+    }
+    SECTION("a single face should be one component")
+    {
+        ObjDatabase objDB = ObjFileParser().parseBuffer("v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 3\n");
+
+        const ObjMeshComponents components(objDB);
+        REQUIRE(components.getComponentsCount() == 1);
+        REQUIRE(components.getFaceComponent(0) == 0);
+
+        const std::vector<size_t> groupsIDs = components.createComponentsGroups(objDB);
+        REQUIRE(groupsIDs.size() == 1);
+        REQUIRE(objDB.getGroup(groupsIDs[0])->get().getIncludedEntityRangesCount() == 1);
+        REQUIRE(getGroupEntitiesTypes(objDB, groupsIDs[0]) ==
+                std::vector<ElementType>{ElementType::FACE});
+
+        const std::vector<ObjDatabase> componentsDBs = components.splitComponents(objDB);
+        REQUIRE(componentsDBs.size() == 1);
+        REQUIRE(componentsDBs[0].getFacesCount() == 1);
+        REQUIRE(componentsDBs[0].getIndexBuffer() == objDB.getIndexBuffer());
+    }
+}
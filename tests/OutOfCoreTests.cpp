@@ -0,0 +1,135 @@
+// =============================================================================
+// Copyright (c) 2017 Othmane AIT EL CADI
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+
+/*
+ * \file      OutOfCoreTests.cpp
+ *
+ * \author    Othmane AIT EL CADI - dartzon@gmail.com
+ * \date      18-10-2026
+ */
+
+#include "ObjFileParser.h"
+#include "ObjMappedMemoryResource.h"
+
+#include "catch.h"
+
+#include <algorithm>
+#include <filesystem>
+
+TEST_CASE("Obj databases held in memory-mapped files", "[outofcore]")
+{
+    const std::string objFilePath = "tests/models/ducky.obj";
+
+    ObjFileParser heapFp(objFilePath);
+    const ObjDatabase heapDB = heapFp.parseFile();
+
+    SECTION("buffers beyond the budget should be mapped, and give the same database")
+    {
+        auto spMemory = std::make_shared<ObjMappedMemoryResource>(0);
+        {
+            ObjFileParser fp(objFilePath, spMemory);
+            const ObjDatabase objDB = fp.parseFile();
+
+            REQUIRE(spMemory->getHeapBytesCount() == 0);
+            REQUIRE(spMemory->getMappingsCount() > 0);
+
+            REQUIRE(objDB.getVerticesCount() == heapDB.getVerticesCount());
+            REQUIRE(objDB.getFacesCount() == heapDB.getFacesCount());
+            REQUIRE(objDB.getIndexBufferCount() == heapDB.getIndexBufferCount());
+            REQUIRE(std::equal(objDB.cbegin<ElementType::VERTEX>(),
+                               objDB.cend<ElementType::VERTEX>(),
+                               heapDB.cbegin<ElementType::VERTEX>(),
+                               [](const ObjEntityVertex& vtx, const ObjEntityVertex& heapVtx) {
+                                   const auto [x, y, z, w] = vtx;
+                                   const auto [heapX, heapY, heapZ, heapW] = heapVtx;
+                                   return (x == heapX) && (y == heapY) && (z == heapZ);
+                               }));
+
+            // Released pages are read back from the files.
+            spMemory->releaseResidentPages();
+            bool areIndicesEqual = true;
+            for (auto faceItr = objDB.cbegin<ElementType::FACE>(),
+                      heapFaceItr = heapDB.cbegin<ElementType::FACE>();
+                 faceItr != objDB.cend<ElementType::FACE>();
+                 ++faceItr, ++heapFaceItr)
+            {
+                const auto [first, last] = objDB.getVerticesIterators(*faceItr);
+                const auto [heapFirst, heapLast] = heapDB.getVerticesIterators(*heapFaceItr);
+                areIndicesEqual = areIndicesEqual && std::equal(first, last, heapFirst, heapLast);
+            }
+            REQUIRE(areIndicesEqual == true);
+        }
+
+        REQUIRE(spMemory->getMappingsCount() == 0);
+        REQUIRE(spMemory->getMappedBytesCount() == 0);
+    }
+    SECTION("mapped buffers should be allocated once, at their estimated size")
+    {
+        auto spMemory = std::make_shared<ObjMappedMemoryResource>(0);
+        ObjFileParser fp(objFilePath, spMemory);
+        const ObjDatabase objDB = fp.parseFile();
+
+        // No buffer was grown into a new mapping, the groups and the entities table included.
+        REQUIRE(spMemory->getPeakMappedBytesCount() == spMemory->getMappedBytesCount());
+        REQUIRE(objDB.getEntitiesTable().get_allocator().getMemoryResource() == spMemory);
+        REQUIRE(objDB.getEntitiesTable().size() == heapDB.getEntitiesTable().size());
+        REQUIRE(objDB.getGroupsCount() == heapDB.getGroupsCount());
+    }
+    SECTION("buffers within the budget should stay on the heap")
+    {
+        auto spMemory = std::make_shared<ObjMappedMemoryResource>(64 * 1024 * 1024);
+        ObjFileParser fp(objFilePath, spMemory);
+        const ObjDatabase objDB = fp.parseFile();
+
+        REQUIRE(spMemory->getMappingsCount() == 0);
+        REQUIRE(spMemory->getHeapBytesCount() > 0);
+        REQUIRE(objDB.getFacesCount() == heapDB.getFacesCount());
+    }
+    SECTION("moved databases should keep their memory resource alive")
+    {
+        auto spMemory = std::make_shared<ObjMappedMemoryResource>(0);
+        ObjDatabase objDB = ObjFileParser(objFilePath, spMemory).parseFile();
+        std::weak_ptr<ObjMappedMemoryResource> wpMemory = spMemory;
+        spMemory.reset();
+
+        ObjDatabase movedDB;
+        movedDB = std::move(objDB);
+
+        REQUIRE(wpMemory.expired() == false);
+        REQUIRE(movedDB.getFacesCount() == heapDB.getFacesCount());
+    }
+    SECTION("temporary files should be deleted as soon as mapped")
+    {
+        const std::filesystem::path tempDirectory = "tests/outofcore_tmp";
+        std::filesystem::create_directory(tempDirectory);
+        {
+            auto spMemory = std::make_shared<ObjMappedMemoryResource>(0, tempDirectory);
+            ObjFileParser fp(objFilePath, spMemory);
+            const ObjDatabase objDB = fp.parseFile();
+
+            REQUIRE(spMemory->getMappingsCount() > 0);
+            REQUIRE(std::filesystem::is_empty(tempDirectory) == true);
+        }
+        std::filesystem::remove_all(tempDirectory);
+    }
+}
@@ -0,0 +1,108 @@
+// =============================================================================
+// Copyright (c) 2017 Othmane AIT EL CADI
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+
+/*
+ * \file      ParseStatsTests.cpp
+ *
+ * \author    Othmane AIT EL CADI - dartzon@gmail.com
+ * \date      18-10-2026
+ */
+
+#include "ObjFileParser.h"
+#include "ParseStats.h"
+
+#include "catch.h"
+
+#include <stdexcept>
+
+TEST_CASE("Collecting the parsing stats", "[stats]")
+{
+    const std::string objFilePath = "tests/models/cube.obj";
+
+    ParseStats stats;
+    ObjFileParser fp(objFilePath);
+    const ObjDatabase objDB = fp.parseFile(stats);
+
+    SECTION("elements, lines and bytes should be counted")
+    {
+        REQUIRE(stats.m_filesCount == 1);
+        REQUIRE(stats.getElementsCount(ElementType::VERTEX) == 8);
+        REQUIRE(stats.getElementsCount(ElementType::VERTEX_TEXTURE) == 4);
+        REQUIRE(stats.getElementsCount(ElementType::VERTEX_NORMAL) == 6);
+        REQUIRE(stats.getElementsCount(ElementType::FACE) == objDB.getFacesCount());
+        REQUIRE(stats.getElementsCount(ElementType::MATERIAL_LIB) == 1);
+        REQUIRE(stats.m_bytesCount == std::filesystem::file_size(objFilePath));
+        REQUIRE(stats.m_linesCount > stats.getElementsCount(ElementType::FACE));
+    }
+    SECTION("the phases' times should add up to the total time")
+    {
+        REQUIRE(stats.getTotalTime().count() > 0);
+        REQUIRE(stats.getPhaseTime(ParsePhase::IO).count() > 0);
+        REQUIRE(stats.getPhaseTime(ParsePhase::FACE_PARSE).count() > 0);
+    }
+    SECTION("stats of several parsings should add up")
+    {
+        ParseStats totalStats;
+        totalStats += stats;
+        totalStats += stats;
+
+        REQUIRE(totalStats.m_filesCount == 2);
+        REQUIRE(totalStats.m_bytesCount == 2 * stats.m_bytesCount);
+        REQUIRE(totalStats.getElementsCount(ElementType::FACE) ==
+                2 * stats.getElementsCount(ElementType::FACE));
+        REQUIRE(totalStats.getTotalTime() == 2 * stats.getTotalTime());
+    }
+    SECTION("allocations should only be reported when the program counts them")
+    {
+#ifdef OBJ_COUNT_ALLOCATIONS
+        REQUIRE(stats.m_allocationsCount.has_value() == true);
+        REQUIRE(*stats.m_allocationsCount > 0);
+        REQUIRE(*stats.m_allocatedBytes > 0);
+#else
+        REQUIRE(stats.m_allocationsCount.has_value() == false);
+        REQUIRE(stats.m_allocatedBytes.has_value() == false);
+#endif
+    }
+    SECTION("a parser whose parsing threw should be reusable")
+    {
+        ParseStats failedStats;
+        ObjFileParser reusedFp(objFilePath);
+        ObjMemoryStreamReader malformedReader("v 1.0 2.0 3.0\nv one two three\n");
+        REQUIRE_THROWS_AS(reusedFp.parseStream(malformedReader, failedStats),
+                          std::invalid_argument);
+        REQUIRE(failedStats.m_filesCount == 0);
+
+        ParseStats reusedStats;
+        const ObjDatabase reusedDB = reusedFp.parseFile(reusedStats);
+        REQUIRE(reusedStats.m_filesCount == 1);
+        REQUIRE(reusedStats.getElementsCount(ElementType::VERTEX) == 8);
+        REQUIRE(reusedDB.getVerticesCount() == objDB.getVerticesCount());
+        REQUIRE(reusedDB.getFacesCount() == objDB.getFacesCount());
+        REQUIRE(reusedDB.getEntitiesCount() == objDB.getEntitiesCount());
+    }
+    SECTION("the uninstrumented parsing should give the same database")
+    {
+        ObjFileParser plainFp(objFilePath);
+        REQUIRE(plainFp.parseFile().getFacesCount() == objDB.getFacesCount());
+    }
+}
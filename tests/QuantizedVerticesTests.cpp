@@ -0,0 +1,341 @@
+// =============================================================================
+// Copyright (c) 2017 Othmane AIT EL CADI
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+
+/*
+ * \file      QuantizedVerticesTests.cpp
+ *
+ * \author    Othmane AIT EL CADI - dartzon@gmail.com
+ * \date      18-10-2026
+ */
+
+#include "ObjBinaryExporters.h"
+#include "ObjFileParser.h"
+#include "ObjFileWriter.h"
+#include "ObjQuantizedVertices.h"
+#include "ObjRenderMesh.h"
+#include "ObjSharedDatabase.h"
+
+#include "catch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+namespace
+{
+/// \brief  Return an Obj text of random vertices, texture vertices and normals.
+std::string makeRandomVerticesText(const size_t verticesCount)
+{
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<float> positions(-250.0f, 1000.0f);
+    std::uniform_real_distribution<float> texCoords(0.0f, 1.0f);
+    std::uniform_real_distribution<float> directions(-1.0f, 1.0f);
+
+    std::string objText;
+    for (size_t vtxIdx = 0; vtxIdx < verticesCount; ++vtxIdx)
+    {
+        objText += "v " + std::to_string(positions(generator)) + " " +
+                   std::to_string(positions(generator)) + " " +
+                   std::to_string(positions(generator) * 0.01f) + "\n";
+        objText += "vt " + std::to_string(texCoords(generator)) + " " +
+                   std::to_string(texCoords(generator)) + "\n";
+        objText += "vn " + std::to_string(directions(generator)) + " " +
+                   std::to_string(directions(generator)) + " " +
+                   std::to_string(directions(generator)) + "\n";
+    }
+
+    return objText;
+}
+
+/// \brief  Return true if the coordinates of two vertices differ by at most a tolerance.
+bool areVerticesNear(const float x, const float y, const float z, const ObjEntityVertex& vtx)
+{
+    constexpr float tolerance = 1.0e-3f;
+
+    return (std::fabs(x - vtx.m_x) <= tolerance) && (std::fabs(y - vtx.m_y) <= tolerance) &&
+           (std::fabs(z - vtx.m_z) <= tolerance);
+}
+
+/// \brief  Return true if the vertices of a quantized database are near the float ones.
+bool areDecodedVerticesNear(const ObjDatabase& quantizedDB, const ObjDatabase& objDB)
+{
+    bool areNear = true;
+    for (const ElementType type :
+         {ElementType::VERTEX, ElementType::VERTEX_TEXTURE, ElementType::VERTEX_NORMAL})
+    {
+        areNear = areNear && (quantizedDB.getVerticesCount(type) == objDB.getVerticesCount(type));
+        for (size_t vtxIdx = 0; (areNear == true) && (vtxIdx < objDB.getVerticesCount(type));
+             ++vtxIdx)
+        {
+            const auto [x, y, z, w] = *quantizedDB.getVertex(type, vtxIdx);
+            areNear = areVerticesNear(x, y, z, *objDB.getVertex(type, vtxIdx));
+        }
+    }
+
+    return areNear;
+}
+
+}  // namespace
+
+TEST_CASE("Quantized vertices attributes", "[quantized]")
+{
+    SECTION("decoded attributes should be within half a quantization step")
+    {
+        const ObjDatabase objDB = ObjFileParser().parseBuffer(makeRandomVerticesText(1001));
+        const ObjQuantizedVertices quantized(objDB);
+
+        REQUIRE(quantized.getPositionsCount() == 1001);
+        REQUIRE(quantized.getEncodedPositions().size() == 1001 * 3);
+
+        std::vector<float> xyz(1001 * 3);
+        quantized.decodePositions(0, 1001, xyz.data());
+
+        bool arePositionsWithinBound = true;
+        for (size_t vtxIdx = 0; vtxIdx < 1001; ++vtxIdx)
+        {
+            const auto [x, y, z, w] = *objDB.getVertex(ElementType::VERTEX, vtxIdx);
+            const float coords[3] = {x, y, z};
+            for (size_t axis = 0; axis < 3; ++axis)
+            {
+                const float bound = quantized.getPositionsScale()[axis] * 0.5f +
+                                    std::fabs(coords[axis]) * 1.0e-6f;
+                arePositionsWithinBound = arePositionsWithinBound &&
+                                          (std::fabs(xyz[vtxIdx * 3 + axis] - coords[axis]) <=
+                                           bound);
+            }
+        }
+        REQUIRE(arePositionsWithinBound == true);
+
+        // Decoding from any vertex gives the same values.
+        std::vector<float> lastXYZ(3);
+        quantized.decodePositions(1000, 1, lastXYZ.data());
+        REQUIRE(lastXYZ == std::vector<float>(xyz.end() - 3, xyz.end()));
+
+        std::vector<float> uv(1001 * 2);
+        quantized.decodeTexCoords(0, 1001, uv.data());
+
+        bool areTexCoordsWithinBound = true;
+        for (size_t vtxIdx = 0; vtxIdx < 1001; ++vtxIdx)
+        {
+            const Vertex_t vtx = *objDB.getVertex(ElementType::VERTEX_TEXTURE, vtxIdx);
+            areTexCoordsWithinBound =
+                areTexCoordsWithinBound &&
+                (std::fabs(uv[vtxIdx * 2] - vtx.m_x) <=
+                 quantized.getTexCoordsScale()[0] * 0.5f + 1.0e-6f) &&
+                (std::fabs(uv[vtxIdx * 2 + 1] - vtx.m_y) <=
+                 quantized.getTexCoordsScale()[1] * 0.5f + 1.0e-6f);
+        }
+        REQUIRE(areTexCoordsWithinBound == true);
+
+        std::vector<float> normals(1001 * 3);
+        quantized.decodeNormals(0, 1001, normals.data());
+
+        // Octahedral 16-bit normals are within about 1e-4 radians.
+        float minCosine = 1.0f;
+        for (size_t vtxIdx = 0; vtxIdx < 1001; ++vtxIdx)
+        {
+            const auto [x, y, z, w] = *objDB.getVertex(ElementType::VERTEX_NORMAL, vtxIdx);
+            const float length = std::sqrt(x * x + y * y + z * z);
+            const float* pNormal = normals.data() + vtxIdx * 3;
+            minCosine = std::min(minCosine,
+                                 (pNormal[0] * x + pNormal[1] * y + pNormal[2] * z) / length);
+        }
+        REQUIRE(minCosine > std::cos(1.0e-3f));
+    }
+    SECTION("degenerate bounding boxes should decode exactly")
+    {
+        const ObjDatabase objDB = ObjFileParser().parseBuffer("v 1.5 -2 3\nv 1.5 -2 3\n"
+                                                              "v 1.5 4 3\n"
+                                                              "vt 0.25 0.75\n");
+        const ObjQuantizedVertices quantized(objDB);
+
+        REQUIRE(quantized.getPositionsScale()[0] == 0.0f);
+        REQUIRE(quantized.getPositionsScale()[2] == 0.0f);
+
+        std::vector<float> xyz(3 * 3);
+        quantized.decodePositions(0, 3, xyz.data());
+        REQUIRE(xyz == std::vector<float>{1.5f, -2.0f, 3.0f, 1.5f, -2.0f, 3.0f, 1.5f, 4.0f, 3.0f});
+
+        std::vector<float> uv(2);
+        quantized.decodeTexCoords(0, 1, uv.data());
+        REQUIRE(uv == std::vector<float>{0.25f, 0.75f});
+    }
+    SECTION("quantized databases should release their float vertices")
+    {
+        ObjDatabase objDB = ObjFileParser("tests/models/cube.obj").parseFile();
+        const size_t verticesCount = objDB.getVerticesCount();
+        const size_t normalsCount = objDB.getVerticesCount(ElementType::VERTEX_NORMAL);
+
+        objDB.quantizeVertices();
+
+        REQUIRE(objDB.getQuantizedVertices() != nullptr);
+        REQUIRE(objDB.getVerticesCount() == verticesCount);
+        REQUIRE(objDB.getVerticesCount(ElementType::VERTEX_NORMAL) == normalsCount);
+        REQUIRE(objDB.cbegin<ElementType::VERTEX>() == objDB.cend<ElementType::VERTEX>());
+        REQUIRE(objDB.getQuantizedVertices()->getMemorySize() <
+                verticesCount * 3 * sizeof(float) + normalsCount * 3 * sizeof(float));
+    }
+}
+
+TEST_CASE("Quantized databases consumers", "[quantized]")
+{
+    namespace fs = std::filesystem;
+
+    const std::string objFilePath = "tests/models/cube.obj";
+    const ObjDatabase objDB = ObjFileParser(objFilePath).parseFile();
+    ObjDatabase quantizedDB = ObjFileParser(objFilePath).parseFile();
+    quantizedDB.quantizeVertices();
+
+    SECTION("vertices should be decoded on demand")
+    {
+        REQUIRE(areDecodedVerticesNear(quantizedDB, objDB) == true);
+        REQUIRE(quantizedDB.getVertex(ElementType::VERTEX, objDB.getVerticesCount()) ==
+                std::nullopt);
+
+        size_t verticesCount = 0;
+        bool areNear = true;
+        quantizedDB.forEachVertex(ElementType::VERTEX_NORMAL, [&](const ObjEntityVertex& vtx) {
+            const auto [x, y, z, w] = vtx;
+            areNear = areNear &&
+                      areVerticesNear(
+                          x, y, z, *objDB.getVertex(ElementType::VERTEX_NORMAL, verticesCount++));
+        });
+        REQUIRE(areNear == true);
+        REQUIRE(verticesCount == objDB.getVerticesCount(ElementType::VERTEX_NORMAL));
+
+        // Only the decoded copies of the vertices exist.
+        const size_t vtxEntityIdx = std::distance(
+            objDB.getEntitiesTable().cbegin(),
+            std::find_if(objDB.getEntitiesTable().cbegin(),
+                         objDB.getEntitiesTable().cend(),
+                         [](const EntityLocation_t& location) {
+                             return (location.first == ElementType::VERTEX);
+                         }));
+        REQUIRE_THROWS_AS(quantizedDB.getEntity(vtxEntityIdx), std::logic_error);
+        REQUIRE_THROWS_AS(quantizedDB.getVerticesList(*quantizedDB.cbegin<ElementType::FACE>()),
+                          std::logic_error);
+    }
+    SECTION("the writer should write the decoded vertices")
+    {
+        const fs::path rtFilePath = fs::temp_directory_path() / "quantized_tests.obj";
+        REQUIRE(ObjFileWriter(quantizedDB).writeFile(rtFilePath) == true);
+        const ObjDatabase rtObjDB = ObjFileParser(rtFilePath).parseFile();
+        fs::remove(rtFilePath);
+
+        REQUIRE(rtObjDB.getEntitiesCount() == objDB.getEntitiesCount());
+        REQUIRE(rtObjDB.getIndexBuffer() == objDB.getIndexBuffer());
+        REQUIRE(areDecodedVerticesNear(rtObjDB, objDB) == true);
+    }
+    SECTION("the render mesh should hold the decoded and the encoded attributes")
+    {
+        const ObjRenderMesh renderMesh(objDB);
+        const ObjRenderMesh quantizedMesh(quantizedDB);
+
+        REQUIRE(renderMesh.getQuantizedAttributes().has_value() == false);
+        REQUIRE(quantizedMesh.getIndices() == renderMesh.getIndices());
+        REQUIRE(quantizedMesh.getVerticesCount() == renderMesh.getVerticesCount());
+
+        const auto& positions = renderMesh.getPositions();
+        const auto& quantizedPositions = quantizedMesh.getPositions();
+        REQUIRE(std::equal(positions.cbegin(),
+                           positions.cend(),
+                           quantizedPositions.cbegin(),
+                           quantizedPositions.cend(),
+                           [](const float value, const float quantizedValue) {
+                               return (std::fabs(value - quantizedValue) <= 1.0e-3f);
+                           }));
+
+        // The encoded attributes decode to the render mesh's attributes.
+        REQUIRE(quantizedMesh.getQuantizedAttributes().has_value() == true);
+        const ObjRenderMesh::QuantizedAttributes& attributes =
+            *quantizedMesh.getQuantizedAttributes();
+        REQUIRE(attributes.m_positions.size() == quantizedMesh.getVerticesCount() * 3);
+        REQUIRE(attributes.m_texCoords.size() == quantizedMesh.getVerticesCount() * 2);
+        REQUIRE(attributes.m_normals.size() == quantizedMesh.getVerticesCount() * 2);
+
+        bool areDecodedEqual = true;
+        for (size_t valueIdx = 0; valueIdx < attributes.m_positions.size(); ++valueIdx)
+        {
+            const size_t axis = valueIdx % 3;
+            const float decoded = attributes.m_positions[valueIdx] *
+                                      attributes.m_positionsScale[axis] +
+                                  attributes.m_positionsOffset[axis];
+            areDecodedEqual = areDecodedEqual &&
+                              (std::fabs(decoded - quantizedPositions[valueIdx]) <= 1.0e-6f);
+        }
+        REQUIRE(areDecodedEqual == true);
+    }
+    SECTION("the exporters and the shared database should get the decoded vertices")
+    {
+        const fs::path basePath = fs::temp_directory_path() / "quantized_tests";
+        const fs::path positionsPath = basePath.string() + ".positions.f32";
+        REQUIRE(ObjRawBuffersExporter(quantizedDB).exportFiles(basePath) == true);
+
+        std::vector<float> positions(objDB.getVerticesCount() * 3);
+        REQUIRE(fs::file_size(positionsPath) == positions.size() * sizeof(float));
+        std::ifstream(positionsPath, std::ios::binary)
+            .read(reinterpret_cast<char*>(positions.data()), fs::file_size(positionsPath));
+        for (const char* pSuffix : {".positions.f32", ".indices.u32"})
+        {
+            fs::remove(basePath.string() + pSuffix);
+        }
+
+        bool areNear = true;
+        for (size_t vtxIdx = 0; vtxIdx < objDB.getVerticesCount(); ++vtxIdx)
+        {
+            areNear = areNear && areVerticesNear(positions[vtxIdx * 3],
+                                                 positions[vtxIdx * 3 + 1],
+                                                 positions[vtxIdx * 3 + 2],
+                                                 *objDB.getVertex(ElementType::VERTEX, vtxIdx));
+        }
+        REQUIRE(areNear == true);
+
+        const fs::path plyFilePath = fs::temp_directory_path() / "quantized_tests.ply";
+        const fs::path floatPlyFilePath = fs::temp_directory_path() / "float_tests.ply";
+        REQUIRE(ObjPlyExporter(quantizedDB).exportFile(plyFilePath) == true);
+        REQUIRE(ObjPlyExporter(objDB).exportFile(floatPlyFilePath) == true);
+        REQUIRE(fs::file_size(plyFilePath) == fs::file_size(floatPlyFilePath));
+        fs::remove(plyFilePath);
+        fs::remove(floatPlyFilePath);
+
+        const std::string segmentName = "objparser-quantized-tests-" + std::to_string(getpid());
+        REQUIRE(ObjSharedDatabase::publish(quantizedDB, segmentName) == true);
+        const std::optional<ObjSharedDatabase> sharedDB = ObjSharedDatabase::attach(segmentName);
+        ObjSharedDatabase::unpublish(segmentName);
+        REQUIRE(sharedDB.has_value() == true);
+        REQUIRE(sharedDB->getVerticesCount() == objDB.getVerticesCount());
+
+        const ObjSharedDatabase::Vertex& sharedVtx =
+            sharedDB->getVertex(ElementType::VERTEX, 0)->get();
+        REQUIRE(areVerticesNear(sharedVtx.m_x,
+                                sharedVtx.m_y,
+                                sharedVtx.m_z,
+                                *objDB.getVertex(ElementType::VERTEX, 0)) == true);
+    }
+}
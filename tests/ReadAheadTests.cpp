@@ -0,0 +1,111 @@
+// =============================================================================
+// Copyright (c) 2017 Othmane AIT EL CADI
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+
+/*
+ * \file      ReadAheadTests.cpp
+ *
+ * \author    Othmane AIT EL CADI - dartzon@gmail.com
+ * \date      18-10-2026
+ */
+
+#include "ObjFileParser.h"
+#include "ObjReadAheadStreamReader.h"
+
+#include "catch.h"
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+using Backend = ObjReadAheadStreamReader::Backend;
+
+namespace
+{
+/// \brief  Read a whole text by chunks of a given size.
+std::string readText(ObjStreamReader& reader, const size_t chunkSize)
+{
+    std::string text;
+    std::vector<char> chunk(chunkSize);
+    for (size_t readSize = reader.read(chunk.data(), chunk.size()); readSize > 0;
+         readSize = reader.read(chunk.data(), chunk.size()))
+    {
+        text.append(chunk.data(), readSize);
+    }
+
+    return text;
+}
+
+}  // namespace
+
+TEST_CASE("Reading Obj files ahead", "[readahead]")
+{
+    const std::string objFilePath = "tests/models/ducky.obj";
+
+    std::ostringstream objText;
+    objText << std::ifstream(objFilePath).rdbuf();
+
+    for (const Backend backend : {Backend::IO_URING, Backend::READ_THREAD})
+    {
+        SECTION("both backends should read the whole file, whatever the blocks' size")
+        {
+            ObjReadAheadStreamReader reader(objFilePath, 4096, 3, backend);
+            if (backend == Backend::READ_THREAD)
+            {
+                REQUIRE(reader.getBackend() == Backend::READ_THREAD);
+            }
+
+            REQUIRE(readText(reader, 1000) == objText.str());
+            REQUIRE(reader.hasFailed() == false);
+        }
+        SECTION("both backends should give the same database as the file")
+        {
+            ObjReadAheadStreamReader reader(objFilePath, 64 * 1024, 2, backend);
+            ObjFileParser fp(objFilePath);
+            const ObjDatabase objDB = fp.parseStream(reader);
+
+            ObjFileParser fileFp(objFilePath);
+            REQUIRE(objDB.getFacesCount() == fileFp.parseFile().getFacesCount());
+        }
+        SECTION("missing files should fail without any text")
+        {
+            ObjReadAheadStreamReader reader("tests/models/none.obj", 4096, 2, backend);
+
+            REQUIRE(readText(reader, 16).empty() == true);
+            REQUIRE(reader.hasFailed() == true);
+        }
+        SECTION("failed readers should fail their parsing")
+        {
+            ObjReadAheadStreamReader reader("tests/models/none.obj", 4096, 2, backend);
+
+            ObjFileParser fp;
+            REQUIRE_THROWS_AS(fp.parseStream(reader), std::runtime_error);
+        }
+        SECTION("readers destroyed before the end of the file should wait for their reads")
+        {
+            ObjReadAheadStreamReader reader(objFilePath, 1024, 4, backend);
+
+            std::array<char, 10> chunk;
+            REQUIRE(reader.read(chunk.data(), chunk.size()) == chunk.size());
+        }
+    }
+}
@@ -0,0 +1,104 @@
+// =============================================================================
+// Copyright (c) 2017 Othmane AIT EL CADI
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+
+
+/*
+ * \file      RenderMeshTests.cpp
+ *
+ * \author    Othmane AIT EL CADI - dartzon@gmail.com
+ * \date      18-10-2026
+ */
+
+#include "ObjDatabase.h"
+#include "ObjFileParser.h"
+#include "ObjGlbExporter.h"
+#include "ObjRenderMesh.h"
+
+#include "catch.h"
+
+#include <cstdio>
+
+TEST_CASE("Building render buffers", "[rendermesh]")
+{
+    ObjFileParser fp(std::string("tests/models/cube.obj"));
+    const ObjDatabase objDB = fp.parseFile();
+    const ObjRenderMesh renderMesh(objDB);
+
+    SECTION("corners sharing the same vertices triplet should be welded")
+    {
+        REQUIRE(renderMesh.getTrianglesCount() == 12);
+        REQUIRE(renderMesh.getVerticesCount() == 24);
+        REQUIRE(renderMesh.hasNormals() == true);
+        REQUIRE(renderMesh.hasTexCoords() == true);
+        REQUIRE(renderMesh.getNormals().size() == renderMesh.getVerticesCount() * 3);
+        REQUIRE(renderMesh.getTexCoords().size() == renderMesh.getVerticesCount() * 2);
+    }
+    SECTION("the faces of the cube's group should form one sub-mesh")
+    {
+        REQUIRE(renderMesh.getSubMeshes().size() == 1);
+        REQUIRE(renderMesh.getSubMeshes()[0].m_name == "cube");
+        REQUIRE(renderMesh.getSubMeshes()[0].m_firstIndex == 0);
+        REQUIRE(renderMesh.getSubMeshes()[0].m_indicesCount == 36);
+    }
+    SECTION("the bounding box should enclose the unit cube")
+    {
+        REQUIRE(renderMesh.getBoundsMin()[0] == Approx(-0.5f));
+        REQUIRE(renderMesh.getBoundsMax()[2] == Approx(0.5f));
+    }
+}
+
+TEST_CASE("Exporting a GLB file", "[glb]")
+{
+    ObjFileParser fp(std::string("tests/models/ducky.obj"));
+    const ObjDatabase objDB = fp.parseFile();
+    const ObjRenderMesh renderMesh(objDB);
+
+    const char* pGlbFilePath = "ducky_tests.glb";
+    REQUIRE(ObjGlbExporter(renderMesh).exportFile(pGlbFilePath) == true);
+
+    std::FILE* pFile = std::fopen(pGlbFilePath, "rb");
+    REQUIRE(pFile != nullptr);
+
+    uint32_t header[5] = {};
+    REQUIRE(std::fread(header, sizeof(uint32_t), 5, pFile) == 5);
+    std::fseek(pFile, 0, SEEK_END);
+    const long fileSize = std::ftell(pFile);
+    std::fclose(pFile);
+    std::remove(pGlbFilePath);
+
+    SECTION("the header and the JSON chunk should be valid")
+    {
+        REQUIRE(header[0] == 0x46546C67);
+        REQUIRE(header[1] == 2);
+        REQUIRE(header[2] == static_cast<uint32_t>(fileSize));
+        REQUIRE(header[3] % 4 == 0);
+        REQUIRE(header[4] == 0x4E4F534A);
+    }
+    SECTION("the binary chunk should hold all the render buffers")
+    {
+        const size_t binSize = (renderMesh.getPositions().size() +
+                                renderMesh.getTexCoords().size() + renderMesh.getIndices().size()) *
+                               4;
+        REQUIRE(static_cast<size_t>(fileSize) == 12 + 8 + header[3] + 8 + binSize);
+    }
+}
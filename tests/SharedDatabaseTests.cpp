@@ -0,0 +1,147 @@
+// =============================================================================
+// Copyright (c) 2017 Othmane AIT EL CADI
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+
+/*
+ * \file      SharedDatabaseTests.cpp
+ *
+ * \author    Othmane AIT EL CADI - dartzon@gmail.com
+ * \date      18-10-2026
+ */
+
+#include "ObjFileParser.h"
+#include "ObjSharedDatabase.h"
+
+#include "catch.h"
+
+#include <algorithm>
+#include <sys/wait.h>
+#include <unistd.h>
+
+TEST_CASE("Obj databases published in shared memory", "[shareddb]")
+{
+    const std::string segmentName = "objparser-tests-" + std::to_string(getpid());
+
+    ObjFileParser fp("tests/models/cube.obj");
+    const ObjDatabase objDB = fp.parseFile();
+
+    REQUIRE(ObjSharedDatabase::publish(objDB, segmentName) == true);
+
+    SECTION("attached databases should hold the published entities")
+    {
+        const std::optional<ObjSharedDatabase> sharedDB = ObjSharedDatabase::attach(segmentName);
+        REQUIRE(sharedDB.has_value() == true);
+
+        for (const ElementType type : {ElementType::VERTEX,
+                                       ElementType::VERTEX_TEXTURE,
+                                       ElementType::VERTEX_NORMAL})
+        {
+            REQUIRE(sharedDB->getVerticesCount(type) == objDB.getVerticesCount(type));
+            for (size_t idx = 0; idx < objDB.getVerticesCount(type); ++idx)
+            {
+                const auto [x, y, z, w] = *objDB.getVertex(type, idx);
+                const ObjSharedDatabase::Vertex& vtx = sharedDB->getVertex(type, idx)->get();
+                REQUIRE(((vtx.m_x == x) && (vtx.m_y == y) && (vtx.m_z == z) && (vtx.m_w == w)));
+            }
+        }
+
+        REQUIRE(sharedDB->getFacesCount() == objDB.getFacesCount());
+        REQUIRE(sharedDB->getEntitiesCount() == objDB.getEntitiesCount());
+        auto faceItr = objDB.cbegin<ElementType::FACE>();
+        for (auto sharedFaceItr = sharedDB->begin<ElementType::FACE>();
+             sharedFaceItr != sharedDB->end<ElementType::FACE>();
+             ++sharedFaceItr, ++faceItr)
+        {
+            const auto [first, last] = objDB.getVerticesIterators(*faceItr);
+            const auto [sharedFirst, sharedLast] = sharedDB->getVerticesIterators(*sharedFaceItr);
+            REQUIRE(std::equal(first, last, sharedFirst, sharedLast) == true);
+            REQUIRE(sharedFaceItr->m_materialID == faceItr->getMaterialID());
+            REQUIRE(sharedFaceItr->m_isTriangle == faceItr->isTriangle());
+        }
+
+        REQUIRE(sharedDB->getGroupsCount() == objDB.getGroupsCount());
+        auto groupItr = objDB.cbegin<ElementType::GROUP_NAME>();
+        for (auto sharedGroupItr = sharedDB->begin<ElementType::GROUP_NAME>();
+             sharedGroupItr != sharedDB->end<ElementType::GROUP_NAME>();
+             ++sharedGroupItr, ++groupItr)
+        {
+            REQUIRE(sharedGroupItr->m_type == groupItr->getType());
+            if (const auto name = groupItr->getGroupName(); name.has_value() == true)
+            {
+                REQUIRE(sharedDB->getString(sharedGroupItr->m_name) == name->get());
+            }
+
+            const auto [firstRange, lastRange] = sharedDB->getEntitiesRanges(*sharedGroupItr);
+            REQUIRE(std::equal(firstRange,
+                               lastRange,
+                               groupItr->getEntitiesIndicesRange().cbegin(),
+                               groupItr->getEntitiesIndicesRange().cend(),
+                               [](const auto& range, const auto& dbRange) {
+                                   return (range.m_first == dbRange.first) &&
+                                          (range.m_last == dbRange.second);
+                               }));
+        }
+
+        REQUIRE(sharedDB->getMaterialsCount() == 1);
+        REQUIRE(sharedDB->getMaterialName(0) == "cube");
+        REQUIRE(sharedDB->getMaterialLibraryRef(0) == "cube.mtl");
+    }
+    SECTION("other processes should attach the database")
+    {
+        const pid_t pid = fork();
+        if (pid == 0)
+        {
+            const auto sharedDB = ObjSharedDatabase::attach(segmentName);
+            _exit(((sharedDB.has_value() == true) &&
+                   (sharedDB->getFacesCount() == objDB.getFacesCount()))
+                      ? 0
+                      : 1);
+        }
+
+        int status = 0;
+        REQUIRE(waitpid(pid, &status, 0) == pid);
+        REQUIRE(WIFEXITED(status));
+        REQUIRE(WEXITSTATUS(status) == 0);
+    }
+    SECTION("attached databases should outlive their name")
+    {
+        const auto sharedDB = ObjSharedDatabase::attach(segmentName);
+        REQUIRE(ObjSharedDatabase::unpublish(segmentName) == true);
+
+        REQUIRE(ObjSharedDatabase::attach(segmentName).has_value() == false);
+        REQUIRE(sharedDB->getFacesCount() == objDB.getFacesCount());
+        REQUIRE(sharedDB->getMaterialName(0) == "cube");
+    }
+    SECTION("republished databases should replace the segment")
+    {
+        const auto sharedDB = ObjSharedDatabase::attach(segmentName);
+
+        const ObjDatabase emptyDB = ObjFileParser().parseBuffer("");
+        REQUIRE(ObjSharedDatabase::publish(emptyDB, segmentName) == true);
+
+        REQUIRE(ObjSharedDatabase::attach(segmentName)->getFacesCount() == 0);
+        REQUIRE(sharedDB->getFacesCount() == objDB.getFacesCount());
+    }
+
+    ObjSharedDatabase::unpublish(segmentName);
+    REQUIRE(ObjSharedDatabase::attach("objparser-tests-none").has_value() == false);
+}
@@ -0,0 +1,71 @@
+// =============================================================================
+// Copyright (c) 2017 Othmane AIT EL CADI
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+
+
+
+/*
+ * \file      TextBufferTests.cpp
+ *
+ * \author    Othmane AIT EL CADI - dartzon@gmail.com
+ * \date      18-10-2026
+ */
+
+#include "TextBuffer.h"
+
+#include "catch.h"
+
+#include <string>
+
+TEST_CASE("Formatting text", "[textbuffer]")
+{
+    ObjUtils::TextBuffer text(4);
+
+    SECTION("floats should use their shortest round-trip representation")
+    {
+        text.append(0.5f).append(' ').append(-1.0f).append(' ').append(0.1f);
+        REQUIRE(text.getView() == "0.5 -1 0.1");
+
+        text.clear();
+        text.append(123.456789f);
+        REQUIRE(std::stof(std::string(text.getView())) == 123.456789f);
+    }
+    SECTION("integers should be formatted without leading zeros")
+    {
+        text.append(size_t(0)).append('/').append(-42).append('/').append(uint32_t(4294967295u));
+        REQUIRE(text.getView() == "0/-42/4294967295");
+    }
+    SECTION("the buffer should grow past its initial capacity")
+    {
+        const std::string line(1000, 'x');
+        for (int lineIdx = 0; lineIdx < 10; ++lineIdx)
+        {
+            text.append(line);
+        }
+        REQUIRE(text.getSize() == 10000);
+        REQUIRE(text.getView().substr(9990) == std::string(10, 'x'));
+    }
+    SECTION("JSON strings should be escaped")
+    {
+        text.appendJsonString("a\"b\\c\n");
+        REQUIRE(text.getView() == "\"a\\\"b\\\\c\\u000a\"");
+    }
+}